@@ -0,0 +1,133 @@
+#pragma once
+
+#include "fixed_containers/atomic_fixed_bitset.hpp"
+#include "fixed_containers/enum_set.hpp"
+#include "fixed_containers/enum_utils.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+
+namespace fixed_containers
+{
+/**
+ * Set of enum keys that can be read and modified concurrently, e.g. for dirty-flag tracking
+ * without a mutex. Properties:
+ *  - lock-free, built on `AtomicFixedBitset`
+ *  - same data layout as `FixedBitset<count of K>`, so it can be read with `FixedBitsetRawView`.
+ *    Unlike `EnumSet`, there is no stored size, as it could not be kept in sync with the bits
+ *    without a lock.
+ *  - no pointers stored, no dynamic allocations
+ *
+ * Single-key operations are atomic. Operations on the whole set (`snapshot()`, `take()`,
+ * `size()`, ...) are atomic per word of the underlying bitset.
+ */
+template <class K>
+class AtomicEnumSet
+{
+    using EnumAdapterType = rich_enums::EnumAdapter<K>;
+    static constexpr std::size_t ENUM_COUNT = EnumAdapterType::count();
+    using StorageType = AtomicFixedBitset<ENUM_COUNT>;
+    using BitsetType = typename StorageType::FixedBitsetType;
+
+public:
+    using key_type = K;
+    using value_type = K;
+    using size_type = std::size_t;
+    using EnumSetType = EnumSet<K>;
+
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return ENUM_COUNT; }
+
+private:
+    StorageType bitset_;
+
+public:
+    constexpr AtomicEnumSet() noexcept
+      : bitset_{}
+    {
+    }
+
+    explicit AtomicEnumSet(const EnumSetType& other) noexcept
+      : bitset_{to_bitset(other)}
+    {
+    }
+
+    AtomicEnumSet(std::initializer_list<K> list) noexcept
+      : AtomicEnumSet{EnumSetType{list}}
+    {
+    }
+
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+
+    [[nodiscard]] bool contains(const K& key,
+                                std::memory_order order = std::memory_order_seq_cst) const
+    {
+        return bitset_.test(EnumAdapterType::ordinal(key), order);
+    }
+
+    // Returns whether `key` was newly inserted, i.e. whether this call is the one that set it.
+    bool insert(const K& key, std::memory_order order = std::memory_order_seq_cst)
+    {
+        return !bitset_.test_and_set(EnumAdapterType::ordinal(key), order);
+    }
+    void insert(const EnumSetType& keys, std::memory_order order = std::memory_order_seq_cst)
+    {
+        (void)bitset_.fetch_or(to_bitset(keys), order);
+    }
+
+    // Returns the number of removed keys (0 or 1), like `EnumSet::erase()`.
+    size_type erase(const K& key, std::memory_order order = std::memory_order_seq_cst)
+    {
+        return bitset_.test_and_reset(EnumAdapterType::ordinal(key), order) ? 1 : 0;
+    }
+
+    void clear(std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        bitset_.reset_all(order);
+    }
+
+    // The following are snapshots and may be stale by the time they are returned,
+    // if there are concurrent writers.
+    [[nodiscard]] EnumSetType snapshot(
+        std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return to_enum_set(bitset_.snapshot(order));
+    }
+    [[nodiscard]] std::size_t size(
+        std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return bitset_.count(order);
+    }
+    [[nodiscard]] bool empty(std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return bitset_.none(order);
+    }
+
+    // Removes all keys and returns them. Every key inserted concurrently is either part of the
+    // result or remains in the set.
+    EnumSetType take(std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return to_enum_set(bitset_.take(order));
+    }
+
+private:
+    static BitsetType to_bitset(const EnumSetType& keys) noexcept
+    {
+        BitsetType out{};
+        for (const K& key : keys)
+        {
+            out.set(EnumAdapterType::ordinal(key));
+        }
+        return out;
+    }
+
+    static EnumSetType to_enum_set(const BitsetType& bitset) noexcept
+    {
+        EnumSetType out{};
+        bitset.for_each_set_bit([&out](std::size_t index)
+                                { out.insert(EnumAdapterType::values()[index]); });
+        return out;
+    }
+};
+
+}  // namespace fixed_containers
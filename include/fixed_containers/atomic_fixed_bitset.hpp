@@ -0,0 +1,273 @@
+#pragma once
+
+#include "fixed_containers/checking_hooks.hpp"
+#include "fixed_containers/fixed_bitset.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace fixed_containers
+{
+/**
+ * Fixed-size bitset whose bits can be read and modified concurrently. Properties:
+ *  - lock-free: every operation is a single atomic operation on one word (`std::atomic_ref`),
+ *    or a loop of them for the whole-bitset operations
+ *  - same data layout as `FixedBitset<BIT_COUNT>`, so it can be read with `FixedBitsetRawView`
+ *    (e.g. from a shared-memory segment)
+ *  - no pointers stored, no dynamic allocations
+ *  - not constexpr, as atomic operations are not (except for default construction, so instances
+ *    with static storage duration are constant-initialized)
+ *
+ * Operations on a single bit or word are atomic. Whole-bitset operations (`snapshot()`,
+ * `exchange()`, `fetch_or()`, ...) are atomic per word, but not across words: a concurrent writer
+ * touching two words may be observed half-way.
+ */
+template <std::size_t BIT_COUNT,
+          customize::SequenceContainerChecking CheckingType =
+              customize::SequenceContainerAbortChecking<bool, BIT_COUNT>>
+class AtomicFixedBitset
+{
+    using Helper = fixed_bitset_detail::FixedBitsetHelper<BIT_COUNT>;
+    static constexpr std::size_t BITS_PER_WORD = Helper::BITS_PER_WORD;
+    static constexpr std::size_t WORD_COUNT = Helper::WORD_COUNT + 1;
+
+    using Checking = CheckingType;
+    static_assert(!checking_hooks::ObservesUsage<Checking>,
+                  "AtomicFixedBitset does not report to the checking hooks");
+
+public:
+    using word_type = typename Helper::Ty;
+    using FixedBitsetType = FixedBitset<BIT_COUNT, CheckingType>;
+
+private:
+    using AtomicWordRef = std::atomic_ref<word_type>;
+    using Array = std::array<word_type, WORD_COUNT>;
+
+    static_assert(AtomicWordRef::is_always_lock_free,
+                  "Lock-free atomics are required for usage in shared memory");
+    static_assert(AtomicWordRef::required_alignment <= alignof(word_type),
+                  "Atomic words must keep the same alignment as the words of FixedBitset");
+
+    // Mutable so that const members can form the `atomic_ref`s they load through.
+    mutable Array data_;
+
+public:
+    constexpr AtomicFixedBitset() noexcept
+      : data_{}
+    {
+    }
+
+    explicit AtomicFixedBitset(const FixedBitsetType& other) noexcept
+      : data_{other.IMPLEMENTATION_DETAIL_DO_NOT_USE_data_}
+    {
+    }
+
+    AtomicFixedBitset(const AtomicFixedBitset&) = delete;
+    AtomicFixedBitset(AtomicFixedBitset&&) noexcept = delete;
+    AtomicFixedBitset& operator=(const AtomicFixedBitset&) = delete;
+    AtomicFixedBitset& operator=(AtomicFixedBitset&&) noexcept = delete;
+    ~AtomicFixedBitset() noexcept = default;
+
+    [[nodiscard]] static constexpr std::size_t size() noexcept { return BIT_COUNT; }
+    [[nodiscard]] static constexpr std::size_t word_count() noexcept { return WORD_COUNT; }
+
+    [[nodiscard]] bool test(
+        std::size_t pos,
+        std::memory_order order = std::memory_order_seq_cst,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+        const
+    {
+        check_pos(pos, loc);
+        return (word_at(pos / BITS_PER_WORD).load(order) & bit_mask(pos)) != 0;
+    }
+
+    // Sets the bit at `pos` and returns its previous value.
+    bool test_and_set(
+        std::size_t pos,
+        std::memory_order order = std::memory_order_seq_cst,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_pos(pos, loc);
+        const word_type mask = bit_mask(pos);
+        return (word_at(pos / BITS_PER_WORD).fetch_or(mask, order) & mask) != 0;
+    }
+
+    // Clears the bit at `pos` and returns its previous value.
+    bool test_and_reset(
+        std::size_t pos,
+        std::memory_order order = std::memory_order_seq_cst,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_pos(pos, loc);
+        const word_type mask = bit_mask(pos);
+        return (word_at(pos / BITS_PER_WORD).fetch_and(~mask, order) & mask) != 0;
+    }
+
+    void set(
+        std::size_t pos,
+        std::memory_order order = std::memory_order_seq_cst,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        (void)test_and_set(pos, order, loc);
+    }
+
+    void reset(
+        std::size_t pos,
+        std::memory_order order = std::memory_order_seq_cst,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        (void)test_and_reset(pos, order, loc);
+    }
+
+    // Word-level access, for callers that manage several flags of one word together. Bits past
+    // `size()` in the last word must be kept clear.
+    [[nodiscard]] word_type load_word(
+        std::size_t w_pos,
+        std::memory_order order = std::memory_order_seq_cst,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+        const
+    {
+        check_word_pos(w_pos, loc);
+        return word_at(w_pos).load(order);
+    }
+    word_type fetch_or_word(
+        std::size_t w_pos,
+        word_type mask,
+        std::memory_order order = std::memory_order_seq_cst,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_word_pos(w_pos, loc);
+        return word_at(w_pos).fetch_or(mask, order);
+    }
+    word_type fetch_and_word(
+        std::size_t w_pos,
+        word_type mask,
+        std::memory_order order = std::memory_order_seq_cst,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_word_pos(w_pos, loc);
+        return word_at(w_pos).fetch_and(mask, order);
+    }
+
+    // Whole-bitset operations, all of them wait-free. The modifying ones return the previous
+    // contents.
+    [[nodiscard]] FixedBitsetType snapshot(
+        std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        FixedBitsetType out{};
+        for (std::size_t w_pos = 0; w_pos < WORD_COUNT; ++w_pos)
+        {
+            out.IMPLEMENTATION_DETAIL_DO_NOT_USE_data_[w_pos] = word_at(w_pos).load(order);
+        }
+        return out;
+    }
+    FixedBitsetType exchange(const FixedBitsetType& desired,
+                             std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        FixedBitsetType out{};
+        for (std::size_t w_pos = 0; w_pos < WORD_COUNT; ++w_pos)
+        {
+            out.IMPLEMENTATION_DETAIL_DO_NOT_USE_data_[w_pos] = word_at(w_pos).exchange(
+                desired.IMPLEMENTATION_DETAIL_DO_NOT_USE_data_[w_pos], order);
+        }
+        return out;
+    }
+    FixedBitsetType fetch_or(const FixedBitsetType& other,
+                             std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        FixedBitsetType out{};
+        for (std::size_t w_pos = 0; w_pos < WORD_COUNT; ++w_pos)
+        {
+            out.IMPLEMENTATION_DETAIL_DO_NOT_USE_data_[w_pos] = word_at(w_pos).fetch_or(
+                other.IMPLEMENTATION_DETAIL_DO_NOT_USE_data_[w_pos], order);
+        }
+        return out;
+    }
+    FixedBitsetType fetch_and(const FixedBitsetType& other,
+                              std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        FixedBitsetType out{};
+        for (std::size_t w_pos = 0; w_pos < WORD_COUNT; ++w_pos)
+        {
+            out.IMPLEMENTATION_DETAIL_DO_NOT_USE_data_[w_pos] = word_at(w_pos).fetch_and(
+                other.IMPLEMENTATION_DETAIL_DO_NOT_USE_data_[w_pos], order);
+        }
+        return out;
+    }
+
+    // Clears all bits and returns what was set, e.g. to consume a set of dirty flags.
+    FixedBitsetType take(std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return exchange(FixedBitsetType{}, order);
+    }
+
+    void reset_all(std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        for (std::size_t w_pos = 0; w_pos < WORD_COUNT; ++w_pos)
+        {
+            word_at(w_pos).store(0, order);
+        }
+    }
+
+    // These are snapshots and may be stale by the time they are returned, if there are concurrent
+    // writers.
+    [[nodiscard]] std::size_t count(
+        std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        std::size_t result = 0;
+        for (std::size_t w_pos = 0; w_pos < WORD_COUNT; ++w_pos)
+        {
+            result += static_cast<std::size_t>(std::popcount(word_at(w_pos).load(order)));
+        }
+        return result;
+    }
+    [[nodiscard]] bool any(std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        for (std::size_t w_pos = 0; w_pos < WORD_COUNT; ++w_pos)
+        {
+            if (word_at(w_pos).load(order) != 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+    [[nodiscard]] bool none(std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return !any(order);
+    }
+
+private:
+    [[nodiscard]] AtomicWordRef word_at(std::size_t w_pos) const noexcept
+    {
+        return AtomicWordRef{data_[w_pos]};
+    }
+
+    [[nodiscard]] static constexpr word_type bit_mask(std::size_t pos) noexcept
+    {
+        return word_type{1} << (pos % BITS_PER_WORD);
+    }
+
+    static void check_pos(std::size_t pos, const std_transition::source_location& loc)
+    {
+        if (preconditions::test(pos < BIT_COUNT))
+        {
+            Checking::out_of_range(pos, BIT_COUNT, loc);
+        }
+    }
+    static void check_word_pos(std::size_t w_pos, const std_transition::source_location& loc)
+    {
+        if (preconditions::test(w_pos < WORD_COUNT))
+        {
+            Checking::out_of_range(w_pos, WORD_COUNT, loc);
+        }
+    }
+};
+
+}  // namespace fixed_containers
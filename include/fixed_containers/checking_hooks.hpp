@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+// Optional members that a Checking policy can provide to observe how a container is used, for
+// example to collect statistics (see `stats_checking.hpp`):
+//  - `record_insert(count, size_after)`
+//  - `record_erase(count, size_after)`
+//  - `record_lookup()`
+// Containers call these after the operation. If a policy doesn't have them, as with the abort
+// policies, the calls compile out. They are not called during constant evaluation.
+//
+// Containers that take a Checking policy but don't call these reject policies that provide them
+// with a `static_assert` on `ObservesUsage`, instead of silently reporting nothing.
+namespace fixed_containers::checking_hooks
+{
+template <class Checking>
+concept ObservesUsage = requires(std::size_t count) { Checking::record_insert(count, count); } ||
+                        requires(std::size_t count) { Checking::record_erase(count, count); } ||
+                        requires { Checking::record_lookup(); };
+
+template <class Checking>
+constexpr void record_insert(const std::size_t count, const std::size_t size_after)
+{
+    if constexpr (requires { Checking::record_insert(count, size_after); })
+    {
+        if (!std::is_constant_evaluated())
+        {
+            Checking::record_insert(count, size_after);
+        }
+    }
+}
+
+template <class Checking>
+constexpr void record_erase(const std::size_t count, const std::size_t size_after)
+{
+    if constexpr (requires { Checking::record_erase(count, size_after); })
+    {
+        if (!std::is_constant_evaluated())
+        {
+            Checking::record_erase(count, size_after);
+        }
+    }
+}
+
+template <class Checking>
+constexpr void record_lookup()
+{
+    if constexpr (requires { Checking::record_lookup(); })
+    {
+        if (!std::is_constant_evaluated())
+        {
+            Checking::record_lookup();
+        }
+    }
+}
+}  // namespace fixed_containers::checking_hooks
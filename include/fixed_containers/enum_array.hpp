@@ -5,8 +5,11 @@
 #include "fixed_containers/concepts.hpp"
 #include "fixed_containers/enum_utils.hpp"
 #include "fixed_containers/ranges.hpp"
+#include "fixed_containers/sort.hpp"
 
 #include <array>
+#include <cstddef>
+#include <functional>
 
 namespace fixed_containers
 {
@@ -183,6 +186,40 @@ private:
     }
     constexpr ValueArrayType& values() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_values_; }
 };
+
+// Sorting algorithms that choose their strategy at compile-time, based on the enum count. See
+// `sort_detail` for the details.
+template <typename L, typename T, typename Compare = std::less<>>
+constexpr void sort(EnumArray<L, T>& container, Compare comparator = {})
+{
+    sort_detail::sort<rich_enums::EnumAdapter<L>::count()>(
+        container.begin(), container.end(), comparator);
+}
+
+template <typename L, typename T, typename Compare = std::less<>>
+constexpr void stable_sort(EnumArray<L, T>& container, Compare comparator = {})
+{
+    sort_detail::stable_sort<rich_enums::EnumAdapter<L>::count()>(
+        container.begin(), container.end(), comparator);
+}
+
+template <typename L, typename T, typename Compare = std::less<>>
+constexpr void partial_sort(EnumArray<L, T>& container,
+                            typename EnumArray<L, T>::iterator middle,
+                            Compare comparator = {})
+{
+    sort_detail::partial_sort<rich_enums::EnumAdapter<L>::count()>(
+        container.begin(), middle, container.end(), comparator);
+}
+
+template <typename L, typename T, typename Compare = std::less<>>
+constexpr void nth_element(EnumArray<L, T>& container,
+                           typename EnumArray<L, T>::iterator nth,
+                           Compare comparator = {})
+{
+    sort_detail::nth_element<rich_enums::EnumAdapter<L>::count()>(
+        container.begin(), nth, container.end(), comparator);
+}
 }  // namespace fixed_containers
 
 // Specializations
@@ -2,11 +2,12 @@
 
 #include "fixed_containers/assert_or_abort.hpp"
 #include "fixed_containers/bidirectional_iterator.hpp"
+#include "fixed_containers/checking_hooks.hpp"
 #include "fixed_containers/concepts.hpp"
 #include "fixed_containers/emplace.hpp"
+#include "fixed_containers/enum_set.hpp"
 #include "fixed_containers/enum_utils.hpp"
 #include "fixed_containers/erase_if.hpp"
-#include "fixed_containers/filtered_integer_range_iterator.hpp"
 #include "fixed_containers/fixed_bitset.hpp"
 #include "fixed_containers/fixed_vector.hpp"
 #include "fixed_containers/memory.hpp"
@@ -144,13 +145,6 @@ protected:  // [WORKAROUND-1] - Needed by the non-trivially-copyable flavor of E
     static constexpr const auto& ENUM_VALUES = EnumAdapterType::values();
 
 private:
-    struct IndexPredicate
-    {
-        const KeyArrayType* array_set_;
-        constexpr bool operator()(const std::size_t index) const { return (*array_set_)[index]; }
-        constexpr bool operator==(const IndexPredicate&) const = default;
-    };
-
     template <bool IS_CONST>
     class PairProvider
     {
@@ -159,8 +153,7 @@ private:
             std::conditional_t<IS_CONST, const ValueArrayType, ValueArrayType>;
 
     private:
-        FilteredIntegerRangeEntryProvider<IndexPredicate, CompileTimeIntegerRange<0, ENUM_COUNT>>
-            present_indices_;
+        fixed_bitset_detail::SetBitIndexProvider<KeyArrayType> present_indices_;
         ConstOrMutableValueArray* values_;
 
     public:
@@ -172,9 +165,7 @@ private:
         constexpr PairProvider(const KeyArrayType* array_set,
                                ConstOrMutableValueArray* const values,
                                const std::size_t current_index) noexcept
-          : present_indices_{CompileTimeIntegerRange<0, ENUM_COUNT>{},
-                             current_index,
-                             IndexPredicate{array_set}}
+          : present_indices_{array_set, current_index}
           , values_{values}
         {
         }
@@ -413,13 +404,10 @@ public:
 
     constexpr void clear() noexcept
     {
-        const std::size_t max_sz = max_size();
-        for (std::size_t i = 0; i < max_sz; i++)
+        for (std::size_t i = array_set().find_first(); i < ENUM_COUNT;
+             i = array_set().find_next(i))
         {
-            if (array_set_unchecked_at(i))
-            {
-                reset_at(i);
-            }
+            reset_at(i);
         }
     }
     constexpr std::pair<iterator, bool> insert(const value_type& value) noexcept
@@ -545,7 +533,7 @@ public:
             last == cend() ? ENUM_COUNT : EnumAdapterType::ordinal(last->first);
         assert_or_abort(from_inclusive <= to_exclusive);
 
-        for (std::size_t i = from_inclusive; i < to_exclusive; i++)
+        for (std::size_t i = from_inclusive; i < to_exclusive; i = array_set().find_next(i))
         {
             if (contains_at(i))
             {
@@ -571,6 +559,7 @@ public:
     [[nodiscard]] constexpr iterator find(const K& key) noexcept
     {
         const std::size_t ordinal = EnumAdapterType::ordinal(key);
+        checking_hooks::record_lookup<Checking>();
         if (!this->contains_at(ordinal))
         {
             return this->end();
@@ -582,6 +571,7 @@ public:
     [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
     {
         const std::size_t ordinal = EnumAdapterType::ordinal(key);
+        checking_hooks::record_lookup<Checking>();
         if (!this->contains_at(ordinal))
         {
             return this->cend();
@@ -592,6 +582,7 @@ public:
 
     [[nodiscard]] constexpr bool contains(const K& key) const noexcept
     {
+        checking_hooks::record_lookup<Checking>();
         return contains_at(EnumAdapterType::ordinal(key));
     }
 
@@ -600,6 +591,55 @@ public:
         return static_cast<std::size_t>(contains(key));
     }
 
+    // Moves the entries of `source` whose keys are not in this map, like `std::map::merge()`.
+    // Only the keys in the difference of the two key masks are visited.
+    constexpr void merge(EnumMapBase& source) noexcept
+    {
+        KeyArrayType moved = source.array_set();
+        moved.and_not(array_set());
+        moved.for_each_set_bit(
+            [&](const std::size_t index)
+            {
+                memory::construct_at_address_of(values_unchecked_at(index),
+                                                std::move(source.unchecked_at(index)));
+                if constexpr (NotTriviallyDestructible<V>)  // if-check needed by clang
+                {
+                    memory::destroy_at_address_of(source.unchecked_at(index));
+                }
+            });
+
+        const std::size_t moved_count = moved.count();
+        array_set() |= moved;
+        increment_size(moved_count);
+        source.array_set().and_not(moved);
+        source.decrement_size(moved_count);
+    }
+    constexpr void merge(EnumMapBase&& source) noexcept { merge(source); }
+
+    // Makes the keys of this map exactly those of `mask`: keys outside of it are erased and the
+    // missing ones are constructed from `args`. Entries for keys in both are left untouched. Only
+    // the keys in the differences of the two masks are visited.
+    template <class... Args>
+    constexpr void assign_from_mask(const EnumSet<K>& mask, const Args&... args) noexcept
+    {
+        const KeyArrayType& mask_bits = mask.bitset();
+
+        KeyArrayType removed = array_set();
+        removed.and_not(mask_bits);
+        removed.for_each_set_bit([&](const std::size_t index) { reset_at(index); });
+
+        KeyArrayType added = mask_bits;
+        added.and_not(array_set());
+        added.for_each_set_bit(
+            [&](const std::size_t index)
+            {
+                memory::construct_at_address_of(
+                    values_unchecked_at(index), std::in_place, args...);
+            });
+        array_set() |= added;
+        increment_size(added.count());
+    }
+
     template <customize::EnumMapChecking<K> CheckingType2>
     [[nodiscard]] constexpr bool operator==(const EnumMapBase<K, V, CheckingType2>& other) const
     {
@@ -718,14 +758,25 @@ protected:  // [WORKAROUND-1]
     constexpr void increment_size(const std::size_t n = 1)
     {
         IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ += n;
+        checking_hooks::record_insert<Checking>(n, size());
     }
     constexpr void decrement_size(const std::size_t n = 1)
     {
         IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ -= n;
+        checking_hooks::record_erase<Checking>(n, size());
     }
     constexpr void set_size(const std::size_t size)
     {
+        const std::size_t previous_size = IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
         IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = size;
+        if (size > previous_size)
+        {
+            checking_hooks::record_insert<Checking>(size - previous_size, size);
+        }
+        else if (size < previous_size)
+        {
+            checking_hooks::record_erase<Checking>(previous_size - size, size);
+        }
     }
 };
 }  // namespace fixed_containers::enum_map_detail
@@ -821,28 +872,24 @@ public:
     {
         this->array_set() = other.array_set();
         this->set_size(other.size());
-        for (std::size_t i = 0; i < Base::ENUM_COUNT; i++)
-        {
-            if (this->contains_at(i))
+        this->array_set().for_each_set_bit(
+            [this, &other](const std::size_t i)
             {
                 memory::construct_at_address_of(this->values_unchecked_at(i),
                                                 other.values_unchecked_at(i));
-            }
-        }
+            });
     }
     constexpr EnumMap(EnumMap&& other) noexcept
       : EnumMap()
     {
         this->array_set() = other.array_set();
         this->set_size(other.size());
-        for (std::size_t i = 0; i < Base::ENUM_COUNT; i++)
-        {
-            if (this->contains_at(i))
+        this->array_set().for_each_set_bit(
+            [this, &other](const std::size_t i)
             {
                 memory::construct_at_address_of(this->values_unchecked_at(i),
                                                 std::move(other.values_unchecked_at(i)));
-            }
-        }
+            });
         // Clear the moved-out-of-map. This is consistent with both std::map
         // as well as the trivial move constructor of this class.
         other.clear();
@@ -857,14 +904,12 @@ public:
         this->clear();
         this->array_set() = other.array_set();
         this->set_size(other.size());
-        for (std::size_t i = 0; i < Base::ENUM_COUNT; i++)
-        {
-            if (this->contains_at(i))
+        this->array_set().for_each_set_bit(
+            [this, &other](const std::size_t i)
             {
                 memory::construct_at_address_of(this->values_unchecked_at(i),
                                                 other.values_unchecked_at(i));
-            }
-        }
+            });
         return *this;
     }
     constexpr EnumMap& operator=(EnumMap&& other) noexcept
@@ -877,14 +922,12 @@ public:
         this->clear();
         this->array_set() = other.array_set();
         this->set_size(other.size());
-        for (std::size_t i = 0; i < Base::ENUM_COUNT; i++)
-        {
-            if (this->contains_at(i))
+        this->array_set().for_each_set_bit(
+            [this, &other](const std::size_t i)
             {
                 memory::construct_at_address_of(this->values_unchecked_at(i),
                                                 std::move(other.values_unchecked_at(i)));
-            }
-        }
+            });
         // The trivial assignment operator does not `other.clear()`, so don't do it here either for
         // consistency across EnumMaps. std::map<T> does clear it, so behavior is different.
         // Both choices are fine, because the state of a moved object is intentionally unspecified
@@ -6,7 +6,6 @@
 #include "fixed_containers/concepts.hpp"
 #include "fixed_containers/enum_utils.hpp"
 #include "fixed_containers/erase_if.hpp"
-#include "fixed_containers/filtered_integer_range_iterator.hpp"
 #include "fixed_containers/fixed_bitset.hpp"
 
 #include <array>
@@ -122,17 +121,9 @@ private:
     using StorageType = FixedBitset<ENUM_COUNT>;
     static constexpr const KeyArrayType& ENUM_VALUES = EnumAdapterType::values();
 
-    struct IndexPredicate
-    {
-        const StorageType* array_set_;
-        constexpr bool operator()(const std::size_t index) const { return (*array_set_)[index]; }
-        constexpr bool operator==(const IndexPredicate&) const = default;
-    };
-
     class ReferenceProvider
     {
-        FilteredIntegerRangeEntryProvider<IndexPredicate, CompileTimeIntegerRange<0, ENUM_COUNT>>
-            present_indices_;
+        fixed_bitset_detail::SetBitIndexProvider<StorageType> present_indices_;
 
     public:
         constexpr ReferenceProvider()
@@ -141,8 +132,7 @@ private:
         }
 
         constexpr ReferenceProvider(const StorageType* array_set, const std::size_t current_index)
-          : present_indices_{
-                CompileTimeIntegerRange<0, ENUM_COUNT>{}, current_index, IndexPredicate{array_set}}
+          : present_indices_{array_set, current_index}
         {
         }
 
@@ -263,15 +253,18 @@ public:
     }
     [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
 
+    // The presence bit of each key, by ordinal. Lets set-wide operations work a word at a time.
+    [[nodiscard]] constexpr const FixedBitset<ENUM_COUNT>& bitset() const noexcept
+    {
+        return array_set();
+    }
+
     constexpr void clear() noexcept
     {
-        const std::size_t max_sz = max_size();
-        for (std::size_t i = 0; i < max_sz; i++)
+        for (std::size_t i = array_set().find_first(); i < ENUM_COUNT;
+             i = array_set().find_next(i))
         {
-            if (contains_at(i))
-            {
-                reset_at(i);
-            }
+            reset_at(i);
         }
     }
     constexpr std::pair<const_iterator, bool> insert(const K& key) noexcept
@@ -331,7 +324,7 @@ public:
             last == end() ? ENUM_COUNT : EnumAdapterType::ordinal(*last);
         assert_or_abort(from_inclusive <= to_exclusive);
 
-        for (std::size_t i = from_inclusive; i < to_exclusive; i++)
+        for (std::size_t i = from_inclusive; i < to_exclusive; i = array_set().find_next(i))
         {
             if (contains_at(i))
             {
@@ -370,6 +363,35 @@ public:
         return contains_at(EnumAdapterType::ordinal(key));
     }
 
+    // Bulk operations, on whole words of the underlying bitsets.
+    constexpr EnumSet& operator|=(const EnumSet<K>& other) noexcept
+    {
+        array_set() |= other.array_set();
+        set_size(array_set().count());
+        return *this;
+    }
+    constexpr EnumSet& operator&=(const EnumSet<K>& other) noexcept
+    {
+        array_set() &= other.array_set();
+        set_size(array_set().count());
+        return *this;
+    }
+    constexpr EnumSet& operator-=(const EnumSet<K>& other) noexcept
+    {
+        array_set().and_not(other.array_set());
+        set_size(array_set().count());
+        return *this;
+    }
+
+    [[nodiscard]] constexpr bool is_subset_of(const EnumSet<K>& other) const noexcept
+    {
+        return size() <= other.size() && array_set().count_and(other.array_set()) == size();
+    }
+    [[nodiscard]] constexpr bool intersects(const EnumSet<K>& other) const noexcept
+    {
+        return array_set().any_and(other.array_set());
+    }
+
     constexpr bool operator==(const EnumSet<K>& other) const
     {
         return array_set() == other.array_set();
@@ -403,6 +425,10 @@ private:
     {
         IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ -= n;
     }
+    constexpr void set_size(const std::size_t size)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = size;
+    }
 
     [[nodiscard]] constexpr const_iterator create_const_iterator(
         const std::size_t start_index) const noexcept
@@ -438,6 +464,22 @@ template <InputIterator InputIt>
 EnumSet(InputIt first,
         InputIt last) noexcept -> EnumSet<typename std::iterator_traits<InputIt>::value_type>;
 
+template <class K>
+[[nodiscard]] constexpr EnumSet<K> operator|(EnumSet<K> left, const EnumSet<K>& right) noexcept
+{
+    return left |= right;
+}
+template <class K>
+[[nodiscard]] constexpr EnumSet<K> operator&(EnumSet<K> left, const EnumSet<K>& right) noexcept
+{
+    return left &= right;
+}
+template <class K>
+[[nodiscard]] constexpr EnumSet<K> operator-(EnumSet<K> left, const EnumSet<K>& right) noexcept
+{
+    return left -= right;
+}
+
 template <class K, class Predicate>
 constexpr typename EnumSet<K>::size_type erase_if(EnumSet<K>& container, Predicate predicate)
 {
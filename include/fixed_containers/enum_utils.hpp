@@ -10,8 +10,10 @@
 #endif
 
 #include <array>
+#include <bit>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <functional>
 #include <optional>
@@ -129,6 +131,243 @@ concept is_enum_adapter =
     has_static_std_string_view_to_string_r<T, typename T::Enum> &&
     has_zero_based_and_sorted_contiguous_ordinal(T::values(), RichEnumAdapterOrdinalFunctor<T>{});
 
+// How `BuiltinEnumOrdinalTable` maps the underlying value of an enum constant to its ordinal.
+enum class EnumOrdinalLookup
+{
+    // Values are contiguous: the ordinal is the offset from the smallest value.
+    CONTIGUOUS,
+    // Values are dense enough to index a table spanning from the smallest to the largest one.
+    DIRECT_TABLE,
+    // Values are sparse: a multiplicative hash without collisions indexes a small table.
+    PERFECT_HASH,
+    // No perfect hash was found within the search budget.
+    BINARY_SEARCH,
+};
+
+namespace enum_ordinal_table_detail
+{
+// A table this many times larger than the count of values is considered too sparse to index
+// directly.
+inline constexpr std::size_t MAXIMUM_DIRECT_TABLE_SPREAD = 4;
+inline constexpr std::size_t MINIMUM_DIRECT_TABLE_SIZE = 64;
+// The perfect hash table is tried with up to `2^(1 + EXTRA_BITS)` slots per value, with this
+// many multipliers for each size.
+inline constexpr std::size_t PERFECT_HASH_EXTRA_BITS = 3;
+inline constexpr std::size_t PERFECT_HASH_MULTIPLIER_TRIES = 64;
+inline constexpr std::uint64_t GOLDEN_RATIO_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+
+struct PerfectHash
+{
+    std::uint64_t multiplier{};
+    std::size_t bits{};
+};
+
+// Differences of these are correct modulo 2^64, including for negative values.
+template <is_enum T>
+constexpr std::uint64_t key_bits(const T& key)
+{
+    return static_cast<std::uint64_t>(magic_enum::enum_integer(key));
+}
+
+template <is_enum T>
+constexpr std::uint64_t value_range()
+{
+    const auto& values = magic_enum::enum_values<T>();
+    return key_bits(values.back()) - key_bits(values.front()) + 1;
+}
+
+constexpr std::size_t hash(const std::uint64_t bits_of_key, const PerfectHash& perfect_hash)
+{
+    return static_cast<std::size_t>((bits_of_key * perfect_hash.multiplier) >>
+                                    (64 - perfect_hash.bits));
+}
+
+template <is_enum T>
+constexpr std::optional<PerfectHash> find_perfect_hash()
+{
+    const auto& values = magic_enum::enum_values<T>();
+    constexpr auto MINIMUM_BITS =
+        static_cast<std::size_t>(std::bit_width(magic_enum::enum_count<T>()));
+    for (std::size_t bits = MINIMUM_BITS; bits <= MINIMUM_BITS + PERFECT_HASH_EXTRA_BITS; bits++)
+    {
+        for (std::size_t i = 0; i < PERFECT_HASH_MULTIPLIER_TRIES; i++)
+        {
+            const PerfectHash candidate{GOLDEN_RATIO_MULTIPLIER * (2 * i + 1), bits};
+            std::array<bool, (std::size_t{1} << (MINIMUM_BITS + PERFECT_HASH_EXTRA_BITS))>
+                occupied{};
+            bool has_collision = false;
+            for (const T& value : values)
+            {
+                bool& slot = occupied.at(hash(key_bits(value), candidate));
+                if (slot)
+                {
+                    has_collision = true;
+                    break;
+                }
+                slot = true;
+            }
+            if (!has_collision)
+            {
+                return candidate;
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+template <is_enum T>
+constexpr EnumOrdinalLookup choose_lookup()
+{
+    constexpr std::size_t COUNT = magic_enum::enum_count<T>();
+    constexpr std::uint64_t VALUE_RANGE = value_range<T>();
+    if (VALUE_RANGE == COUNT)
+    {
+        return EnumOrdinalLookup::CONTIGUOUS;
+    }
+    if (VALUE_RANGE <= MAXIMUM_DIRECT_TABLE_SPREAD * COUNT ||
+        VALUE_RANGE <= MINIMUM_DIRECT_TABLE_SIZE)
+    {
+        return EnumOrdinalLookup::DIRECT_TABLE;
+    }
+    if (find_perfect_hash<T>().has_value())
+    {
+        return EnumOrdinalLookup::PERFECT_HASH;
+    }
+    return EnumOrdinalLookup::BINARY_SEARCH;
+}
+
+template <is_enum T>
+constexpr std::size_t table_index(const EnumOrdinalLookup lookup,
+                                  const PerfectHash& perfect_hash,
+                                  const std::uint64_t bits_of_key)
+{
+    if (lookup == EnumOrdinalLookup::DIRECT_TABLE)
+    {
+        return static_cast<std::size_t>(bits_of_key -
+                                        key_bits(magic_enum::enum_values<T>().front()));
+    }
+    return hash(bits_of_key, perfect_hash);
+}
+
+template <is_enum T>
+constexpr std::size_t table_size(const EnumOrdinalLookup lookup, const PerfectHash& perfect_hash)
+{
+    switch (lookup)
+    {
+    case EnumOrdinalLookup::DIRECT_TABLE:
+        return static_cast<std::size_t>(value_range<T>());
+    case EnumOrdinalLookup::PERFECT_HASH:
+        return std::size_t{1} << perfect_hash.bits;
+    case EnumOrdinalLookup::CONTIGUOUS:
+    case EnumOrdinalLookup::BINARY_SEARCH:
+        return 0;
+    }
+    return 0;
+}
+
+// Wide enough to also hold the count of values, which marks the empty slots.
+template <std::size_t COUNT>
+using OrdinalType =
+    std::conditional_t<(COUNT < 0xFF),
+                       std::uint8_t,
+                       std::conditional_t<(COUNT < 0xFFFF), std::uint16_t, std::uint32_t>>;
+
+template <is_enum T, EnumOrdinalLookup LOOKUP, PerfectHash PERFECT_HASH>
+constexpr auto make_table()
+{
+    constexpr std::size_t COUNT = magic_enum::enum_count<T>();
+    constexpr std::size_t TABLE_SIZE = table_size<T>(LOOKUP, PERFECT_HASH);
+    std::array<OrdinalType<COUNT>, TABLE_SIZE> out{};
+    if constexpr (TABLE_SIZE == 0)
+    {
+        return out;
+    }
+    out.fill(static_cast<OrdinalType<COUNT>>(COUNT));
+    const auto& values = magic_enum::enum_values<T>();
+    for (std::size_t i = 0; i < COUNT; i++)
+    {
+        out.at(table_index<T>(LOOKUP, PERFECT_HASH, key_bits(values[i]))) =
+            static_cast<OrdinalType<COUNT>>(i);
+    }
+    return out;
+}
+}  // namespace enum_ordinal_table_detail
+
+/**
+ * Ordinal lookup for builtin enums, computed at compile time from the values known to
+ * magic_enum. Picks the cheapest of the `EnumOrdinalLookup` strategies that fits the values, so
+ * that `ordinal()` is an offset or a single table read, with no `std::optional` to unwrap.
+ * Passing a value that is not one of the enum constants aborts.
+ */
+template <is_enum T>
+    requires(magic_enum::enum_count<T>() > 0)
+struct BuiltinEnumOrdinalTable
+{
+private:
+    static constexpr const auto& VALUES = magic_enum::enum_values<T>();
+    static constexpr std::size_t COUNT = VALUES.size();
+    static constexpr std::uint64_t MINIMUM_VALUE =
+        enum_ordinal_table_detail::key_bits(VALUES.front());
+
+public:
+    static constexpr EnumOrdinalLookup LOOKUP = enum_ordinal_table_detail::choose_lookup<T>();
+
+private:
+    static constexpr enum_ordinal_table_detail::PerfectHash PERFECT_HASH =
+        LOOKUP == EnumOrdinalLookup::PERFECT_HASH
+            ? enum_ordinal_table_detail::find_perfect_hash<T>().value()
+            : enum_ordinal_table_detail::PerfectHash{};
+    static constexpr auto TABLE = enum_ordinal_table_detail::make_table<T, LOOKUP, PERFECT_HASH>();
+
+public:
+    static constexpr std::size_t ordinal(const T& key)
+    {
+        const std::uint64_t bits_of_key = enum_ordinal_table_detail::key_bits(key);
+        if constexpr (LOOKUP == EnumOrdinalLookup::CONTIGUOUS)
+        {
+            const auto out = static_cast<std::size_t>(bits_of_key - MINIMUM_VALUE);
+            assert_or_abort(out < COUNT);
+            return out;
+        }
+        else if constexpr (LOOKUP == EnumOrdinalLookup::DIRECT_TABLE)
+        {
+            const auto index = static_cast<std::size_t>(bits_of_key - MINIMUM_VALUE);
+            assert_or_abort(index < TABLE.size());
+            const std::size_t out = TABLE[index];
+            assert_or_abort(out < COUNT);
+            return out;
+        }
+        else if constexpr (LOOKUP == EnumOrdinalLookup::PERFECT_HASH)
+        {
+            // Other values can hash to the slot of a constant, so the match is confirmed.
+            const std::size_t out =
+                TABLE[enum_ordinal_table_detail::hash(bits_of_key, PERFECT_HASH)];
+            assert_or_abort(out < COUNT && VALUES[out] == key);
+            return out;
+        }
+        else
+        {
+            // magic_enum lists the values in ascending order.
+            std::size_t first = 0;
+            std::size_t last = COUNT;
+            while (first < last)
+            {
+                const std::size_t middle = first + ((last - first) / 2);
+                if (magic_enum::enum_integer(VALUES[middle]) < magic_enum::enum_integer(key))
+                {
+                    first = middle + 1;
+                }
+                else
+                {
+                    last = middle;
+                }
+            }
+            assert_or_abort(first < COUNT && VALUES[first] == key);
+            return first;
+        }
+    }
+};
+
 template <is_enum T>
 struct BuiltinEnumAdapter;
 
@@ -151,7 +390,11 @@ struct BuiltinEnumAdapter<T>
     static constexpr const std::array<T, count()>& values() { return magic_enum::enum_values<T>(); }
     static constexpr std::size_t ordinal(const T& key)
     {
-        return magic_enum::enum_index(key).value();
+        return BuiltinEnumOrdinalTable<T>::ordinal(key);
+    }
+    static constexpr EnumOrdinalLookup ordinal_lookup()
+    {
+        return BuiltinEnumOrdinalTable<T>::LOOKUP;
     }
     static constexpr std::string_view to_string(const T& key) { return magic_enum::enum_name(key); }
 };
@@ -389,6 +632,8 @@ concept is_rich_enum = rich_enums_detail::is_rich_enum<T>;
 template <class T>
 concept is_enum_adapter = rich_enums_detail::is_enum_adapter<T>;
 
+using EnumOrdinalLookup = rich_enums_detail::EnumOrdinalLookup;
+
 /**
  * Adapter for any enum or enum-like class. Implementation for enums and rich enums is
  * provided. To create an adapter for a custom type or custom behavior for a specific enum,
@@ -546,7 +791,8 @@ protected:
 public:
     [[nodiscard]] constexpr std::size_t ordinal() const
     {
-        return magic_enum::enum_index(this->backing_enum()).value();
+        return rich_enums_detail::BuiltinEnumOrdinalTable<BackingEnumType>::ordinal(
+            this->backing_enum());
     }
 
     [[nodiscard]] constexpr std::string_view to_string() const
@@ -25,9 +25,13 @@
 // The Microsoft C++ Standard Library is under the Apache License v2.0 with LLVM Exception.
 // Original code from https://github.com/neargye-wg21/bitset-constexpr-proposal
 
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/checking_hooks.hpp"
+#include "fixed_containers/fixed_bitset_simd.hpp"
 #include "fixed_containers/preconditions.hpp"
 #include "fixed_containers/sequence_container_checking.hpp"
 
+#include <algorithm>
 #include <array>
 #include <bit>
 #include <cassert>
@@ -35,6 +39,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <limits>
 #include <string>
 #include <type_traits>
 
@@ -69,6 +74,8 @@ private:
     static constexpr std::size_t WORD_COUNT = Helper::WORD_COUNT;
 
     using Checking = CheckingType;
+    static_assert(!checking_hooks::ObservesUsage<Checking>,
+                  "FixedBitset does not report to the checking hooks");
 
     using Self =
         std::conditional_t<std::is_void_v<Derived>, FixedBitset<BIT_COUNT, Checking>, Derived>;
@@ -81,6 +88,11 @@ private:
     using Ty = typename fixed_bitset_detail::FixedBitsetHelper<BIT_COUNT>::Ty;
     using Array = std::array<Ty, WORD_COUNT + 1>;
 
+    // The bulk operations go through the vector kernels at runtime when
+    // `fixed_bitset_simd_detail::USE_KERNELS<Ty, WORD_COUNT + 1>`. That choice is not a member of
+    // this class so that it stays tagged with the instruction set. Constant evaluation always uses
+    // the plain word loops.
+
     class Reference
     {  // proxy for an element
         friend Self;
@@ -315,6 +327,14 @@ public:
 
     [[nodiscard]] constexpr bool any() const noexcept
     {
+        if constexpr (fixed_bitset_simd_detail::USE_KERNELS<Ty, WORD_COUNT + 1>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return fixed_bitset_simd_detail::any(data().data(), WORD_COUNT + 1);
+            }
+        }
+
         for (std::size_t w_pos = 0; w_pos <= WORD_COUNT; ++w_pos)
         {
             if (data_at(w_pos) != 0)
@@ -337,6 +357,21 @@ public:
         }
 
         constexpr bool NO_PADDING = BIT_COUNT % BITS_PER_WORD == 0;
+        if constexpr (fixed_bitset_simd_detail::USE_KERNELS<Ty, WORD_COUNT + 1>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const std::size_t full_words = WORD_COUNT + static_cast<std::size_t>(NO_PADDING);
+                if (!fixed_bitset_simd_detail::all_ones(data().data(), full_words))
+                {
+                    return false;
+                }
+                return NO_PADDING ||
+                       data_at(WORD_COUNT) ==
+                           (static_cast<Ty>(1) << (BIT_COUNT % BITS_PER_WORD)) - 1;
+            }
+        }
+
         for (std::size_t w_pos = 0; w_pos < WORD_COUNT + static_cast<std::ptrdiff_t>(NO_PADDING);
              ++w_pos)
         {
@@ -352,6 +387,14 @@ public:
 
     [[nodiscard]] constexpr std::size_t count() const noexcept
     {  // count number of set bits
+        if constexpr (fixed_bitset_simd_detail::USE_KERNELS<Ty, WORD_COUNT + 1>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return fixed_bitset_simd_detail::count(data().data(), WORD_COUNT + 1);
+            }
+        }
+
         std::size_t result = 0;
         for (std::size_t w_pos = 0; w_pos <= WORD_COUNT; ++w_pos)
         {
@@ -362,8 +405,102 @@ public:
 
     [[nodiscard]] constexpr std::size_t size() const noexcept { return BIT_COUNT; }
 
+    // Set-bit scanning. These skip whole words at a time and return `size()` when there is no
+    // such bit.
+    [[nodiscard]] constexpr std::size_t find_first() const noexcept { return find_from(0); }
+
+    // First set bit strictly after `pos`.
+    [[nodiscard]] constexpr std::size_t find_next(std::size_t pos) const noexcept
+    {
+        if (pos + 1 >= BIT_COUNT)
+        {
+            return BIT_COUNT;
+        }
+        return find_from(pos + 1);
+    }
+
+    [[nodiscard]] constexpr std::size_t find_last() const noexcept { return find_prev(BIT_COUNT); }
+
+    // Last set bit strictly before `pos`.
+    [[nodiscard]] constexpr std::size_t find_prev(std::size_t pos) const noexcept
+    {
+        const std::size_t end = (std::min)(pos, BIT_COUNT);
+        if (end == 0)
+        {
+            return BIT_COUNT;
+        }
+
+        const std::size_t last = end - 1;
+        std::size_t w_pos = last / BITS_PER_WORD;
+        Ty word = get_word(w_pos) & (~Ty{0} >> (BITS_PER_WORD - 1 - last % BITS_PER_WORD));
+        while (true)
+        {
+            if (word != 0)
+            {
+                return (w_pos * BITS_PER_WORD) + BITS_PER_WORD - 1 -
+                       static_cast<std::size_t>(std::countl_zero(word));
+            }
+            if (w_pos == 0)
+            {
+                return BIT_COUNT;
+            }
+            --w_pos;
+            word = get_word(w_pos);
+        }
+    }
+
+    // Number of set bits strictly before `pos`.
+    [[nodiscard]] constexpr std::size_t rank(std::size_t pos) const noexcept
+    {
+        const std::size_t end = (std::min)(pos, BIT_COUNT);
+        const std::size_t full_words = end / BITS_PER_WORD;
+        std::size_t result = 0;
+        for (std::size_t w_pos = 0; w_pos < full_words; ++w_pos)
+        {
+            result += static_cast<std::size_t>(std::popcount(data_at(w_pos)));
+        }
+        if (end % BITS_PER_WORD != 0)
+        {
+            const Ty below_end = (Ty{1} << (end % BITS_PER_WORD)) - 1;
+            result += static_cast<std::size_t>(std::popcount(data_at(full_words) & below_end));
+        }
+        return result;
+    }
+
+    // Number of set bits before `pos` in the word holding it. Lets callers that keep their own
+    // per-word running counts compute `rank()` without going over the preceding words.
+    [[nodiscard]] constexpr std::size_t rank_within_word(std::size_t pos) const noexcept
+    {
+        assert_or_abort(pos < BIT_COUNT);
+        const Ty below_pos = (Ty{1} << (pos % BITS_PER_WORD)) - 1;
+        return static_cast<std::size_t>(std::popcount(data_at(pos / BITS_PER_WORD) & below_pos));
+    }
+
+    // Invokes `func(index)` for every set bit, in increasing order.
+    template <typename Function>
+    constexpr void for_each_set_bit(Function func) const
+    {
+        for (std::size_t w_pos = 0; w_pos <= WORD_COUNT; ++w_pos)
+        {
+            for (Ty word = get_word(w_pos); word != 0; word &= word - 1)
+            {
+                func((w_pos * BITS_PER_WORD) + static_cast<std::size_t>(std::countr_zero(word)));
+            }
+        }
+    }
+
     constexpr Self& operator&=(const Self& right) noexcept
     {
+        if constexpr (fixed_bitset_simd_detail::USE_KERNELS<Ty, WORD_COUNT + 1>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                fixed_bitset_simd_detail::and_into(
+                    data().data(), right.data().data(), WORD_COUNT + 1);
+                return static_cast<Self&>(*this);
+            }
+        }
+
         for (std::size_t w_pos = 0; w_pos <= WORD_COUNT; ++w_pos)
         {
             data_at(w_pos) &= right.data_at(w_pos);
@@ -374,6 +511,16 @@ public:
 
     constexpr Self& operator|=(const Self& right) noexcept
     {
+        if constexpr (fixed_bitset_simd_detail::USE_KERNELS<Ty, WORD_COUNT + 1>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                fixed_bitset_simd_detail::or_into(
+                    data().data(), right.data().data(), WORD_COUNT + 1);
+                return static_cast<Self&>(*this);
+            }
+        }
+
         for (std::size_t w_pos = 0; w_pos <= WORD_COUNT; ++w_pos)
         {
             data_at(w_pos) |= right.data_at(w_pos);
@@ -384,6 +531,16 @@ public:
 
     constexpr Self& operator^=(const Self& right) noexcept
     {
+        if constexpr (fixed_bitset_simd_detail::USE_KERNELS<Ty, WORD_COUNT + 1>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                fixed_bitset_simd_detail::xor_into(
+                    data().data(), right.data().data(), WORD_COUNT + 1);
+                return static_cast<Self&>(*this);
+            }
+        }
+
         for (std::size_t w_pos = 0; w_pos <= WORD_COUNT; ++w_pos)
         {
             data_at(w_pos) ^= right.data_at(w_pos);
@@ -392,6 +549,70 @@ public:
         return static_cast<Self&>(*this);
     }
 
+    // `*this &= ~right`, without materializing `~right`.
+    constexpr Self& and_not(const Self& right) noexcept
+    {
+        if constexpr (fixed_bitset_simd_detail::USE_KERNELS<Ty, WORD_COUNT + 1>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                fixed_bitset_simd_detail::and_not_into(
+                    data().data(), right.data().data(), WORD_COUNT + 1);
+                return static_cast<Self&>(*this);
+            }
+        }
+
+        for (std::size_t w_pos = 0; w_pos <= WORD_COUNT; ++w_pos)
+        {
+            data_at(w_pos) &= ~right.data_at(w_pos);
+        }
+
+        return static_cast<Self&>(*this);
+    }
+
+    // `(*this & other).count()`, without materializing the intersection.
+    [[nodiscard]] constexpr std::size_t count_and(const Self& other) const noexcept
+    {
+        if constexpr (fixed_bitset_simd_detail::USE_KERNELS<Ty, WORD_COUNT + 1>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return fixed_bitset_simd_detail::count_and(
+                    data().data(), other.data().data(), WORD_COUNT + 1);
+            }
+        }
+
+        std::size_t result = 0;
+        for (std::size_t w_pos = 0; w_pos <= WORD_COUNT; ++w_pos)
+        {
+            const Ty word = data_at(w_pos) & other.data_at(w_pos);
+            result += static_cast<std::size_t>(std::popcount(word));
+        }
+        return result;
+    }
+
+    // `(*this & other).any()`, without materializing the intersection.
+    [[nodiscard]] constexpr bool any_and(const Self& other) const noexcept
+    {
+        if constexpr (fixed_bitset_simd_detail::USE_KERNELS<Ty, WORD_COUNT + 1>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return fixed_bitset_simd_detail::any_and(
+                    data().data(), other.data().data(), WORD_COUNT + 1);
+            }
+        }
+
+        for (std::size_t w_pos = 0; w_pos <= WORD_COUNT; ++w_pos)
+        {
+            if ((data_at(w_pos) & other.data_at(w_pos)) != 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
     constexpr Self operator&(const Self& other) const
     {
         Self result = static_cast<const Self&>(*this);
@@ -427,6 +648,16 @@ public:
         }
 
         pos %= BITS_PER_WORD;
+        if constexpr (fixed_bitset_simd_detail::USE_KERNELS<Ty, WORD_COUNT + 1>)
+        {
+            if (pos != 0 && !std::is_constant_evaluated())
+            {
+                fixed_bitset_simd_detail::shift_left_bits(data().data(), WORD_COUNT + 1, pos);
+                trim();
+                return static_cast<Self&>(*this);
+            }
+        }
+
         if (pos != 0)
         {  // 0 < pos < BITS_PER_WORD, shift by bits
             for (std::ptrdiff_t w_pos = WORD_COUNT; 0 < w_pos; --w_pos)
@@ -454,6 +685,15 @@ public:
         }
 
         pos %= BITS_PER_WORD;
+        if constexpr (fixed_bitset_simd_detail::USE_KERNELS<Ty, WORD_COUNT + 1>)
+        {
+            if (pos != 0 && !std::is_constant_evaluated())
+            {
+                fixed_bitset_simd_detail::shift_right_bits(data().data(), WORD_COUNT + 1, pos);
+                return static_cast<Self&>(*this);
+            }
+        }
+
         if (pos != 0)
         {  // 0 < pos < BITS_PER_WORD, shift by bits
             for (std::size_t w_pos = 0; w_pos < WORD_COUNT; ++w_pos)
@@ -658,6 +898,31 @@ public:
 private:
     [[nodiscard]] constexpr Ty get_word(std::size_t w_pos) const noexcept { return data_at(w_pos); }
 
+    [[nodiscard]] constexpr std::size_t find_from(std::size_t pos) const noexcept
+    {
+        if (pos >= BIT_COUNT)
+        {
+            return BIT_COUNT;
+        }
+
+        std::size_t w_pos = pos / BITS_PER_WORD;
+        Ty word = get_word(w_pos) & (~Ty{0} << (pos % BITS_PER_WORD));
+        while (true)
+        {
+            if (word != 0)
+            {
+                // Trailing bits are always clear, so this cannot go past BIT_COUNT
+                return (w_pos * BITS_PER_WORD) + static_cast<std::size_t>(std::countr_zero(word));
+            }
+            if (w_pos == WORD_COUNT)
+            {
+                return BIT_COUNT;
+            }
+            ++w_pos;
+            word = get_word(w_pos);
+        }
+    }
+
     [[nodiscard]] constexpr bool subscript_unchecked(std::size_t pos) const
     {
         return (data_at(pos / BITS_PER_WORD) & (Ty{1} << pos % BITS_PER_WORD)) != 0;
@@ -715,6 +980,61 @@ private:
 
 }  // namespace fixed_containers
 
+namespace fixed_containers::fixed_bitset_detail
+{
+// Entry provider over the indices of the set bits of a bitset, for use with
+// `BidirectionalIterator`. Same conventions as `FilteredIntegerRangeEntryProvider`: the end is
+// `size()` and the position before the first one is `-1` (wrapped around).
+template <typename BitsetType>
+class SetBitIndexProvider
+{
+private:
+    const BitsetType* bitset_;
+    std::size_t current_index_;
+
+public:
+    constexpr SetBitIndexProvider() noexcept
+      : SetBitIndexProvider{nullptr, 0}
+    {
+    }
+
+    constexpr SetBitIndexProvider(const BitsetType* bitset,
+                                  const std::size_t current_index) noexcept
+      : bitset_{bitset}
+      , current_index_{current_index}
+    {
+        if (bitset_ != nullptr && current_index_ < bitset_->size() &&
+            !bitset_->test(current_index_))
+        {
+            advance();
+        }
+    }
+
+    constexpr void advance() noexcept
+    {
+        assert_or_abort(current_index_ != bitset_->size());
+        // From the position before the first one, this wraps around to search from 0.
+        current_index_ = current_index_ == static_cast<std::size_t>(-1)
+                             ? bitset_->find_first()
+                             : bitset_->find_next(current_index_);
+    }
+    constexpr void recede() noexcept
+    {
+        assert_or_abort(current_index_ != static_cast<std::size_t>(-1));
+        const std::size_t previous = bitset_->find_prev(current_index_);
+        current_index_ = previous == bitset_->size() ? static_cast<std::size_t>(-1) : previous;
+    }
+
+    [[nodiscard]] constexpr const std::size_t& get() const noexcept
+    {
+        assert_or_abort(current_index_ < bitset_->size());
+        return current_index_;
+    }
+
+    constexpr bool operator==(const SetBitIndexProvider& other) const noexcept = default;
+};
+}  // namespace fixed_containers::fixed_bitset_detail
+
 template <std::size_t BIT_COUNT, typename Checking, typename Derived>
 struct std::hash<fixed_containers::FixedBitset<BIT_COUNT, Checking, Derived>>
 {
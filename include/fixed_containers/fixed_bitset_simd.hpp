@@ -0,0 +1,417 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__AVX512F__) && defined(__AVX512VPOPCNTDQ__)
+#define FIXED_CONTAINERS_BITSET_SIMD_AVX512 1
+#include <immintrin.h>
+#elif defined(__AVX2__)
+#define FIXED_CONTAINERS_BITSET_SIMD_AVX2 1
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define FIXED_CONTAINERS_BITSET_SIMD_NEON 1
+#include <arm_neon.h>
+#else
+#define FIXED_CONTAINERS_BITSET_SIMD_NONE 1
+#endif
+
+// Bulk word kernels for large FixedBitsets. The instruction set is selected at compile-time from
+// the target flags (e.g. `-mavx2`, `-march=native`). Without any of them, the kernels are built
+// on plain words and `ENABLED` is false, so FixedBitset keeps its own loops. The kernels are not
+// constexpr, so FixedBitset only uses them outside of constant evaluation.
+//
+// Translation units built with different flags get different kernels. Everything that depends on
+// the instruction set, down to the `USE_KERNELS` choice made by FixedBitset, is in an inline
+// namespace named after it, so these are distinct entities: the linker can't merge the AVX-512
+// kernels of one translation unit into another that was built for a plainer CPU.
+namespace fixed_containers::fixed_bitset_simd_detail
+{
+#if defined(FIXED_CONTAINERS_BITSET_SIMD_AVX512)
+inline namespace isa_avx512
+{
+#elif defined(FIXED_CONTAINERS_BITSET_SIMD_AVX2)
+inline namespace isa_avx2
+{
+#elif defined(FIXED_CONTAINERS_BITSET_SIMD_NEON)
+inline namespace isa_neon
+{
+#else
+inline namespace isa_none
+{
+#endif
+using Word = std::uint64_t;
+inline constexpr std::size_t BITS_PER_WORD = 64;
+
+#if defined(FIXED_CONTAINERS_BITSET_SIMD_AVX512)
+struct Isa
+{
+    using Reg = __m512i;
+    static constexpr std::size_t WORDS_PER_REG = 8;
+
+    static Reg load(const Word* ptr) { return _mm512_loadu_si512(ptr); }
+    static void store(Word* ptr, Reg reg) { _mm512_storeu_si512(ptr, reg); }
+    static Reg zero() { return _mm512_setzero_si512(); }
+    static Reg ones() { return _mm512_set1_epi64(-1); }
+    static Reg bit_and(Reg lhs, Reg rhs) { return _mm512_and_si512(lhs, rhs); }
+    static Reg bit_or(Reg lhs, Reg rhs) { return _mm512_or_si512(lhs, rhs); }
+    static Reg bit_xor(Reg lhs, Reg rhs) { return _mm512_xor_si512(lhs, rhs); }
+    // The zero-masked forms are used below because the unmasked ones trip -Wmaybe-uninitialized
+    // inside the gcc headers.
+    static constexpr __mmask8 ALL_LANES = 0xFF;
+    // lhs & ~rhs
+    static Reg and_not(Reg lhs, Reg rhs) { return _mm512_maskz_andnot_epi64(ALL_LANES, rhs, lhs); }
+    static Reg shift_left(Reg reg, std::size_t count)
+    {
+        const __m128i shift = _mm_cvtsi64_si128(static_cast<long long>(count));
+        return _mm512_maskz_sll_epi64(ALL_LANES, reg, shift);
+    }
+    static Reg shift_right(Reg reg, std::size_t count)
+    {
+        const __m128i shift = _mm_cvtsi64_si128(static_cast<long long>(count));
+        return _mm512_maskz_srl_epi64(ALL_LANES, reg, shift);
+    }
+    static bool is_zero(Reg reg) { return _mm512_test_epi64_mask(reg, reg) == 0; }
+    static Reg popcount_accumulate(Reg acc, Reg reg)
+    {
+        return _mm512_add_epi64(acc, _mm512_popcnt_epi64(reg));
+    }
+    static std::size_t horizontal_sum(Reg acc)
+    {
+        // `_mm512_reduce_add_epi64()` trips -Wuninitialized inside the gcc headers too.
+        std::array<Word, WORDS_PER_REG> lanes{};
+        store(lanes.data(), acc);
+        std::size_t result = 0;
+        for (const Word lane : lanes)
+        {
+            result += static_cast<std::size_t>(lane);
+        }
+        return result;
+    }
+};
+#elif defined(FIXED_CONTAINERS_BITSET_SIMD_AVX2)
+struct Isa
+{
+    using Reg = __m256i;
+    static constexpr std::size_t WORDS_PER_REG = 4;
+
+    static Reg load(const Word* ptr)
+    {
+        return _mm256_loadu_si256(static_cast<const __m256i*>(static_cast<const void*>(ptr)));
+    }
+    static void store(Word* ptr, Reg reg)
+    {
+        _mm256_storeu_si256(static_cast<__m256i*>(static_cast<void*>(ptr)), reg);
+    }
+    static Reg zero() { return _mm256_setzero_si256(); }
+    static Reg ones() { return _mm256_set1_epi64x(-1); }
+    static Reg bit_and(Reg lhs, Reg rhs) { return _mm256_and_si256(lhs, rhs); }
+    static Reg bit_or(Reg lhs, Reg rhs) { return _mm256_or_si256(lhs, rhs); }
+    static Reg bit_xor(Reg lhs, Reg rhs) { return _mm256_xor_si256(lhs, rhs); }
+    // lhs & ~rhs
+    static Reg and_not(Reg lhs, Reg rhs) { return _mm256_andnot_si256(rhs, lhs); }
+    static Reg shift_left(Reg reg, std::size_t count)
+    {
+        return _mm256_sll_epi64(reg, _mm_cvtsi64_si128(static_cast<long long>(count)));
+    }
+    static Reg shift_right(Reg reg, std::size_t count)
+    {
+        return _mm256_srl_epi64(reg, _mm_cvtsi64_si128(static_cast<long long>(count)));
+    }
+    static bool is_zero(Reg reg) { return _mm256_testz_si256(reg, reg) != 0; }
+    // Nibble lookup-table popcount (Mula et al.), summed per 64-bit lane with `vpsadbw`.
+    static Reg popcount_accumulate(Reg acc, Reg reg)
+    {
+        const Reg lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const Reg low_mask = _mm256_set1_epi8(0x0f);
+        const Reg low = _mm256_and_si256(reg, low_mask);
+        const Reg high = _mm256_and_si256(_mm256_srli_epi16(reg, 4), low_mask);
+        const Reg counts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, low),
+                                           _mm256_shuffle_epi8(lookup, high));
+        return _mm256_add_epi64(acc, _mm256_sad_epu8(counts, _mm256_setzero_si256()));
+    }
+    static std::size_t horizontal_sum(Reg acc)
+    {
+        const __m128i sum =
+            _mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+        return static_cast<std::size_t>(_mm_cvtsi128_si64(sum)) +
+               static_cast<std::size_t>(_mm_extract_epi64(sum, 1));
+    }
+};
+#elif defined(FIXED_CONTAINERS_BITSET_SIMD_NEON)
+struct Isa
+{
+    using Reg = uint64x2_t;
+    static constexpr std::size_t WORDS_PER_REG = 2;
+
+    static Reg load(const Word* ptr) { return vld1q_u64(ptr); }
+    static void store(Word* ptr, Reg reg) { vst1q_u64(ptr, reg); }
+    static Reg zero() { return vdupq_n_u64(0); }
+    static Reg ones() { return vdupq_n_u64(~Word{0}); }
+    static Reg bit_and(Reg lhs, Reg rhs) { return vandq_u64(lhs, rhs); }
+    static Reg bit_or(Reg lhs, Reg rhs) { return vorrq_u64(lhs, rhs); }
+    static Reg bit_xor(Reg lhs, Reg rhs) { return veorq_u64(lhs, rhs); }
+    // lhs & ~rhs
+    static Reg and_not(Reg lhs, Reg rhs) { return vbicq_u64(lhs, rhs); }
+    static Reg shift_left(Reg reg, std::size_t count)
+    {
+        return vshlq_u64(reg, vdupq_n_s64(static_cast<std::int64_t>(count)));
+    }
+    static Reg shift_right(Reg reg, std::size_t count)
+    {
+        return vshlq_u64(reg, vdupq_n_s64(-static_cast<std::int64_t>(count)));
+    }
+    static bool is_zero(Reg reg) { return vmaxvq_u32(vreinterpretq_u32_u64(reg)) == 0; }
+    static Reg popcount_accumulate(Reg acc, Reg reg)
+    {
+        const uint8x16_t counts = vcntq_u8(vreinterpretq_u8_u64(reg));
+        return vaddq_u64(acc, vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(counts))));
+    }
+    static std::size_t horizontal_sum(Reg acc)
+    {
+        return static_cast<std::size_t>(vgetq_lane_u64(acc, 0) + vgetq_lane_u64(acc, 1));
+    }
+};
+#else
+struct Isa
+{
+    using Reg = Word;
+    static constexpr std::size_t WORDS_PER_REG = 1;
+
+    static Reg load(const Word* ptr) { return *ptr; }
+    static void store(Word* ptr, Reg reg) { *ptr = reg; }
+    static Reg zero() { return 0; }
+    static Reg ones() { return ~Word{0}; }
+    static Reg bit_and(Reg lhs, Reg rhs) { return lhs & rhs; }
+    static Reg bit_or(Reg lhs, Reg rhs) { return lhs | rhs; }
+    static Reg bit_xor(Reg lhs, Reg rhs) { return lhs ^ rhs; }
+    static Reg and_not(Reg lhs, Reg rhs) { return lhs & ~rhs; }
+    static Reg shift_left(Reg reg, std::size_t count) { return reg << count; }
+    static Reg shift_right(Reg reg, std::size_t count) { return reg >> count; }
+    static bool is_zero(Reg reg) { return reg == 0; }
+    static Reg popcount_accumulate(Reg acc, Reg reg)
+    {
+        return acc + static_cast<Reg>(std::popcount(reg));
+    }
+    static std::size_t horizontal_sum(Reg acc) { return static_cast<std::size_t>(acc); }
+};
+#endif
+
+#if defined(FIXED_CONTAINERS_BITSET_SIMD_NONE)
+inline constexpr bool ENABLED = false;
+#else
+inline constexpr bool ENABLED = true;
+#endif
+
+// Below this, the plain loops are just as fast (and fully unrolled by the compiler).
+inline constexpr std::size_t MIN_WORD_COUNT = 4 * Isa::WORDS_PER_REG;
+
+inline constexpr std::size_t WORDS_PER_REG = Isa::WORDS_PER_REG;
+
+// Whether a FixedBitset with `WORD_COUNT` words of type `WordType` uses the kernels at runtime
+template <typename WordType, std::size_t WORD_COUNT>
+inline constexpr bool USE_KERNELS =
+    ENABLED && std::is_same_v<WordType, Word> && WORD_COUNT >= MIN_WORD_COUNT;
+
+// The number of leading words that are covered by whole vector registers.
+constexpr std::size_t vector_word_count(std::size_t word_count)
+{
+    return word_count - (word_count % WORDS_PER_REG);
+}
+
+// Applies `vector_op`/`scalar_op` to `dst[i], src[i]` and stores the result in `dst[i]`.
+template <typename VectorOp, typename ScalarOp>
+inline void transform_into(Word* dst,
+                           const Word* src,
+                           std::size_t word_count,
+                           VectorOp vector_op,
+                           ScalarOp scalar_op)
+{
+    std::size_t i = 0;
+    for (const std::size_t vector_end = vector_word_count(word_count); i < vector_end;
+         i += WORDS_PER_REG)
+    {
+        Isa::store(dst + i, vector_op(Isa::load(dst + i), Isa::load(src + i)));
+    }
+    for (; i < word_count; ++i)
+    {
+        dst[i] = scalar_op(dst[i], src[i]);
+    }
+}
+
+inline void and_into(Word* dst, const Word* src, std::size_t word_count)
+{
+    transform_into(
+        dst, src, word_count, Isa::bit_and, [](Word lhs, Word rhs) { return lhs & rhs; });
+}
+inline void or_into(Word* dst, const Word* src, std::size_t word_count)
+{
+    transform_into(
+        dst, src, word_count, Isa::bit_or, [](Word lhs, Word rhs) { return lhs | rhs; });
+}
+inline void xor_into(Word* dst, const Word* src, std::size_t word_count)
+{
+    transform_into(
+        dst, src, word_count, Isa::bit_xor, [](Word lhs, Word rhs) { return lhs ^ rhs; });
+}
+inline void and_not_into(Word* dst, const Word* src, std::size_t word_count)
+{
+    transform_into(
+        dst, src, word_count, Isa::and_not, [](Word lhs, Word rhs) { return lhs & ~rhs; });
+}
+
+inline std::size_t count(const Word* src, std::size_t word_count)
+{
+    typename Isa::Reg acc = Isa::zero();
+    std::size_t i = 0;
+    for (const std::size_t vector_end = vector_word_count(word_count); i < vector_end;
+         i += WORDS_PER_REG)
+    {
+        acc = Isa::popcount_accumulate(acc, Isa::load(src + i));
+    }
+    std::size_t result = Isa::horizontal_sum(acc);
+    for (; i < word_count; ++i)
+    {
+        result += static_cast<std::size_t>(std::popcount(src[i]));
+    }
+    return result;
+}
+
+inline std::size_t count_and(const Word* lhs, const Word* rhs, std::size_t word_count)
+{
+    typename Isa::Reg acc = Isa::zero();
+    std::size_t i = 0;
+    for (const std::size_t vector_end = vector_word_count(word_count); i < vector_end;
+         i += WORDS_PER_REG)
+    {
+        acc = Isa::popcount_accumulate(acc, Isa::bit_and(Isa::load(lhs + i), Isa::load(rhs + i)));
+    }
+    std::size_t result = Isa::horizontal_sum(acc);
+    for (; i < word_count; ++i)
+    {
+        result += static_cast<std::size_t>(std::popcount(lhs[i] & rhs[i]));
+    }
+    return result;
+}
+
+inline bool any(const Word* src, std::size_t word_count)
+{
+    std::size_t i = 0;
+    for (const std::size_t vector_end = vector_word_count(word_count); i < vector_end;
+         i += WORDS_PER_REG)
+    {
+        if (!Isa::is_zero(Isa::load(src + i)))
+        {
+            return true;
+        }
+    }
+    for (; i < word_count; ++i)
+    {
+        if (src[i] != 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+inline bool any_and(const Word* lhs, const Word* rhs, std::size_t word_count)
+{
+    std::size_t i = 0;
+    for (const std::size_t vector_end = vector_word_count(word_count); i < vector_end;
+         i += WORDS_PER_REG)
+    {
+        if (!Isa::is_zero(Isa::bit_and(Isa::load(lhs + i), Isa::load(rhs + i))))
+        {
+            return true;
+        }
+    }
+    for (; i < word_count; ++i)
+    {
+        if ((lhs[i] & rhs[i]) != 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Whether all of the `word_count` words have all of their bits set.
+inline bool all_ones(const Word* src, std::size_t word_count)
+{
+    const typename Isa::Reg ones = Isa::ones();
+    std::size_t i = 0;
+    for (const std::size_t vector_end = vector_word_count(word_count); i < vector_end;
+         i += WORDS_PER_REG)
+    {
+        if (!Isa::is_zero(Isa::and_not(ones, Isa::load(src + i))))
+        {
+            return false;
+        }
+    }
+    for (; i < word_count; ++i)
+    {
+        if (src[i] != ~Word{0})
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// In-place `words <<= bit_shift` across the word array, for `0 < bit_shift < 64`.
+inline void shift_left_bits(Word* words, std::size_t word_count, std::size_t bit_shift)
+{
+    const std::size_t carry_shift = BITS_PER_WORD - bit_shift;
+    // Going downwards, a block only reads the word below it, which has not been written yet.
+    std::size_t end = word_count;
+    for (; end >= WORDS_PER_REG + 1; end -= WORDS_PER_REG)
+    {
+        const std::size_t base = end - WORDS_PER_REG;
+        const typename Isa::Reg current = Isa::load(words + base);
+        const typename Isa::Reg below = Isa::load(words + base - 1);
+        Isa::store(words + base,
+                   Isa::bit_or(Isa::shift_left(current, bit_shift),
+                               Isa::shift_right(below, carry_shift)));
+    }
+    for (std::size_t i = end; i-- > 1;)
+    {
+        words[i] = (words[i] << bit_shift) | (words[i - 1] >> carry_shift);
+    }
+    if (end >= 1)
+    {
+        words[0] <<= bit_shift;
+    }
+}
+
+// In-place `words >>= bit_shift` across the word array, for `0 < bit_shift < 64`.
+inline void shift_right_bits(Word* words, std::size_t word_count, std::size_t bit_shift)
+{
+    const std::size_t carry_shift = BITS_PER_WORD - bit_shift;
+    // Going upwards, a block only reads the word above it, which has not been written yet.
+    // The last word has nothing above it, so it is left to the scalar tail.
+    const std::size_t vector_end = word_count == 0 ? 0 : vector_word_count(word_count - 1);
+    std::size_t i = 0;
+    for (; i < vector_end; i += WORDS_PER_REG)
+    {
+        const typename Isa::Reg current = Isa::load(words + i);
+        const typename Isa::Reg above = Isa::load(words + i + 1);
+        Isa::store(words + i,
+                   Isa::bit_or(Isa::shift_right(current, bit_shift),
+                               Isa::shift_left(above, carry_shift)));
+    }
+    for (; i + 1 < word_count; ++i)
+    {
+        words[i] = (words[i] >> bit_shift) | (words[i + 1] << carry_shift);
+    }
+    if (word_count != 0)
+    {
+        words[word_count - 1] >>= bit_shift;
+    }
+}
+}  // namespace isa_avx512/isa_avx2/isa_neon/isa_none
+}  // namespace fixed_containers::fixed_bitset_simd_detail
@@ -0,0 +1,212 @@
+#pragma once
+
+#include "fixed_containers/fixed_bitset.hpp"
+#include "fixed_containers/no_unique_address.hpp"
+#include "fixed_containers/wyhash.hpp"
+
+#include <bit>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity Bloom filter, stored in a `FixedBitset<BIT_COUNT>`. Properties:
+ *  - constexpr
+ *  - blocked: every key maps to a single 512-bit block (one cache line), and all of its
+ *    `HASH_COUNT` probes land in that block, so a lookup touches one cache line. The bitset is
+ *    aligned to the cache line size so that blocks don't straddle two lines
+ *  - hashes each key once with `Hash` and derives the probes by double hashing
+ *  - no false negatives; the false-positive rate is reported by `estimated_false_positive_rate()`
+ *  - trivially copyable, and a structural type (if `Hash` is)
+ *  - no pointers stored (data layout doesn't use pointers)
+ *  - no dynamic allocations
+ *
+ * Blocking costs a little accuracy compared to a classic Bloom filter of the same size, as
+ * blocks fill up unevenly. `HASH_COUNT` of 6-8 is a good choice for ~10 bits per key.
+ */
+template <typename K, std::size_t BIT_COUNT, std::size_t HASH_COUNT, class Hash = wyhash::hash<K>>
+class FixedBloomFilter
+{
+public:
+    using key_type = K;
+    using hasher = Hash;
+
+    // Not using `std::hardware_destructive_interference_size`, as its value is not ABI-stable
+    // and some compilers warn when it is used in headers.
+    static constexpr std::size_t CACHE_LINE_SIZE = 64;
+    static constexpr std::size_t BLOCK_BIT_COUNT = CACHE_LINE_SIZE * CHAR_BIT;
+    static constexpr std::size_t BLOCK_COUNT = BIT_COUNT / BLOCK_BIT_COUNT;
+
+    static_assert(BIT_COUNT > 0 && BIT_COUNT % BLOCK_BIT_COUNT == 0,
+                  "BIT_COUNT must be a non-zero multiple of the block size (512 bits)");
+    static_assert(HASH_COUNT > 0, "At least one hash function is required");
+    static_assert(BLOCK_COUNT <= (std::size_t{1} << 32U));
+
+private:
+    using BitsetType = FixedBitset<BIT_COUNT>;
+    using Helper = fixed_bitset_detail::FixedBitsetHelper<BIT_COUNT>;
+    using Word = typename Helper::Ty;
+    static constexpr std::size_t BITS_PER_WORD = Helper::BITS_PER_WORD;
+    static constexpr std::size_t WORDS_PER_BLOCK = BLOCK_BIT_COUNT / BITS_PER_WORD;
+
+    struct Probe
+    {
+        std::size_t first_word;
+        std::uint32_t start;
+        std::uint32_t step;
+    };
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    alignas(CACHE_LINE_SIZE) BitsetType IMPLEMENTATION_DETAIL_DO_NOT_USE_bits_{};
+    // After the bits, so it doesn't shift the blocks off the cache lines. Stateless hashers take
+    // no space.
+    FIXED_CONTAINERS_NO_UNIQUE_ADDRESS Hash IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_{};
+
+public:
+    constexpr FixedBloomFilter() noexcept = default;
+    explicit constexpr FixedBloomFilter(const Hash& hash) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_{hash}
+    {
+    }
+
+    template <typename InputIt>
+    constexpr FixedBloomFilter(InputIt first, InputIt last, const Hash& hash = Hash())
+      : FixedBloomFilter(hash)
+    {
+        insert(first, last);
+    }
+
+    [[nodiscard]] static constexpr std::size_t bit_count() noexcept { return BIT_COUNT; }
+    [[nodiscard]] static constexpr std::size_t hash_count() noexcept { return HASH_COUNT; }
+    [[nodiscard]] static constexpr std::size_t block_count() noexcept { return BLOCK_COUNT; }
+
+    [[nodiscard]] constexpr hasher hash_function() const { return hash(); }
+
+    // Returns whether any bit changed, i.e. whether `key` was definitely not present before.
+    constexpr bool insert(const K& key) noexcept
+    {
+        const Probe probe = probe_for(key);
+        bool changed = false;
+        for (std::size_t i = 0; i < HASH_COUNT; i++)
+        {
+            Word& word = word_at(probe, i);
+            const Word mask = mask_at(probe, i);
+            changed = changed || (word & mask) == 0;
+            word |= mask;
+        }
+        return changed;
+    }
+    template <typename InputIt>
+    constexpr void insert(InputIt first, InputIt last) noexcept
+    {
+        for (; first != last; std::advance(first, 1))
+        {
+            insert(*first);
+        }
+    }
+
+    // `false` means `key` was never inserted; `true` means it probably was.
+    [[nodiscard]] constexpr bool contains(const K& key) const noexcept
+    {
+        const Probe probe = probe_for(key);
+        for (std::size_t i = 0; i < HASH_COUNT; i++)
+        {
+            if ((word_at(probe, i) & mask_at(probe, i)) == 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    constexpr void clear() noexcept { bits().reset(); }
+
+    // Union: the result contains every key inserted in either filter.
+    // Both filters must use equivalent hashers.
+    constexpr FixedBloomFilter& operator|=(const FixedBloomFilter& other) noexcept
+    {
+        bits() |= other.bits();
+        return *this;
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept { return bits().none(); }
+    [[nodiscard]] constexpr std::size_t count_set_bits() const noexcept { return bits().count(); }
+
+    // Probability that `contains()` returns true for a key that was not inserted, given the current
+    // occupancy of each block.
+    [[nodiscard]] constexpr double estimated_false_positive_rate() const noexcept
+    {
+        const auto& data = bits().IMPLEMENTATION_DETAIL_DO_NOT_USE_data_;
+        double sum = 0.0;
+        for (std::size_t block = 0; block < BLOCK_COUNT; block++)
+        {
+            std::size_t set_bits = 0;
+            for (std::size_t w = 0; w < WORDS_PER_BLOCK; w++)
+            {
+                set_bits += static_cast<std::size_t>(
+                    std::popcount(data[(block * WORDS_PER_BLOCK) + w]));
+            }
+            const double fill =
+                static_cast<double>(set_bits) / static_cast<double>(BLOCK_BIT_COUNT);
+            double block_rate = 1.0;
+            for (std::size_t i = 0; i < HASH_COUNT; i++)
+            {
+                block_rate *= fill;
+            }
+            sum += block_rate;
+        }
+        return sum / static_cast<double>(BLOCK_COUNT);
+    }
+
+    [[nodiscard]] constexpr const BitsetType& bitset() const noexcept { return bits(); }
+
+private:
+    [[nodiscard]] constexpr const Hash& hash() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_;
+    }
+    [[nodiscard]] constexpr BitsetType& bits() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_bits_; }
+    [[nodiscard]] constexpr const BitsetType& bits() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_bits_;
+    }
+
+    [[nodiscard]] constexpr Probe probe_for(const K& key) const
+    {
+        const auto hash_value = static_cast<std::uint64_t>(hash()(key));
+        // The high half picks the block, via multiply-shift instead of a modulo.
+        const std::uint64_t block = ((hash_value >> 32U) * BLOCK_COUNT) >> 32U;
+        // The low half is the first probe. The step is re-mixed so it is independent from the
+        // block, and odd so that successive probes don't repeat within the block.
+        const auto step = static_cast<std::uint32_t>(wyhash_detail::hash(hash_value)) | 1U;
+        return {static_cast<std::size_t>(block) * WORDS_PER_BLOCK,
+                static_cast<std::uint32_t>(hash_value),
+                step};
+    }
+
+    [[nodiscard]] static constexpr std::size_t bit_in_block(const Probe& probe, std::size_t i)
+    {
+        return (probe.start + (static_cast<std::uint32_t>(i) * probe.step)) % BLOCK_BIT_COUNT;
+    }
+    [[nodiscard]] constexpr Word& word_at(const Probe& probe, std::size_t i)
+    {
+        return bits().IMPLEMENTATION_DETAIL_DO_NOT_USE_data_[probe.first_word +
+                                                             (bit_in_block(probe, i) /
+                                                              BITS_PER_WORD)];
+    }
+    [[nodiscard]] constexpr const Word& word_at(const Probe& probe, std::size_t i) const
+    {
+        return bits().IMPLEMENTATION_DETAIL_DO_NOT_USE_data_[probe.first_word +
+                                                             (bit_in_block(probe, i) /
+                                                              BITS_PER_WORD)];
+    }
+    [[nodiscard]] static constexpr Word mask_at(const Probe& probe, std::size_t i)
+    {
+        return Word{1} << (bit_in_block(probe, i) % BITS_PER_WORD);
+    }
+};
+
+}  // namespace fixed_containers
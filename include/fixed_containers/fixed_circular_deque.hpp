@@ -10,6 +10,7 @@
 #include <cstddef>
 #include <initializer_list>
 #include <iterator>
+#include <span>
 #include <utility>
 
 namespace fixed_containers
@@ -348,6 +349,51 @@ public:
         return deque().back(loc);
     }
 
+    /**
+     * Returns the (at most two) contiguous segments that hold the elements, in order. The second
+     * segment is empty, unless the elements wrap around the end of the underlying storage.
+     */
+    [[nodiscard]] constexpr std::array<std::span<T>, 2> as_spans() noexcept
+    {
+        return deque().as_spans();
+    }
+    [[nodiscard]] constexpr std::array<std::span<const T>, 2> as_spans() const noexcept
+    {
+        return deque().as_spans();
+    }
+
+    /**
+     * Appends all `values` at the back, dropping elements from the front to make space, as
+     * `push_back()` does. If there are more `values` than the capacity, only the last ones are
+     * retained.
+     */
+    constexpr void push_back_n(
+        std::span<const T> values,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        if (values.size() > MAXIMUM_SIZE)
+        {
+            values = values.last(MAXIMUM_SIZE);
+        }
+        const std::size_t excess_entry_count =
+            (std::max)(size() + values.size(), MAXIMUM_SIZE) - MAXIMUM_SIZE;
+        deque().pop_front_n(excess_entry_count, loc);
+        deque().push_back_n(values, loc);
+    }
+
+    constexpr void pop_front_n(
+        size_type count,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        deque().pop_front_n(count, loc);
+    }
+
+    /**
+     * Rotates the elements in-place so that they are contiguous and returns them as a single span.
+     * Invalidates all iterators and spans.
+     */
+    constexpr std::span<T> linearize() noexcept { return deque().linearize(); }
+
 private:
     template <InputIterator InputIt>
     constexpr iterator insert_internal(std::forward_iterator_tag /*unused*/,
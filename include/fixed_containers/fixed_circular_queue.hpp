@@ -6,6 +6,10 @@
 #include "fixed_containers/sequence_container_checking.hpp"
 #include "fixed_containers/source_location.hpp"
 
+#include <array>
+#include <cstddef>
+#include <span>
+
 namespace fixed_containers
 {
 template <typename T,
@@ -34,6 +38,37 @@ public:
       : Base{first, last, loc}
     {
     }
+
+    /**
+     * Returns the (at most two) contiguous segments that hold the elements, from front to back.
+     */
+    [[nodiscard]] constexpr std::array<std::span<T>, 2> as_spans() noexcept
+    {
+        return this->IMPLEMENTATION_DETAIL_DO_NOT_USE_data_.as_spans();
+    }
+    [[nodiscard]] constexpr std::array<std::span<const T>, 2> as_spans() const noexcept
+    {
+        return this->IMPLEMENTATION_DETAIL_DO_NOT_USE_data_.as_spans();
+    }
+
+    constexpr void push_n(
+        std::span<const T> values,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_data_.push_back_n(values, loc);
+    }
+
+    constexpr void pop_n(
+        std::size_t count,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_data_.pop_front_n(count, loc);
+    }
+
+    constexpr std::span<T> linearize() noexcept
+    {
+        return this->IMPLEMENTATION_DETAIL_DO_NOT_USE_data_.linearize();
+    }
 };
 
 template <typename T, std::size_t MAXIMUM_SIZE, typename CheckingType>
@@ -0,0 +1,994 @@
+#pragma once
+
+#include "fixed_containers/checking_hooks.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace fixed_containers::fixed_compressed_bitset_detail
+{
+// Bits are grouped in chunks of 2^16, each stored in the cheapest container for its contents.
+inline constexpr std::size_t CHUNK_BITS = std::size_t{1} << 16;
+inline constexpr std::size_t BITMAP_WORD_COUNT = CHUNK_BITS / 64;
+// A bitmap container takes as much memory as an array container with this many values.
+inline constexpr std::size_t MAXIMUM_ARRAY_CARDINALITY = 4096;
+
+enum class ContainerKind : std::uint8_t
+{
+    EMPTY,
+    // Sorted values, in the value pool
+    ARRAY,
+    // One of the bitmap slots
+    BITMAP,
+    // Sorted `(start, length - 1)` pairs, in the value pool
+    RUN,
+};
+
+struct ChunkHeader
+{
+    // Position of the values of this chunk in the value pool. Kept up to date for every chunk, so
+    // that a chunk becoming an array knows where its values go.
+    std::uint32_t offset{};
+    // Count of values used in the value pool: one per bit for arrays, two per run for runs.
+    std::uint32_t length{};
+    std::uint32_t cardinality{};
+    std::uint16_t bitmap_slot{};
+    ContainerKind kind{ContainerKind::EMPTY};
+};
+
+using BitmapWords = std::array<std::uint64_t, BITMAP_WORD_COUNT>;
+
+enum class BinaryOperation
+{
+    OR,
+    AND,
+    AND_NOT,
+};
+}  // namespace fixed_containers::fixed_compressed_bitset_detail
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity compressed bitset, in the style of Roaring bitmaps, for large and sparse sets
+ * of indices. Bits are grouped in chunks of 2^16, and each chunk picks its container:
+ *  - array: the sorted indices of the set bits, taken from a pool of `MAXIMUM_ARRAY_VALUES`
+ *    16-bit values shared by all chunks
+ *  - bitmap: one of `MAXIMUM_BITMAP_CONTAINERS` slots of 8 KiB, used when a chunk holds more than
+ *    4096 bits (or the value pool is full) and a slot is free
+ *  - run: `(start, length)` pairs in the value pool, produced by `run_optimize()`
+ *
+ * Properties:
+ *  - constexpr
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations; running out of pool space is reported with `length_error`
+ *  - `count()`, `any()` and `none()` only read the cached cardinality of each chunk
+ *  - a `FixedBitset`-compatible subset of the API: `test()`, `set()`, `reset()`, `count()`,
+ *    `find_first()`, `find_next()`, `for_each_set_bit()`, `|=`, `&=`, `and_not()`, `==`
+ *
+ * The values of all the chunks are stored contiguously in chunk order, so adding a value to an
+ * array shifts the values of the chunks after it. Modifying a run container edits its runs in
+ * place; resetting a bit inside a run splits it, which takes two more values of the pool.
+ */
+template <std::size_t BIT_COUNT,
+          std::size_t MAXIMUM_ARRAY_VALUES,
+          std::size_t MAXIMUM_BITMAP_CONTAINERS = 0,
+          customize::SequenceContainerChecking CheckingType =
+              customize::SequenceContainerAbortChecking<bool, BIT_COUNT>>
+class FixedCompressedBitset
+{
+    using Self = FixedCompressedBitset<BIT_COUNT,
+                                       MAXIMUM_ARRAY_VALUES,
+                                       MAXIMUM_BITMAP_CONTAINERS,
+                                       CheckingType>;
+    using Checking = CheckingType;
+    static_assert(!checking_hooks::ObservesUsage<Checking>,
+                  "FixedCompressedBitset does not report to the checking hooks");
+    using ContainerKind = fixed_compressed_bitset_detail::ContainerKind;
+    using ChunkHeader = fixed_compressed_bitset_detail::ChunkHeader;
+    using BitmapWords = fixed_compressed_bitset_detail::BitmapWords;
+    using BinaryOperation = fixed_compressed_bitset_detail::BinaryOperation;
+
+    static constexpr std::size_t CHUNK_BITS = fixed_compressed_bitset_detail::CHUNK_BITS;
+    static constexpr std::size_t BITMAP_WORD_COUNT =
+        fixed_compressed_bitset_detail::BITMAP_WORD_COUNT;
+    static constexpr std::size_t MAXIMUM_ARRAY_CARDINALITY =
+        fixed_compressed_bitset_detail::MAXIMUM_ARRAY_CARDINALITY;
+    static constexpr std::size_t CHUNK_COUNT = (BIT_COUNT + CHUNK_BITS - 1) / CHUNK_BITS;
+
+    static_assert(MAXIMUM_BITMAP_CONTAINERS <= CHUNK_COUNT,
+                  "There can be at most one bitmap container per chunk");
+    static_assert(MAXIMUM_ARRAY_VALUES <= (std::numeric_limits<std::uint32_t>::max)());
+
+    using ValuePool = FixedVector<std::uint16_t, MAXIMUM_ARRAY_VALUES>;
+
+public:
+    [[nodiscard]] static constexpr std::size_t size() noexcept { return BIT_COUNT; }
+    [[nodiscard]] static constexpr std::size_t value_pool_capacity() noexcept
+    {
+        return MAXIMUM_ARRAY_VALUES;
+    }
+    [[nodiscard]] static constexpr std::size_t bitmap_container_capacity() noexcept
+    {
+        return MAXIMUM_BITMAP_CONTAINERS;
+    }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    std::array<ChunkHeader, CHUNK_COUNT> IMPLEMENTATION_DETAIL_DO_NOT_USE_chunks_;
+    ValuePool IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+    std::array<BitmapWords, MAXIMUM_BITMAP_CONTAINERS> IMPLEMENTATION_DETAIL_DO_NOT_USE_bitmaps_;
+    std::array<bool, MAXIMUM_BITMAP_CONTAINERS> IMPLEMENTATION_DETAIL_DO_NOT_USE_bitmap_slot_used_;
+
+public:
+    constexpr FixedCompressedBitset() noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_chunks_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_values_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_bitmaps_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_bitmap_slot_used_{}
+    {
+    }
+
+    [[nodiscard]] constexpr bool test(std::size_t pos,
+                                      const std_transition::source_location& loc =
+                                          std_transition::source_location::current()) const
+    {
+        check_pos(pos, loc);
+        return chunk_test(pos / CHUNK_BITS, low_bits(pos));
+    }
+
+    constexpr Self& set(
+        std::size_t pos,
+        bool val = true,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_pos(pos, loc);
+        if (val)
+        {
+            chunk_set(pos / CHUNK_BITS, low_bits(pos), loc);
+        }
+        else
+        {
+            chunk_reset(pos / CHUNK_BITS, low_bits(pos), loc);
+        }
+        return *this;
+    }
+
+    constexpr Self& reset(
+        std::size_t pos,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        return set(pos, false, loc);
+    }
+
+    constexpr Self& reset() noexcept
+    {
+        chunks() = {};
+        values().clear();
+        bitmap_slot_used() = {};
+        return *this;
+    }
+
+    [[nodiscard]] constexpr std::size_t count() const noexcept
+    {
+        std::size_t result = 0;
+        for (const ChunkHeader& header : chunks())
+        {
+            result += header.cardinality;
+        }
+        return result;
+    }
+    [[nodiscard]] constexpr bool any() const noexcept
+    {
+        return std::any_of(chunks().begin(),
+                           chunks().end(),
+                           [](const ChunkHeader& header) { return header.cardinality != 0; });
+    }
+    [[nodiscard]] constexpr bool none() const noexcept { return !any(); }
+    [[nodiscard]] constexpr bool all() const noexcept { return count() == BIT_COUNT; }
+
+    // Set-bit scanning, returning `size()` when there is no such bit.
+    [[nodiscard]] constexpr std::size_t find_first() const noexcept { return find_from(0); }
+
+    // First set bit strictly after `pos`.
+    [[nodiscard]] constexpr std::size_t find_next(std::size_t pos) const noexcept
+    {
+        if (pos + 1 >= BIT_COUNT)
+        {
+            return BIT_COUNT;
+        }
+        return find_from(pos + 1);
+    }
+
+    // Calls `func` with the index of every set bit, in increasing order.
+    template <typename Function>
+    constexpr void for_each_set_bit(Function func) const
+    {
+        for (std::size_t chunk = 0; chunk < CHUNK_COUNT; chunk++)
+        {
+            const std::size_t base = chunk * CHUNK_BITS;
+            for_each_in_chunk(chunk, [&](const std::size_t low) { func(base + low); });
+        }
+    }
+
+    constexpr Self& operator|=(const Self& right)
+    {
+        apply<BinaryOperation::OR>(right, std_transition::source_location::current());
+        return *this;
+    }
+    constexpr Self& operator&=(const Self& right)
+    {
+        apply<BinaryOperation::AND>(right, std_transition::source_location::current());
+        return *this;
+    }
+    // `*this &= ~right`, without materializing `~right`.
+    constexpr Self& and_not(const Self& right)
+    {
+        apply<BinaryOperation::AND_NOT>(right, std_transition::source_location::current());
+        return *this;
+    }
+
+    constexpr bool operator==(const Self& right) const noexcept
+    {
+        for (std::size_t chunk = 0; chunk < CHUNK_COUNT; chunk++)
+        {
+            const ChunkHeader& header = chunks()[chunk];
+            const ChunkHeader& right_header = right.chunks()[chunk];
+            if (header.cardinality != right_header.cardinality)
+            {
+                return false;
+            }
+            if (header.kind == ContainerKind::ARRAY && right_header.kind == ContainerKind::ARRAY)
+            {
+                if (!std::equal(pool_at(header.offset),
+                                pool_at(header.offset + header.length),
+                                right.pool_at(right_header.offset)))
+                {
+                    return false;
+                }
+                continue;
+            }
+            // Same cardinality, so equal if one contains the other
+            bool is_equal = true;
+            for_each_in_chunk(chunk,
+                              [&](const std::size_t low)
+                              { is_equal = is_equal && right.chunk_test(chunk, low); });
+            if (!is_equal)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Converts the chunks that are smaller as runs of consecutive bits into run containers, when
+    // the value pool has room for the conversion. Returns whether any chunk was converted.
+    constexpr bool run_optimize() noexcept
+    {
+        bool changed = false;
+        for (std::size_t chunk = 0; chunk < CHUNK_COUNT; chunk++)
+        {
+            ChunkHeader& header = chunks()[chunk];
+            if (header.kind != ContainerKind::ARRAY && header.kind != ContainerKind::BITMAP)
+            {
+                continue;
+            }
+
+            const std::size_t run_length = 2 * count_runs(chunk);
+            const std::size_t current_length =
+                header.kind == ContainerKind::ARRAY ? header.length : MAXIMUM_ARRAY_CARDINALITY;
+            if (run_length >= current_length || !has_pool_room(run_length))
+            {
+                continue;
+            }
+
+            // Write the runs after the current values, then drop the current values.
+            const std::size_t old_length = header.length;
+            open_gap(chunk, header.offset + old_length, run_length);
+            write_runs(chunk, header.offset + old_length);
+            close_gap(chunk, header.offset, old_length);
+            if (header.kind == ContainerKind::BITMAP)
+            {
+                bitmap_slot_used()[header.bitmap_slot] = false;
+            }
+            header.kind = ContainerKind::RUN;
+            header.length = static_cast<std::uint32_t>(run_length);
+            changed = true;
+        }
+        return changed;
+    }
+
+    // Memory usage, e.g. to size the pools of a given workload.
+    [[nodiscard]] constexpr std::size_t used_pool_values() const noexcept
+    {
+        return values().size();
+    }
+    [[nodiscard]] constexpr std::size_t used_bitmap_containers() const noexcept
+    {
+        return static_cast<std::size_t>(
+            std::count(bitmap_slot_used().begin(), bitmap_slot_used().end(), true));
+    }
+
+private:
+    [[nodiscard]] static constexpr std::size_t low_bits(const std::size_t pos) noexcept
+    {
+        return pos % CHUNK_BITS;
+    }
+
+    static constexpr void check_pos(const std::size_t pos,
+                                    const std_transition::source_location& loc)
+    {
+        if (preconditions::test(pos < BIT_COUNT))
+        {
+            Checking::out_of_range(pos, BIT_COUNT, loc);
+        }
+    }
+
+    [[nodiscard]] constexpr bool has_pool_room(const std::size_t count) const noexcept
+    {
+        return values().size() + count <= MAXIMUM_ARRAY_VALUES;
+    }
+    constexpr void check_pool_room(const std::size_t count,
+                                   const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(has_pool_room(count)))
+        {
+            Checking::length_error(values().size() + count, loc);
+        }
+    }
+
+    // Inserts `count` values at `pos` of the pool, within or at the end of the values of `chunk`.
+    constexpr void open_gap(const std::size_t chunk, const std::size_t pos, const std::size_t count)
+    {
+        const std::size_t old_size = values().size();
+        values().resize(old_size + count);
+        std::copy_backward(pool_at(pos), pool_at(old_size), pool_at(old_size + count));
+        for (std::size_t i = chunk + 1; i < CHUNK_COUNT; i++)
+        {
+            chunks()[i].offset += static_cast<std::uint32_t>(count);
+        }
+    }
+    // Removes `count` values at `pos` of the pool, all of which belong to `chunk`.
+    constexpr void close_gap(const std::size_t chunk,
+                             const std::size_t pos,
+                             const std::size_t count)
+    {
+        std::copy(pool_at(pos + count), values().end(), pool_at(pos));
+        values().resize(values().size() - count);
+        for (std::size_t i = chunk + 1; i < CHUNK_COUNT; i++)
+        {
+            chunks()[i].offset -= static_cast<std::uint32_t>(count);
+        }
+    }
+
+    [[nodiscard]] constexpr std::size_t find_free_bitmap_slot() const noexcept
+    {
+        return static_cast<std::size_t>(
+            std::find(bitmap_slot_used().begin(), bitmap_slot_used().end(), false) -
+            bitmap_slot_used().begin());
+    }
+    constexpr BitmapWords& allocate_bitmap(ChunkHeader& header, const std::size_t slot) noexcept
+    {
+        bitmap_slot_used()[slot] = true;
+        header.bitmap_slot = static_cast<std::uint16_t>(slot);
+        header.kind = ContainerKind::BITMAP;
+        BitmapWords& words = bitmaps()[slot];
+        words = {};
+        return words;
+    }
+
+    [[nodiscard]] constexpr std::size_t array_lower_bound(const ChunkHeader& header,
+                                                          const std::size_t low) const noexcept
+    {
+        const auto first = pool_at(header.offset);
+        return static_cast<std::size_t>(
+            std::lower_bound(first, pool_at(header.offset + header.length), low) - first);
+    }
+
+    [[nodiscard]] constexpr std::size_t run_start(const ChunkHeader& header,
+                                                  const std::size_t run) const noexcept
+    {
+        return values()[header.offset + (2 * run)];
+    }
+    [[nodiscard]] constexpr std::size_t run_last(const ChunkHeader& header,
+                                                 const std::size_t run) const noexcept
+    {
+        return run_start(header, run) + values()[header.offset + (2 * run) + 1];
+    }
+    // Index of the first run that ends at or after `low`, or the count of runs if none.
+    [[nodiscard]] constexpr std::size_t find_run(const ChunkHeader& header,
+                                                 const std::size_t low) const noexcept
+    {
+        std::size_t first = 0;
+        std::size_t last = header.length / 2;
+        while (first < last)
+        {
+            const std::size_t middle = first + ((last - first) / 2);
+            if (run_last(header, middle) < low)
+            {
+                first = middle + 1;
+            }
+            else
+            {
+                last = middle;
+            }
+        }
+        return first;
+    }
+
+    [[nodiscard]] constexpr bool chunk_test(const std::size_t chunk,
+                                            const std::size_t low) const noexcept
+    {
+        const ChunkHeader& header = chunks()[chunk];
+        switch (header.kind)
+        {
+        case ContainerKind::EMPTY:
+            return false;
+        case ContainerKind::ARRAY:
+        {
+            const std::size_t index = array_lower_bound(header, low);
+            return index < header.length && values()[header.offset + index] == low;
+        }
+        case ContainerKind::BITMAP:
+            return ((bitmaps()[header.bitmap_slot][low / 64] >> (low % 64)) & 1U) != 0;
+        case ContainerKind::RUN:
+        {
+            const std::size_t run = find_run(header, low);
+            return run < header.length / 2 && run_start(header, run) <= low;
+        }
+        }
+        return false;
+    }
+
+    constexpr void chunk_set(const std::size_t chunk,
+                             const std::size_t low,
+                             const std_transition::source_location& loc)
+    {
+        ChunkHeader& header = chunks()[chunk];
+        switch (header.kind)
+        {
+        case ContainerKind::EMPTY:
+        case ContainerKind::ARRAY:
+        {
+            const std::size_t index = array_lower_bound(header, low);
+            if (index < header.length && values()[header.offset + index] == low)
+            {
+                return;
+            }
+            // Also switch to a bitmap when the pool is full, rather than failing.
+            if (header.cardinality >= MAXIMUM_ARRAY_CARDINALITY || !has_pool_room(1))
+            {
+                const std::size_t slot = find_free_bitmap_slot();
+                if (slot < MAXIMUM_BITMAP_CONTAINERS)
+                {
+                    convert_array_to_bitmap(chunk, slot);
+                    chunk_set(chunk, low, loc);
+                    return;
+                }
+            }
+            check_pool_room(1, loc);
+            open_gap(chunk, header.offset + index, 1);
+            values()[header.offset + index] = static_cast<std::uint16_t>(low);
+            header.kind = ContainerKind::ARRAY;
+            header.length++;
+            header.cardinality++;
+            return;
+        }
+        case ContainerKind::BITMAP:
+        {
+            std::uint64_t& word = bitmaps()[header.bitmap_slot][low / 64];
+            const std::uint64_t mask = std::uint64_t{1} << (low % 64);
+            if ((word & mask) == 0)
+            {
+                word |= mask;
+                header.cardinality++;
+            }
+            return;
+        }
+        case ContainerKind::RUN:
+            if (!chunk_test(chunk, low))
+            {
+                run_insert(chunk, low, loc);
+            }
+            return;
+        }
+    }
+
+    constexpr void chunk_reset(const std::size_t chunk,
+                               const std::size_t low,
+                               const std_transition::source_location& loc)
+    {
+        ChunkHeader& header = chunks()[chunk];
+        switch (header.kind)
+        {
+        case ContainerKind::EMPTY:
+            return;
+        case ContainerKind::ARRAY:
+        {
+            const std::size_t index = array_lower_bound(header, low);
+            if (index >= header.length || values()[header.offset + index] != low)
+            {
+                return;
+            }
+            close_gap(chunk, header.offset + index, 1);
+            header.length--;
+            header.cardinality--;
+            if (header.cardinality == 0)
+            {
+                header.kind = ContainerKind::EMPTY;
+            }
+            return;
+        }
+        case ContainerKind::BITMAP:
+        {
+            std::uint64_t& word = bitmaps()[header.bitmap_slot][low / 64];
+            const std::uint64_t mask = std::uint64_t{1} << (low % 64);
+            if ((word & mask) == 0)
+            {
+                return;
+            }
+            word &= ~mask;
+            header.cardinality--;
+            // Half of the conversion threshold, so that alternating set() and reset() around it
+            // don't convert back and forth.
+            if (header.cardinality <= MAXIMUM_ARRAY_CARDINALITY / 2 &&
+                has_pool_room(header.cardinality))
+            {
+                convert_bitmap_to_array(chunk);
+            }
+            return;
+        }
+        case ContainerKind::RUN:
+            if (chunk_test(chunk, low))
+            {
+                run_erase(chunk, low, loc);
+            }
+            return;
+        }
+    }
+
+    constexpr void convert_array_to_bitmap(const std::size_t chunk, const std::size_t slot)
+    {
+        ChunkHeader& header = chunks()[chunk];
+        const std::size_t old_length = header.length;
+        BitmapWords& words = allocate_bitmap(header, slot);
+        for (std::size_t i = 0; i < old_length; i++)
+        {
+            const std::size_t low = values()[header.offset + i];
+            words[low / 64] |= std::uint64_t{1} << (low % 64);
+        }
+        close_gap(chunk, header.offset, old_length);
+        header.length = 0;
+    }
+
+    constexpr void convert_bitmap_to_array(const std::size_t chunk)
+    {
+        ChunkHeader& header = chunks()[chunk];
+        open_gap(chunk, header.offset, header.cardinality);
+        std::size_t write = header.offset;
+        for_each_in_chunk(chunk,
+                          [&](const std::size_t low)
+                          { values()[write++] = static_cast<std::uint16_t>(low); });
+        bitmap_slot_used()[header.bitmap_slot] = false;
+        header.kind = ContainerKind::ARRAY;
+        header.length = header.cardinality;
+    }
+
+    // Sets the unset bit `low` of a run container: extends the neighbouring runs, merging them if
+    // `low` was the only gap between them, or adds a run of one bit.
+    constexpr void run_insert(const std::size_t chunk,
+                              const std::size_t low,
+                              const std_transition::source_location& loc)
+    {
+        ChunkHeader& header = chunks()[chunk];
+        const std::size_t run = find_run(header, low);
+        const std::size_t pos = header.offset + (2 * run);
+        const bool extends_previous = run > 0 && run_last(header, run - 1) + 1 == low;
+        const bool extends_next = run < header.length / 2 && run_start(header, run) == low + 1;
+        if (extends_previous && extends_next)
+        {
+            values()[pos - 1] =
+                static_cast<std::uint16_t>(run_last(header, run) - run_start(header, run - 1));
+            close_gap(chunk, pos, 2);
+            header.length -= 2;
+        }
+        else if (extends_previous)
+        {
+            values()[pos - 1]++;
+        }
+        else if (extends_next)
+        {
+            values()[pos]--;
+            values()[pos + 1]++;
+        }
+        else
+        {
+            check_pool_room(2, loc);
+            open_gap(chunk, pos, 2);
+            values()[pos] = static_cast<std::uint16_t>(low);
+            values()[pos + 1] = 0;
+            header.length += 2;
+        }
+        header.cardinality++;
+    }
+
+    // Resets the set bit `low` of a run container: trims the run holding it, or splits it in two
+    // if `low` is inside it.
+    constexpr void run_erase(const std::size_t chunk,
+                             const std::size_t low,
+                             const std_transition::source_location& loc)
+    {
+        ChunkHeader& header = chunks()[chunk];
+        const std::size_t run = find_run(header, low);
+        const std::size_t pos = header.offset + (2 * run);
+        const std::size_t start = run_start(header, run);
+        const std::size_t last = run_last(header, run);
+        if (start == last)
+        {
+            close_gap(chunk, pos, 2);
+            header.length -= 2;
+        }
+        else if (low == start)
+        {
+            values()[pos]++;
+            values()[pos + 1]--;
+        }
+        else if (low == last)
+        {
+            values()[pos + 1]--;
+        }
+        else
+        {
+            check_pool_room(2, loc);
+            open_gap(chunk, pos + 2, 2);
+            values()[pos + 1] = static_cast<std::uint16_t>(low - 1 - start);
+            values()[pos + 2] = static_cast<std::uint16_t>(low + 1);
+            values()[pos + 3] = static_cast<std::uint16_t>(last - low - 1);
+            header.length += 2;
+        }
+        header.cardinality--;
+        if (header.cardinality == 0)
+        {
+            header.kind = ContainerKind::EMPTY;
+        }
+    }
+
+    // Makes `chunk` empty, releasing its container.
+    constexpr void clear_chunk(const std::size_t chunk)
+    {
+        ChunkHeader& header = chunks()[chunk];
+        if (header.kind == ContainerKind::BITMAP)
+        {
+            bitmap_slot_used()[header.bitmap_slot] = false;
+        }
+        close_gap(chunk, header.offset, header.length);
+        header.kind = ContainerKind::EMPTY;
+        header.length = 0;
+        header.cardinality = 0;
+    }
+
+    // Replaces the contents of `chunk` with the bits of `words`, in the cheapest container.
+    constexpr void assign_chunk(const std::size_t chunk,
+                                const BitmapWords& words,
+                                const std_transition::source_location& loc)
+    {
+        std::size_t cardinality = 0;
+        for (const std::uint64_t word : words)
+        {
+            cardinality += static_cast<std::size_t>(std::popcount(word));
+        }
+
+        ChunkHeader& header = chunks()[chunk];
+        const bool was_bitmap = header.kind == ContainerKind::BITMAP;
+        const std::size_t slot = was_bitmap ? header.bitmap_slot : find_free_bitmap_slot();
+        const bool use_bitmap =
+            cardinality > MAXIMUM_ARRAY_CARDINALITY && slot < MAXIMUM_BITMAP_CONTAINERS;
+        if (!use_bitmap && cardinality > header.length)
+        {
+            check_pool_room(cardinality - header.length, loc);
+        }
+
+        clear_chunk(chunk);
+        if (cardinality == 0)
+        {
+            return;
+        }
+        if (use_bitmap)
+        {
+            allocate_bitmap(header, slot) = words;
+            header.cardinality = static_cast<std::uint32_t>(cardinality);
+            return;
+        }
+
+        open_gap(chunk, header.offset, cardinality);
+        std::size_t write = header.offset;
+        for (std::size_t w_pos = 0; w_pos < BITMAP_WORD_COUNT; w_pos++)
+        {
+            for (std::uint64_t word = words[w_pos]; word != 0; word &= word - 1)
+            {
+                const auto low = (w_pos * 64) + static_cast<std::size_t>(std::countr_zero(word));
+                values()[write++] = static_cast<std::uint16_t>(low);
+            }
+        }
+        header.kind = ContainerKind::ARRAY;
+        header.length = static_cast<std::uint32_t>(cardinality);
+        header.cardinality = static_cast<std::uint32_t>(cardinality);
+    }
+
+    constexpr void fill_words(const std::size_t chunk, BitmapWords& words) const
+    {
+        for_each_in_chunk(chunk,
+                          [&](const std::size_t low)
+                          { words[low / 64] |= std::uint64_t{1} << (low % 64); });
+    }
+
+    template <BinaryOperation OPERATION>
+    constexpr void apply(const Self& right, const std_transition::source_location& loc)
+    {
+        for (std::size_t chunk = 0; chunk < CHUNK_COUNT; chunk++)
+        {
+            ChunkHeader& header = chunks()[chunk];
+            const ChunkHeader& right_header = right.chunks()[chunk];
+
+            if constexpr (OPERATION == BinaryOperation::OR)
+            {
+                if (right_header.kind == ContainerKind::EMPTY)
+                {
+                    continue;
+                }
+            }
+            else
+            {
+                if (header.kind == ContainerKind::EMPTY)
+                {
+                    continue;
+                }
+                if (right_header.kind == ContainerKind::EMPTY)
+                {
+                    if constexpr (OPERATION == BinaryOperation::AND)
+                    {
+                        clear_chunk(chunk);
+                    }
+                    continue;
+                }
+
+                // Sparse fast path: filter the array in place.
+                if (header.kind == ContainerKind::ARRAY)
+                {
+                    filter_array(chunk,
+                                 [&](const std::size_t low)
+                                 {
+                                     return right.chunk_test(chunk, low) ==
+                                            (OPERATION == BinaryOperation::AND);
+                                 });
+                    continue;
+                }
+            }
+
+            BitmapWords words{};
+            fill_words(chunk, words);
+            if constexpr (OPERATION == BinaryOperation::OR)
+            {
+                right.fill_words(chunk, words);
+            }
+            else if constexpr (OPERATION == BinaryOperation::AND)
+            {
+                BitmapWords right_words{};
+                right.fill_words(chunk, right_words);
+                for (std::size_t w_pos = 0; w_pos < BITMAP_WORD_COUNT; w_pos++)
+                {
+                    words[w_pos] &= right_words[w_pos];
+                }
+            }
+            else
+            {
+                right.for_each_in_chunk(chunk,
+                                        [&](const std::size_t low)
+                                        { words[low / 64] &= ~(std::uint64_t{1} << (low % 64)); });
+            }
+            assign_chunk(chunk, words, loc);
+        }
+    }
+
+    template <typename Predicate>
+    constexpr void filter_array(const std::size_t chunk, Predicate keep)
+    {
+        ChunkHeader& header = chunks()[chunk];
+        std::size_t write = header.offset;
+        for (std::size_t read = header.offset; read < header.offset + header.length; read++)
+        {
+            const std::uint16_t low = values()[read];
+            if (keep(low))
+            {
+                values()[write++] = low;
+            }
+        }
+        const std::size_t kept = write - header.offset;
+        close_gap(chunk, write, header.length - kept);
+        header.length = static_cast<std::uint32_t>(kept);
+        header.cardinality = static_cast<std::uint32_t>(kept);
+        if (kept == 0)
+        {
+            header.kind = ContainerKind::EMPTY;
+        }
+    }
+
+    template <typename Function>
+    constexpr void for_each_in_chunk(const std::size_t chunk, Function func) const
+    {
+        const ChunkHeader& header = chunks()[chunk];
+        switch (header.kind)
+        {
+        case ContainerKind::EMPTY:
+            return;
+        case ContainerKind::ARRAY:
+            for (std::size_t i = 0; i < header.length; i++)
+            {
+                func(static_cast<std::size_t>(values()[header.offset + i]));
+            }
+            return;
+        case ContainerKind::BITMAP:
+        {
+            const BitmapWords& words = bitmaps()[header.bitmap_slot];
+            for (std::size_t w_pos = 0; w_pos < BITMAP_WORD_COUNT; w_pos++)
+            {
+                for (std::uint64_t word = words[w_pos]; word != 0; word &= word - 1)
+                {
+                    func((w_pos * 64) + static_cast<std::size_t>(std::countr_zero(word)));
+                }
+            }
+            return;
+        }
+        case ContainerKind::RUN:
+            for (std::size_t run = 0; run < header.length / 2; run++)
+            {
+                const std::size_t last = run_last(header, run);
+                for (std::size_t low = run_start(header, run); low <= last; low++)
+                {
+                    func(low);
+                }
+            }
+            return;
+        }
+    }
+
+    [[nodiscard]] constexpr std::size_t count_runs(const std::size_t chunk) const
+    {
+        std::size_t runs = 0;
+        std::size_t next = CHUNK_BITS + 1;
+        for_each_in_chunk(chunk,
+                          [&](const std::size_t low)
+                          {
+                              if (low != next)
+                              {
+                                  runs++;
+                              }
+                              next = low + 1;
+                          });
+        return runs;
+    }
+
+    // Writes the runs of `chunk` at `pos` of the pool, which must have room for them.
+    constexpr void write_runs(const std::size_t chunk, const std::size_t pos)
+    {
+        std::size_t write = pos;
+        std::size_t next = CHUNK_BITS + 1;
+        for_each_in_chunk(chunk,
+                          [&](const std::size_t low)
+                          {
+                              if (low != next)
+                              {
+                                  values()[write] = static_cast<std::uint16_t>(low);
+                                  values()[write + 1] = 0;
+                                  write += 2;
+                              }
+                              else
+                              {
+                                  values()[write - 1]++;
+                              }
+                              next = low + 1;
+                          });
+    }
+
+    // First set bit at or after `low` in `chunk`, or `CHUNK_BITS` if none.
+    [[nodiscard]] constexpr std::size_t chunk_find_from(const std::size_t chunk,
+                                                        const std::size_t low) const noexcept
+    {
+        const ChunkHeader& header = chunks()[chunk];
+        switch (header.kind)
+        {
+        case ContainerKind::EMPTY:
+            return CHUNK_BITS;
+        case ContainerKind::ARRAY:
+        {
+            const std::size_t index = array_lower_bound(header, low);
+            return index < header.length ? values()[header.offset + index] : CHUNK_BITS;
+        }
+        case ContainerKind::BITMAP:
+        {
+            const BitmapWords& words = bitmaps()[header.bitmap_slot];
+            std::size_t w_pos = low / 64;
+            std::uint64_t word = words[w_pos] & (~std::uint64_t{0} << (low % 64));
+            while (word == 0)
+            {
+                if (++w_pos == BITMAP_WORD_COUNT)
+                {
+                    return CHUNK_BITS;
+                }
+                word = words[w_pos];
+            }
+            return (w_pos * 64) + static_cast<std::size_t>(std::countr_zero(word));
+        }
+        case ContainerKind::RUN:
+        {
+            const std::size_t run = find_run(header, low);
+            return run < header.length / 2 ? (std::max)(run_start(header, run), low) : CHUNK_BITS;
+        }
+        }
+        return CHUNK_BITS;
+    }
+
+    [[nodiscard]] constexpr std::size_t find_from(const std::size_t pos) const noexcept
+    {
+        std::size_t low = low_bits(pos);
+        for (std::size_t chunk = pos / CHUNK_BITS; chunk < CHUNK_COUNT; chunk++)
+        {
+            const std::size_t found = chunk_find_from(chunk, low);
+            if (found < CHUNK_BITS)
+            {
+                return (chunk * CHUNK_BITS) + found;
+            }
+            low = 0;
+        }
+        return BIT_COUNT;
+    }
+
+    [[nodiscard]] constexpr auto pool_at(const std::size_t pos) const noexcept
+    {
+        return std::next(values().begin(), static_cast<std::ptrdiff_t>(pos));
+    }
+    constexpr auto pool_at(const std::size_t pos) noexcept
+    {
+        return std::next(values().begin(), static_cast<std::ptrdiff_t>(pos));
+    }
+
+    [[nodiscard]] constexpr const std::array<ChunkHeader, CHUNK_COUNT>& chunks() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_chunks_;
+    }
+    constexpr std::array<ChunkHeader, CHUNK_COUNT>& chunks()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_chunks_;
+    }
+    [[nodiscard]] constexpr const ValuePool& values() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+    }
+    constexpr ValuePool& values() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_values_; }
+    [[nodiscard]] constexpr const std::array<BitmapWords, MAXIMUM_BITMAP_CONTAINERS>& bitmaps()
+        const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_bitmaps_;
+    }
+    constexpr std::array<BitmapWords, MAXIMUM_BITMAP_CONTAINERS>& bitmaps()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_bitmaps_;
+    }
+    [[nodiscard]] constexpr const std::array<bool, MAXIMUM_BITMAP_CONTAINERS>& bitmap_slot_used()
+        const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_bitmap_slot_used_;
+    }
+    constexpr std::array<bool, MAXIMUM_BITMAP_CONTAINERS>& bitmap_slot_used()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_bitmap_slot_used_;
+    }
+};
+
+}  // namespace fixed_containers
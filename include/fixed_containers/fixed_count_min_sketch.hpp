@@ -0,0 +1,152 @@
+#pragma once
+
+#include "fixed_containers/no_unique_address.hpp"
+#include "fixed_containers/wyhash.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity Count-Min sketch: approximate per-key counts in `DEPTH` rows of `WIDTH` counters,
+ * e.g. for finding the heavy hitters of a stream. Properties:
+ *  - constexpr
+ *  - `estimate()` never under-counts. With probability `1 - e^-DEPTH` it over-counts by at most
+ *    `error_factor() * total_count()`
+ *  - hashes each key once with `Hash`, and derives the column of every row by double hashing
+ *  - counters saturate instead of wrapping around
+ *  - trivially copyable, and a structural type (if `Hash` is)
+ *  - no pointers stored (data layout doesn't use pointers)
+ *  - no dynamic allocations
+ */
+template <typename K,
+          std::size_t WIDTH,
+          std::size_t DEPTH,
+          std::unsigned_integral CounterType = std::uint32_t,
+          class Hash = wyhash::hash<K>>
+class FixedCountMinSketch
+{
+    static_assert(WIDTH > 0 && DEPTH > 0, "Sketch must have at least one counter");
+    static_assert(WIDTH <= (std::size_t{1} << 32U));
+
+public:
+    using key_type = K;
+    using counter_type = CounterType;
+    using hasher = Hash;
+
+private:
+    using Row = std::array<CounterType, WIDTH>;
+    static constexpr CounterType MAX_COUNT = (std::numeric_limits<CounterType>::max)();
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    std::array<Row, DEPTH> IMPLEMENTATION_DETAIL_DO_NOT_USE_rows_{};
+    std::uint64_t IMPLEMENTATION_DETAIL_DO_NOT_USE_total_count_{};
+    // Stateless hashers take no space
+    FIXED_CONTAINERS_NO_UNIQUE_ADDRESS Hash IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_{};
+
+public:
+    constexpr FixedCountMinSketch() noexcept = default;
+    explicit constexpr FixedCountMinSketch(const Hash& hash) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_{hash}
+    {
+    }
+
+    [[nodiscard]] static constexpr std::size_t width() noexcept { return WIDTH; }
+    [[nodiscard]] static constexpr std::size_t depth() noexcept { return DEPTH; }
+    // e / WIDTH: the bound on over-counting, relative to `total_count()`.
+    [[nodiscard]] static constexpr double error_factor() noexcept
+    {
+        return 2.718281828459045 / static_cast<double>(WIDTH);
+    }
+
+    [[nodiscard]] constexpr hasher hash_function() const { return hash(); }
+
+    // Returns the estimate for `key` after the addition, so callers can compare it against a
+    // heavy-hitter threshold without a second lookup.
+    constexpr CounterType add(const K& key, CounterType count = 1) noexcept
+    {
+        const auto hash_value = static_cast<std::uint64_t>(hash()(key));
+        CounterType result = MAX_COUNT;
+        for (std::size_t row = 0; row < DEPTH; row++)
+        {
+            CounterType& counter = rows()[row][column_of(hash_value, row)];
+            counter = saturating_add(counter, count);
+            result = (std::min)(result, counter);
+        }
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_total_count_ += count;
+        return result;
+    }
+
+    [[nodiscard]] constexpr CounterType estimate(const K& key) const noexcept
+    {
+        const auto hash_value = static_cast<std::uint64_t>(hash()(key));
+        CounterType result = MAX_COUNT;
+        for (std::size_t row = 0; row < DEPTH; row++)
+        {
+            result = (std::min)(result, rows()[row][column_of(hash_value, row)]);
+        }
+        return result;
+    }
+
+    // Sum of all the counts added, exact (not saturated per key).
+    [[nodiscard]] constexpr std::uint64_t total_count() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_total_count_;
+    }
+
+    constexpr void clear() noexcept
+    {
+        rows() = {};
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_total_count_ = 0;
+    }
+
+    // The result estimates the combined stream. Both sketches must use equivalent hashers.
+    constexpr FixedCountMinSketch& operator+=(const FixedCountMinSketch& other) noexcept
+    {
+        for (std::size_t row = 0; row < DEPTH; row++)
+        {
+            for (std::size_t column = 0; column < WIDTH; column++)
+            {
+                rows()[row][column] =
+                    saturating_add(rows()[row][column], other.rows()[row][column]);
+            }
+        }
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_total_count_ += other.total_count();
+        return *this;
+    }
+
+private:
+    [[nodiscard]] constexpr const Hash& hash() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_;
+    }
+    [[nodiscard]] constexpr std::array<Row, DEPTH>& rows()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_rows_;
+    }
+    [[nodiscard]] constexpr const std::array<Row, DEPTH>& rows() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_rows_;
+    }
+
+    [[nodiscard]] static constexpr std::size_t column_of(std::uint64_t hash_value, std::size_t row)
+    {
+        // Kirsch-Mitzenmacher: h1 + row * h2, then multiply-shift into [0, WIDTH).
+        const auto first = static_cast<std::uint32_t>(hash_value);
+        const auto step = static_cast<std::uint32_t>(hash_value >> 32U) | 1U;
+        const std::uint32_t mixed = first + (static_cast<std::uint32_t>(row) * step);
+        return static_cast<std::size_t>((std::uint64_t{mixed} * WIDTH) >> 32U);
+    }
+
+    [[nodiscard]] static constexpr CounterType saturating_add(CounterType lhs, CounterType rhs)
+    {
+        return lhs > MAX_COUNT - rhs ? MAX_COUNT : static_cast<CounterType>(lhs + rhs);
+    }
+};
+
+}  // namespace fixed_containers
@@ -2,6 +2,7 @@
 
 #include "fixed_containers/algorithm.hpp"
 #include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/checking_hooks.hpp"
 #include "fixed_containers/circular_indexing.hpp"
 #include "fixed_containers/concepts.hpp"
 #include "fixed_containers/integer_range.hpp"
@@ -11,16 +12,21 @@
 #include "fixed_containers/preconditions.hpp"
 #include "fixed_containers/random_access_iterator.hpp"
 #include "fixed_containers/sequence_container_checking.hpp"
+#include "fixed_containers/sort.hpp"
 #include "fixed_containers/source_location.hpp"
 
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstring>
+#include <functional>
 #include <initializer_list>
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <span>
 #include <type_traits>
+#include <utility>
 
 namespace fixed_containers::fixed_deque_detail
 {
@@ -603,6 +609,108 @@ public:
         return unchecked_at(back_index());
     }
 
+    /**
+     * Returns the (at most two) contiguous segments that hold the elements, in order. The second
+     * segment is empty, unless the elements wrap around the end of the underlying storage.
+     * Suitable for scatter-gather I/O (e.g. `writev()`) without an intermediate copy.
+     */
+    [[nodiscard]] constexpr std::array<std::span<T>, 2> as_spans() noexcept
+    {
+        if (empty())
+        {
+            return {};
+        }
+        const std::size_t first_count = first_segment_size();
+        return {std::span<T>{std::addressof(unchecked_at(front_index())), first_count},
+                std::span<T>{std::addressof(unchecked_at(0)), size() - first_count}};
+    }
+    [[nodiscard]] constexpr std::array<std::span<const T>, 2> as_spans() const noexcept
+    {
+        if (empty())
+        {
+            return {};
+        }
+        const std::size_t first_count = first_segment_size();
+        return {std::span<const T>{std::addressof(unchecked_at(front_index())), first_count},
+                std::span<const T>{std::addressof(unchecked_at(0)), size() - first_count}};
+    }
+
+    /**
+     * Appends all `values` at the back. The copy is done in at most two contiguous chunks, which
+     * become a `memcpy()` each for trivially copyable types.
+     */
+    constexpr void push_back_n(
+        std::span<const T> values,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_target_size(size() + values.size(), loc);
+        if (values.empty())
+        {
+            return;
+        }
+
+        const std::size_t write_index = end_index();
+        const std::size_t first_chunk_size = (std::min)(values.size(), MAXIMUM_SIZE - write_index);
+        copy_construct_at(write_index, values.first(first_chunk_size));
+        copy_construct_at(0, values.subspan(first_chunk_size));
+        increment_size(values.size());
+    }
+
+    /**
+     * Removes the first `count` elements.
+     */
+    constexpr void pop_front_n(
+        size_type count,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        if (preconditions::test(count <= size()))
+        {
+            Checking::out_of_range(count, size(), loc);
+        }
+
+        if constexpr (NotTriviallyDestructible<T>)
+        {
+            const std::size_t front = front_index();
+            for (std::size_t i = 0; i < count; i++)
+            {
+                destroy_at(increment_index_with_wraparound(front, i));
+            }
+        }
+        increment_start(count);
+        decrement_size(count);
+    }
+
+    /**
+     * Rotates the elements in-place so that they start at the beginning of the underlying storage
+     * and returns them as a single contiguous span. Invalidates all iterators and spans.
+     */
+    constexpr std::span<T> linearize() noexcept
+    {
+        if (empty())
+        {
+            set_start(FIXED_DEQUE_STARTING_OFFSET);
+            return {};
+        }
+
+        const std::size_t front = front_index();
+        const std::size_t count = size();
+        // The front of the sequence is at [front, front + first_count)
+        // and the (possibly empty) wrapped-around tail is at [0, second_count).
+        const std::size_t first_count = first_segment_size();
+        const std::size_t second_count = count - first_count;
+
+        // Close the gap, if any, between the two segments: [tail][gap][front] -> [tail][front]
+        if (second_count != front)
+        {
+            relocate_forward(front, second_count, first_count);
+        }
+        // [tail][front] -> [front][tail]
+        rotate_prefix(second_count, count);
+
+        set_start(FIXED_DEQUE_STARTING_OFFSET);
+        return {std::addressof(unchecked_at(0)), count};
+    }
+
 private:
     constexpr iterator advance_all_after_iterator_by_n(const const_iterator pos,
                                                        const std::size_t n)
@@ -756,12 +864,26 @@ private:
     constexpr void increment_size(const std::size_t n = 1)
     {
         starting_index_and_size().distance += n;
+        checking_hooks::record_insert<Checking>(n, this->size());
     }
     constexpr void decrement_size(const std::size_t n = 1)
     {
         starting_index_and_size().distance -= n;
+        checking_hooks::record_erase<Checking>(n, this->size());
+    }
+    constexpr void set_size(const std::size_t size)
+    {
+        const std::size_t previous_size = starting_index_and_size().distance;
+        starting_index_and_size().distance = size;
+        if (size > previous_size)
+        {
+            checking_hooks::record_insert<Checking>(size - previous_size, size);
+        }
+        else if (size < previous_size)
+        {
+            checking_hooks::record_erase<Checking>(previous_size - size, size);
+        }
     }
-    constexpr void set_size(const std::size_t size) { starting_index_and_size().distance = size; }
 
     [[nodiscard]] constexpr const T& unchecked_at(const std::size_t index) const
     {
@@ -810,6 +932,85 @@ private:
         memory::construct_at_address_of(unchecked_at(index), std::forward<Args>(args)...);
     }
 
+    [[nodiscard]] constexpr std::size_t first_segment_size() const
+    {
+        return (std::min)(size(), MAXIMUM_SIZE - front_index());
+    }
+
+    // `[index, index + values.size())` must not wrap around.
+    constexpr void copy_construct_at(const std::size_t index, std::span<const T> values)
+    {
+        if (values.empty())
+        {
+            return;
+        }
+        if constexpr (TriviallyCopyable<T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                std::memcpy(
+                    std::addressof(unchecked_at(index)), values.data(), values.size_bytes());
+                return;
+            }
+        }
+        for (std::size_t i = 0; i < values.size(); i++)
+        {
+            place_at(index + i, values[i]);
+        }
+    }
+
+    // Moves `[source, source + count)` to `[destination, destination + count)`, where
+    // `destination < source`. Neither range may wrap around.
+    constexpr void relocate_forward(const std::size_t source,
+                                    const std::size_t destination,
+                                    const std::size_t count)
+    {
+        if constexpr (TriviallyCopyable<T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                std::memmove(std::addressof(unchecked_at(destination)),
+                             std::addressof(unchecked_at(source)),
+                             count * sizeof(T));
+                return;
+            }
+        }
+        for (std::size_t i = 0; i < count; i++)
+        {
+            memory::construct_at_address_of(unchecked_at(destination + i),
+                                            std::move(unchecked_at(source + i)));
+            destroy_at(source + i);
+        }
+    }
+
+    // Rotates `[0, last)` so that `middle` becomes the first element.
+    constexpr void rotate_prefix(const std::size_t middle, const std::size_t last)
+    {
+        if (middle == 0 || middle == last)
+        {
+            return;
+        }
+        if (!std::is_constant_evaluated())
+        {
+            T* const first = std::addressof(unchecked_at(0));
+            std::rotate(first,
+                        std::next(first, static_cast<std::ptrdiff_t>(middle)),
+                        std::next(first, static_cast<std::ptrdiff_t>(last)));
+            return;
+        }
+        // Pointer arithmetic across the storage is not allowed at compile-time, so use indices.
+        reverse_range(0, middle);
+        reverse_range(middle, last);
+        reverse_range(0, last);
+    }
+    constexpr void reverse_range(std::size_t first, std::size_t last)
+    {
+        for (; first + 1 < last; first++, last--)
+        {
+            std::swap(unchecked_at(first), unchecked_at(last - 1));
+        }
+    }
+
     // [WORKAROUND-1] - Needed by the non-trivially-copyable flavor of FixedDeque
 protected:
     constexpr void push_back_internal(const value_type& value)
@@ -1048,6 +1249,49 @@ constexpr typename FixedDeque<T, MAXIMUM_SIZE, CheckingType>::size_type erase_if
     return original_size - container.size();
 }
 
+// Sorting algorithms that choose their strategy at compile-time, based on the capacity. See
+// `sort_detail` for the details.
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          typename CheckingType,
+          typename Compare = std::less<>>
+constexpr void sort(FixedDeque<T, MAXIMUM_SIZE, CheckingType>& container, Compare comparator = {})
+{
+    sort_detail::sort<MAXIMUM_SIZE>(container.begin(), container.end(), comparator);
+}
+
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          typename CheckingType,
+          typename Compare = std::less<>>
+constexpr void stable_sort(FixedDeque<T, MAXIMUM_SIZE, CheckingType>& container,
+                           Compare comparator = {})
+{
+    sort_detail::stable_sort<MAXIMUM_SIZE>(container.begin(), container.end(), comparator);
+}
+
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          typename CheckingType,
+          typename Compare = std::less<>>
+constexpr void partial_sort(FixedDeque<T, MAXIMUM_SIZE, CheckingType>& container,
+                            typename FixedDeque<T, MAXIMUM_SIZE, CheckingType>::iterator middle,
+                            Compare comparator = {})
+{
+    sort_detail::partial_sort<MAXIMUM_SIZE>(container.begin(), middle, container.end(), comparator);
+}
+
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          typename CheckingType,
+          typename Compare = std::less<>>
+constexpr void nth_element(FixedDeque<T, MAXIMUM_SIZE, CheckingType>& container,
+                           typename FixedDeque<T, MAXIMUM_SIZE, CheckingType>::iterator nth,
+                           Compare comparator = {})
+{
+    sort_detail::nth_element<MAXIMUM_SIZE>(container.begin(), nth, container.end(), comparator);
+}
+
 /**
  * Construct a FixedDeque with its capacity being deduced from the number of items being passed.
  */
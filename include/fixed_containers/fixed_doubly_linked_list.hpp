@@ -1,9 +1,12 @@
 #pragma once
 
+#include "fixed_containers/checking_hooks.hpp"
 #include "fixed_containers/fixed_index_based_storage.hpp"
 
 #include <array>
+#include <cstddef>
 #include <limits>
+#include <utility>
 
 namespace fixed_containers::fixed_doubly_linked_list_detail
 {
@@ -14,7 +17,11 @@ struct LinkedListIndices
     IndexType next{};
 };
 
-template <typename T, std::size_t MAXIMUM_SIZE, typename IndexType = std::size_t>
+// `Checking` is the policy that receives the `checking_hooks` calls, if any.
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          typename IndexType = std::size_t,
+          typename Checking = void>
 class FixedDoublyLinkedListBase
 {
     static_assert(MAXIMUM_SIZE + 1 <= (std::numeric_limits<IndexType>::max)(),
@@ -92,6 +99,151 @@ public:
         return emplace_before_index_and_return_index(front_index(), std::forward<Args>(args)...);
     }
 
+    // The following only relink nodes; stored values (and their indices) are never touched.
+
+    // Detaches the node at `idx` from the chain. It must be linked again before further use.
+    constexpr void unlink(IndexType idx)
+    {
+        next_of(prev_of(idx)) = next_of(idx);
+        prev_of(next_of(idx)) = prev_of(idx);
+    }
+
+    // Links the detached node at `idx` right before `pos`.
+    constexpr void link_before(IndexType pos, IndexType idx)
+    {
+        const IndexType prev = prev_of(pos);
+        prev_of(idx) = prev;
+        next_of(idx) = pos;
+        next_of(prev) = idx;
+        prev_of(pos) = idx;
+    }
+
+    constexpr void move_to_back(IndexType idx)
+    {
+        if (idx == back_index())
+        {
+            return;
+        }
+        unlink(idx);
+        link_before(NULL_INDEX, idx);
+    }
+
+    // Relinks the range `[first, last)` right before `pos`, which must not be within the range.
+    constexpr void splice_before(IndexType pos, IndexType first, IndexType last)
+    {
+        if (first == last || pos == first || pos == last)
+        {
+            return;
+        }
+        const IndexType before_first = prev_of(first);
+        const IndexType last_inclusive = prev_of(last);
+        next_of(before_first) = last;
+        prev_of(last) = before_first;
+
+        const IndexType before_pos = prev_of(pos);
+        next_of(before_pos) = first;
+        prev_of(first) = before_pos;
+        next_of(last_inclusive) = pos;
+        prev_of(pos) = last_inclusive;
+    }
+
+    constexpr void reverse()
+    {
+        // Swapping the links of every node, including the sentinel, reverses the chain.
+        IndexType idx = NULL_INDEX;
+        do
+        {
+            std::swap(next_of(idx), prev_of(idx));
+            idx = prev_of(idx);
+        } while (idx != NULL_INDEX);
+    }
+
+    // Stable, O(n log n), O(1) extra space. Bottom-up merge sort on the `next` links only,
+    // treating the chain as singly-linked (terminated by the sentinel), with the `prev` links
+    // rebuilt at the end.
+    template <typename Compare>
+    constexpr void sort(Compare comparator)
+    {
+        if (size() < 2)
+        {
+            return;
+        }
+
+        IndexType head = front_index();
+        IndexType tail = NULL_INDEX;
+        for (std::size_t width = 1;; width *= 2)
+        {
+            IndexType left = head;
+            head = NULL_INDEX;
+            tail = NULL_INDEX;
+            std::size_t merge_count = 0;
+
+            while (left != NULL_INDEX)
+            {
+                merge_count++;
+                IndexType right = left;
+                std::size_t left_size = 0;
+                while (left_size < width && right != NULL_INDEX)
+                {
+                    left_size++;
+                    right = next_of(right);
+                }
+                std::size_t right_size = width;
+
+                while (left_size > 0 || (right_size > 0 && right != NULL_INDEX))
+                {
+                    IndexType chosen{};
+                    // Ties are taken from the left run, to keep the sort stable.
+                    if (left_size == 0)
+                    {
+                        chosen = right;
+                        right = next_of(right);
+                        right_size--;
+                    }
+                    else if (right_size == 0 || right == NULL_INDEX ||
+                             !comparator(at(right), at(left)))
+                    {
+                        chosen = left;
+                        left = next_of(left);
+                        left_size--;
+                    }
+                    else
+                    {
+                        chosen = right;
+                        right = next_of(right);
+                        right_size--;
+                    }
+
+                    if (tail == NULL_INDEX)
+                    {
+                        head = chosen;
+                    }
+                    else
+                    {
+                        next_of(tail) = chosen;
+                    }
+                    tail = chosen;
+                }
+                left = right;
+            }
+            next_of(tail) = NULL_INDEX;
+
+            if (merge_count <= 1)
+            {
+                break;
+            }
+        }
+
+        IndexType prev = NULL_INDEX;
+        for (IndexType idx = head; idx != NULL_INDEX; idx = next_of(idx))
+        {
+            prev_of(idx) = prev;
+            prev = idx;
+        }
+        next_of(NULL_INDEX) = head;
+        prev_of(NULL_INDEX) = tail;
+    }
+
     constexpr IndexType delete_at_and_return_next_index(IndexType idx)
     {
         decrement_size();
@@ -139,13 +291,16 @@ private:
     }
     constexpr ChainType& chain() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_; }
 
+protected:
     constexpr void increment_size(const IndexType n = 1)
     {
         IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ += n;
+        checking_hooks::record_insert<Checking>(n, size());
     }
     constexpr void decrement_size(const IndexType n = 1)
     {
         IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ -= n;
+        checking_hooks::record_erase<Checking>(n, size());
     }
 };
 
@@ -154,10 +309,14 @@ private:
 namespace fixed_containers::fixed_doubly_linked_list_detail::specializations
 {
 
-template <typename T, std::size_t MAXIMUM_SIZE, typename IndexType = std::size_t>
-class FixedDoublyLinkedList : public FixedDoublyLinkedListBase<T, MAXIMUM_SIZE, IndexType>
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          typename IndexType = std::size_t,
+          typename Checking = void>
+class FixedDoublyLinkedList
+  : public FixedDoublyLinkedListBase<T, MAXIMUM_SIZE, IndexType, Checking>
 {
-    using Base = FixedDoublyLinkedListBase<T, MAXIMUM_SIZE, IndexType>;
+    using Base = FixedDoublyLinkedListBase<T, MAXIMUM_SIZE, IndexType, Checking>;
 
 public:
     // clang-format off
@@ -192,7 +351,7 @@ public:
         // freelist)
 
         // set the size
-        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = other.size();
+        this->increment_size(other.size());
 
         // copy the chain (trivial)
         this->IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_ =
@@ -217,7 +376,7 @@ public:
         // Warning: assumes the destination (`this`) is already clear of any values!
 
         // identical impl to above but with move instead of copy, see those comments.
-        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = other.size();
+        this->increment_size(other.size());
         this->IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_ =
             other.IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_;
         this->IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_.set_freelist_state_from_other(
@@ -269,11 +428,11 @@ public:
     constexpr ~FixedDoublyLinkedList() noexcept { this->clear(); }
 };
 
-template <TriviallyCopyable T, std::size_t MAXIMUM_SIZE, typename IndexType>
-class FixedDoublyLinkedList<T, MAXIMUM_SIZE, IndexType>
-  : public FixedDoublyLinkedListBase<T, MAXIMUM_SIZE, IndexType>
+template <TriviallyCopyable T, std::size_t MAXIMUM_SIZE, typename IndexType, typename Checking>
+class FixedDoublyLinkedList<T, MAXIMUM_SIZE, IndexType, Checking>
+  : public FixedDoublyLinkedListBase<T, MAXIMUM_SIZE, IndexType, Checking>
 {
-    using Base = FixedDoublyLinkedListBase<T, MAXIMUM_SIZE, IndexType>;
+    using Base = FixedDoublyLinkedListBase<T, MAXIMUM_SIZE, IndexType, Checking>;
 
 public:
     // clang-format off
@@ -287,7 +446,10 @@ namespace fixed_containers::fixed_doubly_linked_list_detail
 {
 // [WORKAROUND-1] due to destructors: manually do the split with template specialization.
 // See FixedVector which uses the same workaround for more details.
-template <typename T, std::size_t MAXIMUM_SIZE, typename IndexType = std::size_t>
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          typename IndexType = std::size_t,
+          typename Checking = void>
 using FixedDoublyLinkedList = fixed_doubly_linked_list_detail::specializations::
-    FixedDoublyLinkedList<T, MAXIMUM_SIZE, IndexType>;
+    FixedDoublyLinkedList<T, MAXIMUM_SIZE, IndexType, Checking>;
 }  // namespace fixed_containers::fixed_doubly_linked_list_detail
@@ -12,6 +12,7 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <functional>
 #include <initializer_list>
 #include <iterator>
 #include <type_traits>
@@ -37,7 +38,8 @@ class FixedList
     static_assert(std::same_as<std::remove_cv_t<T>, T>,
                   "List must have a non-const, non-volatile value_type");
     using Checking = CheckingType;
-    using List = fixed_doubly_linked_list_detail::FixedDoublyLinkedList<T, MAXIMUM_SIZE>;
+    using List = fixed_doubly_linked_list_detail::
+        FixedDoublyLinkedList<T, MAXIMUM_SIZE, std::size_t, CheckingType>;
     static constexpr std::size_t NULL_INDEX = List::NULL_INDEX;
 
 public:
@@ -374,6 +376,145 @@ public:
         return remove_if([&value](const T& entry) { return entry == value; });
     }
 
+    // The operations below relink nodes without moving values, except when the elements come
+    // from another list: values live inline in each list's own storage, so they are
+    // move-constructed into this one (once per transferred element).
+
+    template <typename BinaryPredicate>
+    constexpr size_type unique(BinaryPredicate predicate)
+    {
+        if (empty())
+        {
+            return 0;
+        }
+
+        size_type removed_counter = 0;
+        std::size_t previous = front_index();
+        for (std::size_t i = list().next_of(previous); i != end_index();)
+        {
+            if (predicate(list().at(previous), list().at(i)))
+            {
+                i = list().delete_at_and_return_next_index(i);
+                ++removed_counter;
+            }
+            else
+            {
+                previous = i;
+                i = list().next_of(i);
+            }
+        }
+
+        return removed_counter;
+    }
+    constexpr size_type unique() { return unique(std::equal_to<>{}); }
+
+    constexpr void reverse() noexcept { list().reverse(); }
+
+    template <typename Compare>
+    constexpr void sort(Compare comparator)
+    {
+        list().sort(comparator);
+    }
+    constexpr void sort() { sort(std::less<>{}); }
+
+    template <typename Compare>
+    constexpr void merge(
+        FixedList& other,
+        Compare comparator,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        if (this == &other)
+        {
+            return;
+        }
+        check_target_size(size() + other.size(), loc);
+
+        std::size_t i = front_index();
+        for (std::size_t j = other.front_index(); j != other.end_index();)
+        {
+            if (i == end_index() || comparator(other.list().at(j), list().at(i)))
+            {
+                list().emplace_before_index_and_return_index(i, std::move(other.list().at(j)));
+                j = other.list().delete_at_and_return_next_index(j);
+            }
+            else
+            {
+                i = list().next_of(i);
+            }
+        }
+    }
+    template <typename Compare>
+    constexpr void merge(
+        FixedList&& other,
+        Compare comparator,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        merge(other, comparator, loc);
+    }
+    constexpr void merge(
+        FixedList& other,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        merge(other, std::less<>{}, loc);
+    }
+    constexpr void merge(
+        FixedList&& other,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        merge(other, std::less<>{}, loc);
+    }
+
+    constexpr void splice(
+        const_iterator pos,
+        FixedList& other,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        splice_internal(index_of(pos), other, other.front_index(), other.end_index(), loc);
+    }
+    constexpr void splice(
+        const_iterator pos,
+        FixedList&& other,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        splice(pos, other, loc);
+    }
+    constexpr void splice(
+        const_iterator pos,
+        FixedList& other,
+        const_iterator it,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        const std::size_t first_index = index_of(it);
+        splice_internal(
+            index_of(pos), other, first_index, other.list().next_of(first_index), loc);
+    }
+    constexpr void splice(
+        const_iterator pos,
+        FixedList&& other,
+        const_iterator it,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        splice(pos, other, it, loc);
+    }
+    constexpr void splice(
+        const_iterator pos,
+        FixedList& other,
+        const_iterator first,
+        const_iterator last,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        splice_internal(index_of(pos), other, index_of(first), index_of(last), loc);
+    }
+    constexpr void splice(
+        const_iterator pos,
+        FixedList&& other,
+        const_iterator first,
+        const_iterator last,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        splice(pos, other, first, last, loc);
+    }
+
     constexpr iterator erase(const_iterator first,
                              const_iterator last,
                              const std_transition::source_location& /*loc*/ =
@@ -540,6 +681,33 @@ private:
         return create_iterator(inserted_point);
     }
 
+    constexpr void splice_internal(const std::size_t insertion_point,
+                                   FixedList& other,
+                                   const std::size_t first_index,
+                                   const std::size_t last_index,
+                                   const std_transition::source_location& loc)
+    {
+        if (this == &other)
+        {
+            list().splice_before(insertion_point, first_index, last_index);
+            return;
+        }
+
+        std::size_t entry_count_to_add = 0;
+        for (std::size_t i = first_index; i != last_index; i = other.list().next_of(i))
+        {
+            entry_count_to_add++;
+        }
+        check_target_size(size() + entry_count_to_add, loc);
+
+        for (std::size_t i = first_index; i != last_index;)
+        {
+            list().emplace_before_index_and_return_index(insertion_point,
+                                                         std::move(other.list().at(i)));
+            i = other.list().delete_at_and_return_next_index(i);
+        }
+    }
+
     constexpr iterator create_iterator(const std::size_t offset_from_start) noexcept
     {
         return iterator{ReferenceProvider<false>{std::addressof(list()), offset_from_start}};
@@ -0,0 +1,391 @@
+#pragma once
+
+#include "fixed_containers/checking_hooks.hpp"
+#include "fixed_containers/fixed_bitset.hpp"
+#include "fixed_containers/fixed_robinhood_hashtable.hpp"
+#include "fixed_containers/map_checking.hpp"
+#include "fixed_containers/optional_reference.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/source_location.hpp"
+#include "fixed_containers/wyhash.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::fixed_lru_cache_detail
+{
+// The policies below decide what "touching" an entry means and which entry gets evicted.
+// Both rely on the hashtable's value storage being a linked list in insertion order, with stable
+// value indices: entries never move in memory, only their links change.
+
+// Exact LRU: a touch relinks the entry to the back, so the front is always the eviction victim.
+template <std::size_t MAXIMUM_SIZE>
+struct LruPolicy
+{
+    template <typename Table>
+    constexpr void on_insert(Table& /*table*/, const typename Table::OpaqueIteratedType& /*idx*/)
+    {
+    }
+
+    template <typename Table>
+    constexpr void on_access(Table& table, const typename Table::OpaqueIteratedType& idx)
+    {
+        table.move_to_back(idx);
+    }
+
+    template <typename Table>
+    constexpr typename Table::OpaqueIteratedType select_victim(Table& table)
+    {
+        return table.begin_index();
+    }
+};
+
+// CLOCK (a.k.a. second-chance FIFO): a touch only sets a reference bit, so reads never write to
+// the list. On eviction, referenced entries at the front get their bit cleared and are moved to
+// the back, until an unreferenced one is found.
+template <std::size_t MAXIMUM_SIZE>
+struct ClockPolicy
+{
+    FixedBitset<MAXIMUM_SIZE> IMPLEMENTATION_DETAIL_DO_NOT_USE_referenced_{};
+
+    template <typename Table>
+    constexpr void on_insert(Table& /*table*/, const typename Table::OpaqueIteratedType& idx)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_referenced_.set(idx, false);
+    }
+
+    template <typename Table>
+    constexpr void on_access(Table& /*table*/, const typename Table::OpaqueIteratedType& idx)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_referenced_.set(idx, true);
+    }
+
+    template <typename Table>
+    constexpr typename Table::OpaqueIteratedType select_victim(Table& table)
+    {
+        // Terminates after at most one full sweep, as every visited entry gets its bit cleared.
+        auto idx = table.begin_index();
+        while (IMPLEMENTATION_DETAIL_DO_NOT_USE_referenced_.test(idx))
+        {
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_referenced_.set(idx, false);
+            table.move_to_back(idx);
+            idx = table.begin_index();
+        }
+        return idx;
+    }
+};
+
+template <typename K,
+          typename V,
+          std::size_t MAXIMUM_SIZE,
+          class Hash,
+          class KeyEqual,
+          std::size_t BUCKET_COUNT,
+          customize::MapChecking<K> CheckingType,
+          typename EvictionPolicy>
+class FixedCacheBase
+{
+    static_assert(MAXIMUM_SIZE > 0, "Cache must have a non-zero capacity");
+
+    using Table = fixed_robinhood_hashtable_detail::
+        FixedRobinhoodHashtable<K, V, MAXIMUM_SIZE, BUCKET_COUNT, Hash, KeyEqual>;
+    using TableIndex = typename Table::OpaqueIndexType;
+    using TableIteratedIndex = typename Table::OpaqueIteratedType;
+    using TableSizeType = typename Table::SizeType;
+    using Checking = CheckingType;
+    static_assert(!checking_hooks::ObservesUsage<Checking>,
+                  "FixedLruCache does not report to the checking hooks");
+
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using size_type = std::size_t;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    Table IMPLEMENTATION_DETAIL_DO_NOT_USE_table_;
+    EvictionPolicy IMPLEMENTATION_DETAIL_DO_NOT_USE_policy_;
+    // Home bucket of the key of each entry, by value index, so that evicting an entry finds its
+    // bucket without hashing its key again.
+    std::array<TableSizeType, MAXIMUM_SIZE> IMPLEMENTATION_DETAIL_DO_NOT_USE_home_buckets_;
+
+public:
+    constexpr FixedCacheBase(const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual()) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_table_{hash, equal}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_policy_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_home_buckets_{}
+    {
+    }
+
+public:
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return table().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+
+    [[nodiscard]] constexpr bool contains(const K& key) const noexcept
+    {
+        return table().exists(table().opaque_index_of(key));
+    }
+
+    /**
+     * Returns the value for `key` and marks it as recently used, or an empty reference if absent.
+     */
+    constexpr OptionalReference<V> get(const K& key) noexcept
+    {
+        const TableIndex idx = table().opaque_index_of(key);
+        if (!table().exists(idx))
+        {
+            return OptionalReference<V>{};
+        }
+        const TableIteratedIndex value_index = table().iterated_index_from(idx);
+        policy().on_access(table(), value_index);
+        return OptionalReference<V>{table().value_at(value_index)};
+    }
+
+    /**
+     * Same as `get()`, but does not affect the eviction order.
+     */
+    [[nodiscard]] constexpr OptionalReference<const V> peek(const K& key) const noexcept
+    {
+        const TableIndex idx = table().opaque_index_of(key);
+        if (!table().exists(idx))
+        {
+            return OptionalReference<const V>{};
+        }
+        return OptionalReference<const V>{table().value(idx)};
+    }
+
+    /**
+     * Same as `get()`, but a missing key is reported via `CheckingType`.
+     */
+    constexpr V& at(
+        const K& key,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        OptionalReference<V> out = get(key);
+        if (preconditions::test(out.has_value()))
+        {
+            Checking::out_of_range(key, size(), loc);
+        }
+        return *out;
+    }
+
+    /**
+     * Inserts or assigns the value for `key` and marks it as recently used. If the cache is full
+     * and `key` is not present, the entry chosen by the eviction policy is removed first.
+     */
+    constexpr V& put(const K& key, const V& value) { return put_impl(key, value); }
+    constexpr V& put(const K& key, V&& value) { return put_impl(key, std::move(value)); }
+
+    constexpr bool erase(const K& key) noexcept
+    {
+        const TableIndex idx = table().opaque_index_of(key);
+        if (!table().exists(idx))
+        {
+            return false;
+        }
+        table().erase(idx);
+        return true;
+    }
+
+    constexpr void clear() noexcept { table().clear(); }
+
+private:
+    constexpr Table& table() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_table_; }
+    [[nodiscard]] constexpr const Table& table() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_table_;
+    }
+    constexpr EvictionPolicy& policy() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_policy_; }
+    constexpr std::array<TableSizeType, MAXIMUM_SIZE>& home_buckets()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_home_buckets_;
+    }
+
+    template <typename VV>
+    constexpr V& put_impl(const K& key, VV&& value)
+    {
+        const std::uint64_t key_hash = table().hash(key);
+        TableIndex idx = table().opaque_index_of(key, key_hash);
+        if (table().exists(idx))
+        {
+            const TableIteratedIndex value_index = table().iterated_index_from(idx);
+            table().value_at(value_index) = std::forward<VV>(value);
+            policy().on_access(table(), value_index);
+            return table().value_at(value_index);
+        }
+
+        if (size() >= MAXIMUM_SIZE)
+        {
+            const TableIteratedIndex victim = policy().select_victim(table());
+            table().erase(table().opaque_index_of_iterated(victim, home_buckets()[victim]));
+            // Erasing shifts buckets around, so the insertion point must be recomputed.
+            idx = table().opaque_index_of(key, key_hash);
+        }
+
+        idx = table().emplace(idx, key, std::forward<VV>(value));
+        const TableIteratedIndex value_index = table().iterated_index_from(idx);
+        home_buckets()[value_index] = Table::bucket_index_from_hash(key_hash);
+        policy().on_insert(table(), value_index);
+        return table().value_at(value_index);
+    }
+};
+
+}  // namespace fixed_containers::fixed_lru_cache_detail
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity Least-Recently-Used cache with maximum size that is declared at compile-time via
+ * template parameter. Built directly on the `FixedUnorderedMap` hashtable, whose value storage is
+ * a linked list: `get()`/`put()` relink the entry to the back in O(1), and a `put()` on a full
+ * cache evicts the front entry instead of reporting an error. Each access costs a single lookup
+ * and keys are stored once. Each entry also keeps the home bucket of its key (4 bytes), so that
+ * evicting it does not hash the key again. Properties:
+ *  - constexpr
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ */
+template <typename K,
+          typename V,
+          std::size_t MAXIMUM_SIZE,
+          class Hash = wyhash::hash<K>,
+          class KeyEqual = std::equal_to<K>,
+          std::size_t BUCKET_COUNT =
+              fixed_robinhood_hashtable_detail::default_bucket_count(MAXIMUM_SIZE),
+          customize::MapChecking<K> CheckingType = customize::MapAbortChecking<K, V, MAXIMUM_SIZE>>
+class FixedLruCache
+  : public fixed_lru_cache_detail::FixedCacheBase<K,
+                                                  V,
+                                                  MAXIMUM_SIZE,
+                                                  Hash,
+                                                  KeyEqual,
+                                                  BUCKET_COUNT,
+                                                  CheckingType,
+                                                  fixed_lru_cache_detail::LruPolicy<MAXIMUM_SIZE>>
+{
+    using Base =
+        fixed_lru_cache_detail::FixedCacheBase<K,
+                                               V,
+                                               MAXIMUM_SIZE,
+                                               Hash,
+                                               KeyEqual,
+                                               BUCKET_COUNT,
+                                               CheckingType,
+                                               fixed_lru_cache_detail::LruPolicy<MAXIMUM_SIZE>>;
+
+public:
+    constexpr FixedLruCache(const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual()) noexcept
+      : Base{hash, equal}
+    {
+    }
+};
+
+/**
+ * Same API as `FixedLruCache`, but approximates LRU with the CLOCK algorithm: an access only sets
+ * a reference bit instead of relinking the entry, which makes hits cheaper. Entries that were
+ * accessed since the last sweep get a second chance before being evicted.
+ */
+template <typename K,
+          typename V,
+          std::size_t MAXIMUM_SIZE,
+          class Hash = wyhash::hash<K>,
+          class KeyEqual = std::equal_to<K>,
+          std::size_t BUCKET_COUNT =
+              fixed_robinhood_hashtable_detail::default_bucket_count(MAXIMUM_SIZE),
+          customize::MapChecking<K> CheckingType = customize::MapAbortChecking<K, V, MAXIMUM_SIZE>>
+class FixedClockCache
+  : public fixed_lru_cache_detail::FixedCacheBase<K,
+                                                  V,
+                                                  MAXIMUM_SIZE,
+                                                  Hash,
+                                                  KeyEqual,
+                                                  BUCKET_COUNT,
+                                                  CheckingType,
+                                                  fixed_lru_cache_detail::ClockPolicy<MAXIMUM_SIZE>>
+{
+    using Base =
+        fixed_lru_cache_detail::FixedCacheBase<K,
+                                               V,
+                                               MAXIMUM_SIZE,
+                                               Hash,
+                                               KeyEqual,
+                                               BUCKET_COUNT,
+                                               CheckingType,
+                                               fixed_lru_cache_detail::ClockPolicy<MAXIMUM_SIZE>>;
+
+public:
+    constexpr FixedClockCache(const Hash& hash = Hash(),
+                              const KeyEqual& equal = KeyEqual()) noexcept
+      : Base{hash, equal}
+    {
+    }
+};
+
+template <typename K,
+          typename V,
+          std::size_t MAXIMUM_SIZE,
+          class Hash,
+          class KeyEqual,
+          std::size_t BUCKET_COUNT,
+          customize::MapChecking<K> CheckingType>
+[[nodiscard]] constexpr bool is_full(
+    const FixedLruCache<K, V, MAXIMUM_SIZE, Hash, KeyEqual, BUCKET_COUNT, CheckingType>& container)
+{
+    return container.size() >= container.max_size();
+}
+
+template <typename K,
+          typename V,
+          std::size_t MAXIMUM_SIZE,
+          class Hash,
+          class KeyEqual,
+          std::size_t BUCKET_COUNT,
+          customize::MapChecking<K> CheckingType>
+[[nodiscard]] constexpr bool is_full(
+    const FixedClockCache<K, V, MAXIMUM_SIZE, Hash, KeyEqual, BUCKET_COUNT, CheckingType>&
+        container)
+{
+    return container.size() >= container.max_size();
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename K,
+          typename V,
+          std::size_t MAXIMUM_SIZE,
+          class Hash,
+          class KeyEqual,
+          std::size_t BUCKET_COUNT,
+          fixed_containers::customize::MapChecking<K> CheckingType>
+struct tuple_size<
+    fixed_containers::
+        FixedLruCache<K, V, MAXIMUM_SIZE, Hash, KeyEqual, BUCKET_COUNT, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+template <typename K,
+          typename V,
+          std::size_t MAXIMUM_SIZE,
+          class Hash,
+          class KeyEqual,
+          std::size_t BUCKET_COUNT,
+          fixed_containers::customize::MapChecking<K> CheckingType>
+struct tuple_size<
+    fixed_containers::
+        FixedClockCache<K, V, MAXIMUM_SIZE, Hash, KeyEqual, BUCKET_COUNT, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
@@ -2,6 +2,7 @@
 
 #include "fixed_containers/assert_or_abort.hpp"
 #include "fixed_containers/bidirectional_iterator.hpp"
+#include "fixed_containers/checking_hooks.hpp"
 #include "fixed_containers/concepts.hpp"
 #include "fixed_containers/emplace.hpp"
 #include "fixed_containers/erase_if.hpp"
@@ -199,6 +200,7 @@ public:
                                       std_transition::source_location::current()) noexcept
     {
         const NodeIndex index = tree().index_of_node_or_null(key);
+        record_lookup();
         if (preconditions::test(tree().contains_at(index)))
         {
             CheckingType::out_of_range(key, size(), loc);
@@ -211,6 +213,7 @@ public:
             std_transition::source_location::current()) const noexcept
     {
         const NodeIndex index = tree().index_of_node_or_null(key);
+        record_lookup();
         if (preconditions::test(tree().contains_at(index)))
         {
             CheckingType::out_of_range(key, size(), loc);
@@ -231,6 +234,7 @@ public:
 
         check_not_full(loc);
         tree().insert_new_at(np_idxs, key);
+        record_insert();
         return tree().node_at(np_idxs.i).value();
     }
     constexpr V& operator[](K&& key,
@@ -245,6 +249,7 @@ public:
 
         check_not_full(loc);
         tree().insert_new_at(np_idxs, std::move(key));
+        record_insert();
         return tree().node_at(np_idxs.i).value();
     }
 #else
@@ -259,6 +264,7 @@ public:
         // Cannot capture real source_location for operator[]
         check_not_full(std_transition::source_location::current());
         tree().insert_new_at(np_idxs, key);
+        record_insert();
         return tree().node_at(np_idxs.i).value();
     }
     constexpr V& operator[](K&& key) noexcept
@@ -272,6 +278,7 @@ public:
         // Cannot capture real source_location for operator[]
         check_not_full(std_transition::source_location::current());
         tree().insert_new_at(np_idxs, std::move(key));
+        record_insert();
         return tree().node_at(np_idxs.i).value();
     }
 #endif
@@ -309,7 +316,12 @@ public:
     [[nodiscard]] constexpr std::size_t size() const noexcept { return tree().size(); }
     [[nodiscard]] constexpr bool empty() const noexcept { return tree().empty(); }
 
-    constexpr void clear() noexcept { tree().clear(); }
+    constexpr void clear() noexcept
+    {
+        const std::size_t previous_size = size();
+        tree().clear();
+        record_erase(previous_size);
+    }
 
     constexpr std::pair<iterator, bool> insert(
         const value_type& value,
@@ -324,6 +336,7 @@ public:
 
         check_not_full(loc);
         tree().insert_new_at(np_idxs, value.first, value.second);
+        record_insert();
         return {create_iterator(np_idxs.i), true};
     }
     constexpr std::pair<iterator, bool> insert(
@@ -339,6 +352,7 @@ public:
 
         check_not_full(loc);
         tree().insert_new_at(np_idxs, value.first, std::move(value.second));
+        record_insert();
         return {create_iterator(np_idxs.i), true};
     }
 
@@ -377,6 +391,7 @@ public:
 
         check_not_full(loc);
         tree().insert_new_at(np_idxs, key, std::forward<M>(obj));
+        record_insert();
         return {create_iterator(np_idxs.i), true};
     }
     template <class M>
@@ -396,6 +411,7 @@ public:
 
         check_not_full(loc);
         tree().insert_new_at(np_idxs, std::move(key), std::forward<M>(obj));
+        record_insert();
         return {create_iterator(np_idxs.i), true};
     }
     template <class M>
@@ -430,6 +446,7 @@ public:
 
         check_not_full(std_transition::source_location::current());
         tree().insert_new_at(np_idxs, key, std::forward<Args>(args)...);
+        record_insert();
         return {create_iterator(np_idxs.i), true};
     }
     template <class... Args>
@@ -443,6 +460,7 @@ public:
 
         check_not_full(std_transition::source_location::current());
         tree().insert_new_at(np_idxs, std::move(key), std::forward<Args>(args)...);
+        record_insert();
         return {create_iterator(np_idxs.i), true};
     }
     template <class... Args>
@@ -480,6 +498,7 @@ public:
         const NodeIndex index = get_node_index_from_iterator(pos);
         assert_or_abort(tree().contains_at(index));
         const NodeIndex successor_index = tree().delete_at_and_return_successor(index);
+        record_erase(1);
         return create_iterator(successor_index);
     }
     constexpr iterator erase(iterator pos) noexcept { return erase(const_iterator{pos}); }
@@ -491,16 +510,24 @@ public:
             first == cend() ? NULL_INDEX : get_node_index_from_iterator(first);
         const NodeIndex to_idx = last == cend() ? NULL_INDEX : get_node_index_from_iterator(last);
 
+        const std::size_t previous_size = size();
         const NodeIndex successor_index =
             tree().delete_range_and_return_successor(from_idx, to_idx);
+        record_erase(previous_size - size());
         return create_iterator(successor_index);
     }
 
-    constexpr size_type erase(const K& key) noexcept { return tree().delete_node(key); }
+    constexpr size_type erase(const K& key) noexcept
+    {
+        const size_type removed_count = tree().delete_node(key);
+        record_erase(removed_count);
+        return removed_count;
+    }
 
     [[nodiscard]] constexpr iterator find(const K& key) noexcept
     {
         const NodeIndex index = tree().index_of_node_or_null(key);
+        record_lookup();
         if (!tree().contains_at(index))
         {
             return this->end();
@@ -512,6 +539,7 @@ public:
     [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
     {
         const NodeIndex index = tree().index_of_node_or_null(key);
+        record_lookup();
         if (!tree().contains_at(index))
         {
             return this->cend();
@@ -525,6 +553,7 @@ public:
         requires IsTransparent<Compare>
     {
         const NodeIndex index = tree().index_of_node_or_null(key);
+        record_lookup();
         if (!tree().contains_at(index))
         {
             return this->end();
@@ -538,6 +567,7 @@ public:
         requires IsTransparent<Compare>
     {
         const NodeIndex index = tree().index_of_node_or_null(key);
+        record_lookup();
         if (!tree().contains_at(index))
         {
             return this->cend();
@@ -548,6 +578,7 @@ public:
 
     [[nodiscard]] constexpr bool contains(const K& key) const noexcept
     {
+        record_lookup();
         return tree().contains_node(key);
     }
 
@@ -555,6 +586,7 @@ public:
     [[nodiscard]] constexpr bool contains(const K0& key) const noexcept
         requires IsTransparent<Compare>
     {
+        record_lookup();
         return tree().contains_node(key);
     }
 
@@ -709,6 +741,16 @@ private:
         }
     }
 
+    constexpr void record_insert() const { checking_hooks::record_insert<CheckingType>(1, size()); }
+    constexpr void record_erase(const std::size_t count) const
+    {
+        if (count > 0)
+        {
+            checking_hooks::record_erase<CheckingType>(count, size());
+        }
+    }
+    constexpr void record_lookup() const { checking_hooks::record_lookup<CheckingType>(); }
+
     [[nodiscard]] constexpr std::pair<iterator, iterator> equal_range_impl(
         const NodeIndexAndParentIndex& np_idxs_idxs) noexcept
     {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/checking_hooks.hpp"
 #include "fixed_containers/emplace.hpp"
 #include "fixed_containers/erase_if.hpp"
 #include "fixed_containers/forward_iterator.hpp"
@@ -8,7 +9,24 @@
 #include "fixed_containers/source_location.hpp"
 
 #include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <memory>
+#include <type_traits>
+
+namespace fixed_containers::fixed_map_adapter_detail
+{
+// Ranges of pairs whose keys can be hashed before inserting them: multi-pass, and with keys of
+// exactly the key type, so that the hash is the one the table would compute.
+template <typename InputIt, typename K>
+concept KeysHashableAhead = std::forward_iterator<InputIt> && requires(InputIt it) {
+    (*it).first;
+    requires std::same_as<std::remove_cvref_t<decltype((*it).first)>, K>;
+};
+}  // namespace fixed_containers::fixed_map_adapter_detail
 
 namespace fixed_containers
 {
@@ -29,6 +47,10 @@ private:
     using TableIndex = typename TableImpl::OpaqueIndexType;
     using TableIteratedIndex = typename TableImpl::OpaqueIteratedType;
 
+    // Keys hashed ahead by the range `insert()`. The hashes don't depend on each other, so
+    // computing them back to back keeps several in flight at once.
+    static constexpr std::size_t HASH_BATCH_SIZE = 16;
+
     template <bool IS_CONST>
     class PairProvider
     {
@@ -92,6 +114,7 @@ public:
 
     using size_type = std::size_t;
     using difference_type = ptrdiff_t;
+    using hasher = typename TableImpl::HashType;
 
 public:
     static constexpr size_type static_max_size() noexcept { return TableImpl::CAPACITY; }
@@ -122,6 +145,7 @@ public:
                                       std_transition::source_location::current()) noexcept
     {
         const TableIndex idx = table().opaque_index_of(key);
+        record_lookup();
         if (!table().exists(idx))
         {
             CheckingType::out_of_range(key, size(), loc);
@@ -135,6 +159,7 @@ public:
             std_transition::source_location::current()) const noexcept
     {
         const TableIndex idx = table().opaque_index_of(key);
+        record_lookup();
         if (!table().exists(idx))
         {
             CheckingType::out_of_range(key, size(), loc);
@@ -152,6 +177,7 @@ public:
         {
             check_not_full(loc);
             idx = table().emplace(idx, key);
+            record_insert();
         }
         return table().value(idx);
     }
@@ -165,6 +191,7 @@ public:
         {
             check_not_full(loc);
             idx = table().emplace(idx, std::move(key));
+            record_insert();
         }
         return table().value(idx);
     }
@@ -176,6 +203,7 @@ public:
         {
             check_not_full(std_transition::source_location::current());
             idx = table().emplace(idx, key);
+            record_insert();
         }
         return table().value(idx);
     }
@@ -187,6 +215,7 @@ public:
         {
             check_not_full(std_transition::source_location::current());
             idx = table().emplace(idx, std::move(key));
+            record_insert();
         }
         return table().value(idx);
     }
@@ -216,7 +245,17 @@ public:
     [[nodiscard]] constexpr std::size_t size() const noexcept { return table().size(); }
     [[nodiscard]] constexpr bool empty() const noexcept { return table().size() == 0; }
 
-    constexpr void clear() noexcept { table().clear(); }
+    [[nodiscard]] constexpr hasher hash_function() const
+    {
+        return table().IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_;
+    }
+
+    constexpr void clear() noexcept
+    {
+        const std::size_t previous_size = size();
+        table().clear();
+        record_erase(previous_size);
+    }
 
     constexpr std::pair<iterator, bool> insert(
         const value_type& pair,
@@ -231,6 +270,7 @@ public:
 
         check_not_full(loc);
         idx = table().emplace(idx, pair.first, pair.second);
+        record_insert();
         return {create_iterator(idx), true};
     }
 
@@ -247,6 +287,7 @@ public:
 
         check_not_full(loc);
         idx = table().emplace(idx, std::move(pair.first), std::move(pair.second));
+        record_insert();
         return {create_iterator(idx), true};
     }
 
@@ -256,9 +297,31 @@ public:
                           const std_transition::source_location& loc =
                               std_transition::source_location::current()) noexcept
     {
-        for (; first != last; std::advance(first, 1))
+        if constexpr (fixed_map_adapter_detail::KeysHashableAhead<InputIt, K>)
+        {
+            std::array<std::uint64_t, HASH_BATCH_SIZE> hashes{};
+            while (first != last)
+            {
+                std::size_t batch_size = 0;
+                for (InputIt it = first; batch_size < HASH_BATCH_SIZE && it != last;
+                     std::advance(it, 1))
+                {
+                    hashes[batch_size] = table().hash((*it).first);
+                    ++batch_size;
+                }
+                for (std::size_t i = 0; i < batch_size; i++)
+                {
+                    insert_with_hash(*first, hashes[i], loc);
+                    std::advance(first, 1);
+                }
+            }
+        }
+        else
         {
-            this->insert(*first, loc);
+            for (; first != last; std::advance(first, 1))
+            {
+                this->insert(*first, loc);
+            }
         }
     }
 
@@ -286,6 +349,7 @@ public:
 
         check_not_full(loc);
         idx = table().emplace(idx, key, std::forward<M>(obj));
+        record_insert();
         return {create_iterator(idx), true};
     }
 
@@ -306,6 +370,7 @@ public:
 
         check_not_full(loc);
         idx = table().emplace(idx, std::move(key), std::forward<M>(obj));
+        record_insert();
         return {create_iterator(idx), true};
     }
 
@@ -342,6 +407,7 @@ public:
 
         check_not_full(std_transition::source_location::current());
         idx = table().emplace(idx, key, std::forward<Args>(args)...);
+        record_insert();
         return {create_iterator(idx), true};
     }
 
@@ -356,6 +422,7 @@ public:
 
         check_not_full(std_transition::source_location::current());
         idx = table().emplace(idx, std::move(key), std::forward<Args>(args)...);
+        record_insert();
         return {create_iterator(idx), true};
     }
 
@@ -396,6 +463,7 @@ public:
         const TableIndex idx = table().opaque_index_of(pos->first);
         assert_or_abort(table().exists(idx));
         const TableIteratedIndex next_idx = table().erase(idx);
+        record_erase(1);
         return iterator{PairProvider<false>{std::addressof(table()), next_idx}};
     }
 
@@ -405,8 +473,10 @@ public:
             first.template private_reference_provider<const PairProvider<true>&>();
         const PairProvider<true>& end =
             last.template private_reference_provider<const PairProvider<true>&>();
+        const std::size_t previous_size = size();
         const TableIteratedIndex next_idx =
             table().erase_range(start.current_index_, end.current_index_);
+        record_erase(previous_size - size());
         return iterator{PairProvider<false>{std::addressof(table()), next_idx}};
     }
 
@@ -418,18 +488,34 @@ public:
             return 0;
         }
         table().erase(idx);
+        record_erase(1);
         return 1;
     }
 
     [[nodiscard]] constexpr iterator find(const K& key) noexcept
     {
-        const TableIndex idx = table().opaque_index_of(key);
-        return create_checked_iterator(idx);
+        return find(key, table().hash(key));
     }
 
     [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
     {
-        const TableIndex idx = table().opaque_index_of(key);
+        return find(key, table().hash(key));
+    }
+
+    // The following take the hash of `key`, for callers that hashed their keys up front (e.g. with
+    // `wyhash::hash_batch()`). `key_hash` must be `hash_function()(key)`.
+    [[nodiscard]] constexpr iterator find(const K& key, const std::uint64_t key_hash) noexcept
+    {
+        const TableIndex idx = table().opaque_index_of(key, key_hash);
+        record_lookup();
+        return create_checked_iterator(idx);
+    }
+
+    [[nodiscard]] constexpr const_iterator find(const K& key,
+                                                const std::uint64_t key_hash) const noexcept
+    {
+        const TableIndex idx = table().opaque_index_of(key, key_hash);
+        record_lookup();
         if (!table().exists(idx))
         {
             return cend();
@@ -441,7 +527,13 @@ public:
 
     [[nodiscard]] constexpr bool contains(const K& key) const noexcept
     {
-        const TableIndex idx = table().opaque_index_of(key);
+        return contains(key, table().hash(key));
+    }
+
+    [[nodiscard]] constexpr bool contains(const K& key, const std::uint64_t key_hash) const noexcept
+    {
+        const TableIndex idx = table().opaque_index_of(key, key_hash);
+        record_lookup();
         return table().exists(idx);
     }
 
@@ -471,6 +563,22 @@ public:
     }
 
 private:
+    template <typename Pair>
+    constexpr void insert_with_hash(Pair&& pair,
+                                    const std::uint64_t key_hash,
+                                    const std_transition::source_location& loc)
+    {
+        const TableIndex idx = table().opaque_index_of(pair.first, key_hash);
+        if (table().exists(idx))
+        {
+            return;
+        }
+
+        check_not_full(loc);
+        table().emplace(idx, std::forward<Pair>(pair).first, std::forward<Pair>(pair).second);
+        record_insert();
+    }
+
     constexpr iterator create_checked_iterator(const TableIndex& index) noexcept
     {
         // check for nonexistent indices and replace them with end() so the iterator compares
@@ -502,6 +610,16 @@ private:
             CheckingType::length_error(TableImpl::CAPACITY + 1, loc);
         }
     }
+
+    constexpr void record_insert() const { checking_hooks::record_insert<CheckingType>(1, size()); }
+    constexpr void record_erase(const std::size_t count) const
+    {
+        if (count > 0)
+        {
+            checking_hooks::record_erase<CheckingType>(count, size());
+        }
+    }
+    constexpr void record_lookup() const { checking_hooks::record_lookup<CheckingType>(); }
 };
 
 template <typename K, typename V, typename TableImpl, typename CheckingType>
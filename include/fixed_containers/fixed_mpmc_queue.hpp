@@ -0,0 +1,271 @@
+#pragma once
+
+#include "fixed_containers/checking_hooks.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/memory.hpp"
+#include "fixed_containers/optional_storage.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::fixed_mpmc_queue_detail
+{
+// Not using `std::hardware_destructive_interference_size`, as its value is not ABI-stable
+// and some compilers warn when it is used in headers.
+inline constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+template <typename T>
+struct Cell
+{
+    // Encodes the state of the cell relative to the cursor `pos` that maps to it:
+    // - `sequence == pos`: empty, ready for the producer that claims `pos`
+    // - `sequence == pos + 1`: full, ready for the consumer that claims `pos`
+    // - `sequence == pos + MAXIMUM_SIZE`: empty again, for the next lap
+    std::atomic<std::size_t> sequence;
+    optional_storage_detail::OptionalStorage<T> value;
+};
+
+}  // namespace fixed_containers::fixed_mpmc_queue_detail
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity, bounded, lock-free multi-producer/multi-consumer queue with maximum size that is
+ * declared at compile-time via template parameter. Based on Dmitry Vyukov's bounded MPMC queue:
+ * every cell carries a sequence number, so producers and consumers only contend on their
+ * respective cursor. Properties:
+ *  - lock-free
+ *  - no pointers stored (data layout is purely self-referential, so an instance can be placed in
+ *    a shared-memory segment and be used across processes)
+ *  - no dynamic allocations
+ *  - not constexpr, as atomic operations are not
+ *
+ * The `try_` flavors report full/empty via their return value. `push()`/`pop()` treat full/empty
+ * as a precondition violation and report it through `CheckingType`, like other containers.
+ */
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          customize::SequenceContainerChecking CheckingType =
+              customize::SequenceContainerAbortChecking<T, MAXIMUM_SIZE>>
+class FixedMpmcQueue
+{
+    static_assert(IsNotReference<T>, "References are not allowed");
+    static_assert(std::same_as<std::remove_cv_t<T>, T>,
+                  "FixedMpmcQueue must have a non-const, non-volatile value_type");
+    // With a single cell, "full for lap `n`" and "empty for lap `n + 1`" have the same sequence.
+    static_assert(MAXIMUM_SIZE > 1, "FixedMpmcQueue must have a capacity of at least 2");
+    static_assert(std::atomic<std::size_t>::is_always_lock_free,
+                  "Lock-free atomics are required for usage in shared memory");
+    // Values are moved in and out of cells that are already claimed. A throwing move would leave
+    // the cell's sequence unpublished, and every consumer (or producer) would stall on it.
+    static_assert(std::is_nothrow_move_constructible_v<T>,
+                  "FixedMpmcQueue must have a nothrow move-constructible value_type");
+
+    using Checking = CheckingType;
+    static_assert(!checking_hooks::ObservesUsage<Checking>,
+                  "FixedMpmcQueue does not report to the checking hooks");
+    using Cell = fixed_mpmc_queue_detail::Cell<T>;
+    using Array = std::array<Cell, MAXIMUM_SIZE>;
+    static constexpr std::size_t CACHE_LINE_SIZE = fixed_mpmc_queue_detail::CACHE_LINE_SIZE;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+private:
+    alignas(CACHE_LINE_SIZE) Array array_;
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> enqueue_pos_;
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> dequeue_pos_;
+
+public:
+    FixedMpmcQueue() noexcept
+      : array_{}
+      , enqueue_pos_{0}
+      , dequeue_pos_{0}
+    {
+        for (std::size_t i = 0; i < MAXIMUM_SIZE; i++)
+        {
+            array_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    FixedMpmcQueue(const FixedMpmcQueue&) = delete;
+    FixedMpmcQueue(FixedMpmcQueue&&) noexcept = delete;
+    FixedMpmcQueue& operator=(const FixedMpmcQueue&) = delete;
+    FixedMpmcQueue& operator=(FixedMpmcQueue&&) noexcept = delete;
+
+    // Not thread-safe; all producers and consumers must be done with the queue.
+    ~FixedMpmcQueue() noexcept
+    {
+        if constexpr (NotTriviallyDestructible<T>)
+        {
+            const std::size_t end = enqueue_pos_.load(std::memory_order_relaxed);
+            for (std::size_t pos = dequeue_pos_.load(std::memory_order_relaxed); pos != end; pos++)
+            {
+                memory::destroy_at_address_of(cell_at(pos).value.get());
+            }
+        }
+    }
+
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+
+    // The following are snapshots and may be stale by the time they are returned,
+    // if there are concurrent producers or consumers.
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        // Load the consumer cursor first, so the result can't underflow.
+        const std::size_t dequeue_pos = dequeue_pos_.load(std::memory_order_acquire);
+        const std::size_t enqueue_pos = enqueue_pos_.load(std::memory_order_acquire);
+        const std::size_t distance = enqueue_pos - dequeue_pos;
+        return distance > MAXIMUM_SIZE ? MAXIMUM_SIZE : distance;
+    }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    [[nodiscard]] bool try_push(const value_type& value) { return try_emplace(value); }
+    [[nodiscard]] bool try_push(value_type&& value) { return try_emplace(std::move(value)); }
+
+    /**
+     * If constructing `T` from `args` may throw, the value is constructed before claiming a cell
+     * and then moved in, so a throwing constructor leaves the queue untouched. In that case, the
+     * value is also constructed when the queue is full.
+     */
+    template <class... Args>
+    [[nodiscard]] bool try_emplace(Args&&... args)
+    {
+        if constexpr (std::is_nothrow_constructible_v<T, Args...>)
+        {
+            return try_emplace_nothrow(std::forward<Args>(args)...);
+        }
+        else
+        {
+            T value(std::forward<Args>(args)...);
+            return try_emplace_nothrow(std::move(value));
+        }
+    }
+
+    [[nodiscard]] std::optional<value_type> try_pop()
+    {
+        std::size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        while (true)
+        {
+            cell = std::addressof(cell_at(pos));
+            const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence - (pos + 1));
+            if (diff == 0)
+            {
+                if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // The producer for `pos` has not published yet: empty.
+                return std::nullopt;
+            }
+            else
+            {
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        std::optional<value_type> out{std::move(cell->value.get())};
+        memory::destroy_at_address_of(cell->value.get());
+        cell->sequence.store(pos + MAXIMUM_SIZE, std::memory_order_release);
+        return out;
+    }
+
+    void push(
+        const value_type& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        if (preconditions::test(try_emplace(value)))
+        {
+            Checking::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+    void push(
+        value_type&& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        if (preconditions::test(try_emplace(std::move(value))))
+        {
+            Checking::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+
+    template <class... Args>
+    void emplace(Args&&... args)
+    {
+        if (preconditions::test(try_emplace(std::forward<Args>(args)...)))
+        {
+            // Cannot capture real source_location, as it can't follow the parameter pack
+            Checking::length_error(MAXIMUM_SIZE + 1, std_transition::source_location::current());
+        }
+    }
+
+    value_type pop(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        std::optional<value_type> out = try_pop();
+        if (preconditions::test(out.has_value()))
+        {
+            Checking::empty_container_access(loc);
+        }
+        return std::move(*out);
+    }
+
+private:
+    template <class... Args>
+    [[nodiscard]] bool try_emplace_nothrow(Args&&... args)
+    {
+        std::size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        while (true)
+        {
+            cell = std::addressof(cell_at(pos));
+            const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+            if (diff == 0)
+            {
+                // On failure, `pos` is updated with the latest value and we retry with that.
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // The cell still holds the value from the previous lap: full.
+                return false;
+            }
+            else
+            {
+                // Another producer claimed `pos` already.
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        memory::construct_at_address_of(cell->value.get(), std::forward<Args>(args)...);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    Cell& cell_at(const std::size_t pos) { return array_[pos % MAXIMUM_SIZE]; }
+};
+
+}  // namespace fixed_containers
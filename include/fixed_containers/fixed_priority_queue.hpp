@@ -0,0 +1,644 @@
+#pragma once
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::fixed_priority_queue_detail
+{
+// Implicit d-ary heap: the children of `i` are at `[i * ARITY + 1, i * ARITY + ARITY]`.
+// A wider node means a shallower tree, and all children of a node are adjacent in memory, which
+// trades a few more comparisons per level for far fewer cache misses on large heaps.
+//
+// The sift functions move a "hole" instead of swapping, so every level costs one move instead of
+// three. `on_placed(i)` is invoked whenever an element lands at index `i`, which lets callers keep
+// an external index up-to-date.
+template <std::size_t ARITY>
+constexpr std::size_t parent_of(const std::size_t index)
+{
+    return (index - 1) / ARITY;
+}
+
+template <std::size_t ARITY>
+constexpr std::size_t first_child_of(const std::size_t index)
+{
+    return (index * ARITY) + 1;
+}
+
+template <std::size_t ARITY, typename RandomIt, typename Less, typename OnPlaced>
+constexpr void sift_up(RandomIt first, std::size_t index, const Less& less, OnPlaced&& on_placed)
+{
+    auto value = std::move(first[static_cast<std::ptrdiff_t>(index)]);
+    while (index > 0)
+    {
+        const std::size_t parent = parent_of<ARITY>(index);
+        if (!less(first[static_cast<std::ptrdiff_t>(parent)], value))
+        {
+            break;
+        }
+        first[static_cast<std::ptrdiff_t>(index)] =
+            std::move(first[static_cast<std::ptrdiff_t>(parent)]);
+        on_placed(index);
+        index = parent;
+    }
+    first[static_cast<std::ptrdiff_t>(index)] = std::move(value);
+    on_placed(index);
+}
+
+template <std::size_t ARITY, typename RandomIt, typename Less, typename OnPlaced>
+constexpr void sift_down(RandomIt first,
+                         const std::size_t size,
+                         std::size_t index,
+                         const Less& less,
+                         OnPlaced&& on_placed)
+{
+    auto value = std::move(first[static_cast<std::ptrdiff_t>(index)]);
+    while (true)
+    {
+        const std::size_t first_child = first_child_of<ARITY>(index);
+        if (first_child >= size)
+        {
+            break;
+        }
+        const std::size_t last_child = first_child + ARITY < size ? first_child + ARITY : size;
+        std::size_t best_child = first_child;
+        for (std::size_t child = first_child + 1; child < last_child; child++)
+        {
+            if (less(first[static_cast<std::ptrdiff_t>(best_child)],
+                     first[static_cast<std::ptrdiff_t>(child)]))
+            {
+                best_child = child;
+            }
+        }
+        if (!less(value, first[static_cast<std::ptrdiff_t>(best_child)]))
+        {
+            break;
+        }
+        first[static_cast<std::ptrdiff_t>(index)] =
+            std::move(first[static_cast<std::ptrdiff_t>(best_child)]);
+        on_placed(index);
+        index = best_child;
+    }
+    first[static_cast<std::ptrdiff_t>(index)] = std::move(value);
+    on_placed(index);
+}
+
+// Floyd's bottom-up construction, O(n).
+template <std::size_t ARITY, typename RandomIt, typename Less, typename OnPlaced>
+constexpr void make_heap(RandomIt first,
+                         const std::size_t size,
+                         const Less& less,
+                         OnPlaced&& on_placed)
+{
+    if (size < 2)
+    {
+        return;
+    }
+    for (std::size_t index = parent_of<ARITY>(size - 1) + 1; index > 0; index--)
+    {
+        sift_down<ARITY>(first, size, index - 1, less, on_placed);
+    }
+}
+
+struct NoOpOnPlaced
+{
+    constexpr void operator()(const std::size_t /*index*/) const noexcept {}
+};
+
+}  // namespace fixed_containers::fixed_priority_queue_detail
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity priority queue with maximum size that is declared at compile-time via
+ * template parameter. Same ordering semantics as `std::priority_queue` (with `std::less`, `top()`
+ * is the largest element), but backed by an implicit `ARITY`-ary heap. 4-ary is the default, as
+ * it tends to be faster than binary for both `push()` and `pop()`. Properties:
+ *  - constexpr
+ *  - retains the copy/move/destruction properties of T
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ *
+ * In addition to the `std::priority_queue` API, `push_pop()` and `replace_top()` combine a push
+ * and a pop into a single sift, and construction from a range heapifies in O(n).
+ */
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          typename Compare = std::less<T>,
+          std::size_t ARITY = 4,
+          customize::SequenceContainerChecking CheckingType =
+              customize::SequenceContainerAbortChecking<T, MAXIMUM_SIZE>>
+class FixedPriorityQueue
+{
+    static_assert(ARITY >= 2, "FixedPriorityQueue requires a heap arity of at least 2");
+
+    using Checking = CheckingType;
+    using Container = FixedVector<T, MAXIMUM_SIZE, CheckingType>;
+
+public:
+    using container_type = Container;
+    using value_compare = Compare;
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+    [[nodiscard]] static constexpr std::size_t arity() noexcept { return ARITY; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    container_type IMPLEMENTATION_DETAIL_DO_NOT_USE_data_;
+    Compare IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+
+public:
+    constexpr FixedPriorityQueue() noexcept
+      : FixedPriorityQueue{Compare{}}
+    {
+    }
+
+    explicit constexpr FixedPriorityQueue(const Compare& comparator) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_data_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_{comparator}
+    {
+    }
+
+    template <InputIterator InputIt>
+    constexpr FixedPriorityQueue(InputIt first,
+                                 InputIt last,
+                                 const Compare& comparator = Compare{},
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_data_{first, last, loc}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_{comparator}
+    {
+        fixed_priority_queue_detail::make_heap<ARITY>(
+            data().begin(), size(), comparator_ref(), fixed_priority_queue_detail::NoOpOnPlaced{});
+    }
+
+    constexpr FixedPriorityQueue(std::initializer_list<T> list,
+                                 const Compare& comparator = Compare{},
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) noexcept
+      : FixedPriorityQueue{list.begin(), list.end(), comparator, loc}
+    {
+    }
+
+public:
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return data().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return data().empty(); }
+
+    [[nodiscard]] constexpr const_reference top(
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        return data().front(loc);
+    }
+
+    constexpr void push(
+        const value_type& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        data().push_back(value, loc);
+        sift_up_last();
+    }
+    constexpr void push(
+        value_type&& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        data().push_back(std::move(value), loc);
+        sift_up_last();
+    }
+
+    template <class... Args>
+    constexpr void emplace(Args&&... args)
+    {
+        data().emplace_back(std::forward<Args>(args)...);
+        sift_up_last();
+    }
+
+    constexpr void pop(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        if (preconditions::test(!empty()))
+        {
+            Checking::empty_container_access(loc);
+        }
+        if (size() > 1)
+        {
+            data().front() = std::move(data().back());
+        }
+        data().pop_back();
+        sift_down_top();
+    }
+
+    /**
+     * Equivalent to `push(value)` followed by `pop()`, returning the popped element, but with a
+     * single sift. Does not touch the heap at all if `value` would be the new top.
+     * Works even when the queue is full.
+     */
+    constexpr value_type push_pop(value_type value)
+    {
+        if (empty() || !comparator_ref()(value, data().front()))
+        {
+            return value;
+        }
+        std::swap(data().front(), value);
+        sift_down_top();
+        return value;
+    }
+
+    /**
+     * Equivalent to `pop()` followed by `push(value)`, returning the popped element, but with a
+     * single sift. Works even when the queue is full.
+     */
+    constexpr value_type replace_top(
+        value_type value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        if (preconditions::test(!empty()))
+        {
+            Checking::empty_container_access(loc);
+        }
+        std::swap(data().front(), value);
+        sift_down_top();
+        return value;
+    }
+
+    constexpr void clear() noexcept { data().clear(); }
+
+    [[nodiscard]] constexpr const value_compare& value_comp() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+    }
+
+private:
+    constexpr container_type& data() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_data_; }
+    [[nodiscard]] constexpr const container_type& data() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_data_;
+    }
+    [[nodiscard]] constexpr const Compare& comparator_ref() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+    }
+
+    constexpr void sift_up_last()
+    {
+        fixed_priority_queue_detail::sift_up<ARITY>(data().begin(),
+                                                    size() - 1,
+                                                    comparator_ref(),
+                                                    fixed_priority_queue_detail::NoOpOnPlaced{});
+    }
+    constexpr void sift_down_top()
+    {
+        if (size() < 2)
+        {
+            return;
+        }
+        fixed_priority_queue_detail::sift_down<ARITY>(data().begin(),
+                                                      size(),
+                                                      0,
+                                                      comparator_ref(),
+                                                      fixed_priority_queue_detail::NoOpOnPlaced{});
+    }
+};
+
+/**
+ * Fixed-capacity priority queue that hands out a stable handle for every pushed element, so that
+ * the element can later be re-prioritized (decrease-key/increase-key) or removed in O(log n).
+ * Handles are in `[0, MAXIMUM_SIZE)` and are reused after the element they refer to is popped or
+ * erased. Same ordering semantics and properties as `FixedPriorityQueue`.
+ */
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          typename Compare = std::less<T>,
+          std::size_t ARITY = 4,
+          customize::SequenceContainerChecking CheckingType =
+              customize::SequenceContainerAbortChecking<T, MAXIMUM_SIZE>>
+class FixedIndexedPriorityQueue
+{
+    static_assert(ARITY >= 2, "FixedIndexedPriorityQueue requires a heap arity of at least 2");
+
+    using Checking = CheckingType;
+
+public:
+    using value_compare = Compare;
+    using value_type = T;
+    using size_type = std::size_t;
+    using const_reference = const T&;
+    using handle_type = std::size_t;
+
+    struct Entry
+    {
+        T value;
+        handle_type handle;
+    };
+
+private:
+    static constexpr std::size_t NULL_POSITION = MAXIMUM_SIZE;
+
+    struct EntryCompare
+    {
+        const Compare* comparator;
+        constexpr bool operator()(const Entry& left, const Entry& right) const
+        {
+            return (*comparator)(left.value, right.value);
+        }
+    };
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+    [[nodiscard]] static constexpr std::size_t arity() noexcept { return ARITY; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    FixedVector<Entry, MAXIMUM_SIZE, CheckingType> IMPLEMENTATION_DETAIL_DO_NOT_USE_heap_;
+    // Heap position of every handle, `NULL_POSITION` for handles that are not in use.
+    std::array<std::size_t, MAXIMUM_SIZE> IMPLEMENTATION_DETAIL_DO_NOT_USE_positions_;
+    // Stack of handles that are not in use. Its size is always `MAXIMUM_SIZE - size()`.
+    std::array<handle_type, MAXIMUM_SIZE> IMPLEMENTATION_DETAIL_DO_NOT_USE_free_handles_;
+    Compare IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+
+public:
+    constexpr FixedIndexedPriorityQueue() noexcept
+      : FixedIndexedPriorityQueue{Compare{}}
+    {
+    }
+
+    explicit constexpr FixedIndexedPriorityQueue(const Compare& comparator) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_heap_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_positions_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_free_handles_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_{comparator}
+    {
+        for (std::size_t i = 0; i < MAXIMUM_SIZE; i++)
+        {
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_positions_[i] = NULL_POSITION;
+            // Hand out the lowest handles first.
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_free_handles_[i] = MAXIMUM_SIZE - 1 - i;
+        }
+    }
+
+public:
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return heap().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return heap().empty(); }
+
+    [[nodiscard]] constexpr const_reference top(
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        check_not_empty(loc);
+        return heap().front().value;
+    }
+    [[nodiscard]] constexpr handle_type top_handle(
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        check_not_empty(loc);
+        return heap().front().handle;
+    }
+
+    [[nodiscard]] constexpr bool contains(const handle_type handle) const noexcept
+    {
+        return handle < MAXIMUM_SIZE && positions()[handle] != NULL_POSITION;
+    }
+
+    [[nodiscard]] constexpr const_reference at(
+        const handle_type handle,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        check_contains(handle, loc);
+        return heap()[positions()[handle]].value;
+    }
+
+    constexpr handle_type push(
+        const value_type& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        return emplace_impl(loc, value);
+    }
+    constexpr handle_type push(
+        value_type&& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        return emplace_impl(loc, std::move(value));
+    }
+
+    template <class... Args>
+    constexpr handle_type emplace(Args&&... args)
+    {
+        return emplace_impl(std_transition::source_location::current(),
+                            std::forward<Args>(args)...);
+    }
+
+    constexpr void pop(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_empty(loc);
+        erase_at(0);
+    }
+
+    constexpr void erase(
+        const handle_type handle,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_contains(handle, loc);
+        erase_at(positions()[handle]);
+    }
+
+    /**
+     * Changes the value of the element referred to by `handle` and restores the heap property.
+     * Covers both decrease-key and increase-key.
+     */
+    constexpr void update(
+        const handle_type handle,
+        value_type value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_contains(handle, loc);
+        const std::size_t position = positions()[handle];
+        heap()[position].value = std::move(value);
+        restore_at(position);
+    }
+
+    constexpr void clear() noexcept
+    {
+        while (!empty())
+        {
+            erase_at(size() - 1);
+        }
+    }
+
+    [[nodiscard]] constexpr const value_compare& value_comp() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+    }
+
+private:
+    constexpr FixedVector<Entry, MAXIMUM_SIZE, CheckingType>& heap()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_heap_;
+    }
+    [[nodiscard]] constexpr const FixedVector<Entry, MAXIMUM_SIZE, CheckingType>& heap() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_heap_;
+    }
+    constexpr std::array<std::size_t, MAXIMUM_SIZE>& positions()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_positions_;
+    }
+    [[nodiscard]] constexpr const std::array<std::size_t, MAXIMUM_SIZE>& positions() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_positions_;
+    }
+    constexpr std::array<handle_type, MAXIMUM_SIZE>& free_handles()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_free_handles_;
+    }
+    [[nodiscard]] constexpr EntryCompare entry_compare() const
+    {
+        return EntryCompare{&IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_};
+    }
+
+    template <class... Args>
+    constexpr handle_type emplace_impl(const std_transition::source_location& loc,
+                                       Args&&... args)
+    {
+        if (preconditions::test(size() < MAXIMUM_SIZE))
+        {
+            Checking::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+        const handle_type handle = free_handles()[MAXIMUM_SIZE - size() - 1];
+        heap().push_back(Entry{T(std::forward<Args>(args)...), handle});
+        positions()[handle] = size() - 1;
+        sift_up(size() - 1);
+        return handle;
+    }
+
+    constexpr void erase_at(const std::size_t position)
+    {
+        const handle_type handle = heap()[position].handle;
+        const std::size_t last = size() - 1;
+        if (position != last)
+        {
+            heap()[position] = std::move(heap()[last]);
+            positions()[heap()[position].handle] = position;
+        }
+        heap().pop_back();
+        positions()[handle] = NULL_POSITION;
+        free_handles()[MAXIMUM_SIZE - size() - 1] = handle;
+        if (position < size())
+        {
+            restore_at(position);
+        }
+    }
+
+    constexpr void restore_at(const std::size_t position)
+    {
+        if (position > 0 &&
+            entry_compare()(heap()[fixed_priority_queue_detail::parent_of<ARITY>(position)],
+                            heap()[position]))
+        {
+            sift_up(position);
+        }
+        else
+        {
+            sift_down(position);
+        }
+    }
+
+    constexpr void sift_up(const std::size_t position)
+    {
+        fixed_priority_queue_detail::sift_up<ARITY>(
+            heap().begin(), position, entry_compare(), on_placed());
+    }
+    constexpr void sift_down(const std::size_t position)
+    {
+        fixed_priority_queue_detail::sift_down<ARITY>(
+            heap().begin(), size(), position, entry_compare(), on_placed());
+    }
+    constexpr auto on_placed()
+    {
+        return [this](const std::size_t position)
+        { positions()[heap()[position].handle] = position; };
+    }
+
+    constexpr void check_not_empty(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(!empty()))
+        {
+            Checking::empty_container_access(loc);
+        }
+    }
+    constexpr void check_contains(const handle_type handle,
+                                  const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(contains(handle)))
+        {
+            Checking::invalid_argument("Handle is not in FixedIndexedPriorityQueue", loc);
+        }
+    }
+};
+
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          typename Compare,
+          std::size_t ARITY,
+          typename CheckingType>
+[[nodiscard]] constexpr bool is_full(
+    const FixedPriorityQueue<T, MAXIMUM_SIZE, Compare, ARITY, CheckingType>& container)
+{
+    return container.size() >= MAXIMUM_SIZE;
+}
+
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          typename Compare,
+          std::size_t ARITY,
+          typename CheckingType>
+[[nodiscard]] constexpr bool is_full(
+    const FixedIndexedPriorityQueue<T, MAXIMUM_SIZE, Compare, ARITY, CheckingType>& container)
+{
+    return container.size() >= MAXIMUM_SIZE;
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          typename Compare,
+          std::size_t ARITY,
+          fixed_containers::customize::SequenceContainerChecking CheckingType>
+struct tuple_size<
+    fixed_containers::FixedPriorityQueue<T, MAXIMUM_SIZE, Compare, ARITY, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          typename Compare,
+          std::size_t ARITY,
+          fixed_containers::customize::SequenceContainerChecking CheckingType>
+struct tuple_size<
+    fixed_containers::FixedIndexedPriorityQueue<T, MAXIMUM_SIZE, Compare, ARITY, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
@@ -274,7 +274,14 @@ public:
 
     [[nodiscard]] constexpr OpaqueIndexType opaque_index_of(const K& key) const
     {
-        const std::uint64_t key_hash = hash(key);
+        return opaque_index_of(key, hash(key));
+    }
+
+    // For callers that hashed their keys up front (e.g. with `wyhash::hash_batch()`). `key_hash`
+    // must be the value that the hasher of this table gives for `key`.
+    [[nodiscard]] constexpr OpaqueIndexType opaque_index_of(const K& key,
+                                                            std::uint64_t key_hash) const
+    {
         Bucket::DistAndFingerprintType dist_and_fingerprint =
             Bucket::dist_and_fingerprint_from_hash(key_hash);
         SizeType table_loc = bucket_index_from_hash(key_hash);
@@ -301,6 +308,19 @@ public:
         }
     }
 
+    // Index of the bucket pointing at the present entry `value_index`, probing from its home
+    // bucket, `bucket_index_from_hash()` of its key. Neither hashes nor compares the key.
+    [[nodiscard]] constexpr OpaqueIndexType opaque_index_of_iterated(
+        const OpaqueIteratedType& value_index, SizeType home_bucket_index) const
+    {
+        SizeType table_loc = home_bucket_index;
+        while (bucket_at(table_loc).value_index_ != value_index)
+        {
+            table_loc = next_bucket_index(table_loc);
+        }
+        return {table_loc, 0};
+    }
+
     [[nodiscard]] constexpr bool exists(const OpaqueIndexType& index) const
     {
         // TODO: should we check if the index makes sense/points to a real place?
@@ -335,6 +355,12 @@ public:
         return {index.bucket_index, 0};
     }
 
+    // Moves the entry to the end of the iteration order, without rehashing or relocating it.
+    constexpr void move_to_back(const OpaqueIteratedType& value_index)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.move_to_back(value_index);
+    }
+
     constexpr OpaqueIteratedType erase(const OpaqueIndexType& index)
     {
         const SizeType value_index = bucket_at(index.bucket_index).value_index_;
@@ -2,6 +2,7 @@
 
 #include "fixed_containers/assert_or_abort.hpp"
 #include "fixed_containers/bidirectional_iterator.hpp"
+#include "fixed_containers/checking_hooks.hpp"
 #include "fixed_containers/concepts.hpp"
 #include "fixed_containers/erase_if.hpp"
 #include "fixed_containers/fixed_red_black_tree.hpp"
@@ -192,7 +193,12 @@ public:
     [[nodiscard]] constexpr std::size_t size() const noexcept { return tree().size(); }
     [[nodiscard]] constexpr bool empty() const noexcept { return tree().empty(); }
 
-    constexpr void clear() noexcept { tree().clear(); }
+    constexpr void clear() noexcept
+    {
+        const std::size_t previous_size = size();
+        tree().clear();
+        record_erase(previous_size);
+    }
 
     constexpr std::pair<const_iterator, bool> insert(
         const K& value,
@@ -207,6 +213,7 @@ public:
 
         check_not_full(loc);
         tree().insert_new_at(np_idxs, value);
+        record_insert();
         return {create_const_iterator(np_idxs.i), true};
     }
     constexpr std::pair<const_iterator, bool> insert(
@@ -222,6 +229,7 @@ public:
 
         check_not_full(loc);
         tree().insert_new_at(np_idxs, std::move(value));
+        record_insert();
         return {create_const_iterator(np_idxs.i), true};
     }
     constexpr const_iterator insert(const_iterator /*hint*/,
@@ -274,6 +282,7 @@ public:
         const NodeIndex index = get_node_index_from_iterator(pos);
         assert_or_abort(tree().contains_at(index));
         const NodeIndex successor_index = tree().delete_at_and_return_successor(index);
+        record_erase(1);
         return create_const_iterator(successor_index);
     }
 
@@ -284,16 +293,24 @@ public:
             first == cend() ? NULL_INDEX : get_node_index_from_iterator(first);
         const NodeIndex to_idx = last == cend() ? NULL_INDEX : get_node_index_from_iterator(last);
 
+        const std::size_t previous_size = size();
         const NodeIndex successor_index =
             tree().delete_range_and_return_successor(from_idx, to_idx);
+        record_erase(previous_size - size());
         return create_const_iterator(successor_index);
     }
 
-    constexpr size_type erase(const K& key) noexcept { return tree().delete_node(key); }
+    constexpr size_type erase(const K& key) noexcept
+    {
+        const size_type removed_count = tree().delete_node(key);
+        record_erase(removed_count);
+        return removed_count;
+    }
 
     [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
     {
         const NodeIndex index = tree().index_of_node_or_null(key);
+        record_lookup();
         if (!tree().contains_at(index))
         {
             return this->cend();
@@ -307,6 +324,7 @@ public:
         requires IsTransparent<Compare>
     {
         const NodeIndex index = tree().index_of_node_or_null(key);
+        record_lookup();
         if (!tree().contains_at(index))
         {
             return this->cend();
@@ -317,6 +335,7 @@ public:
 
     [[nodiscard]] constexpr bool contains(const K& key) const noexcept
     {
+        record_lookup();
         return tree().contains_node(key);
     }
 
@@ -324,6 +343,7 @@ public:
     [[nodiscard]] constexpr bool contains(const K0& key) const noexcept
         requires IsTransparent<Compare>
     {
+        record_lookup();
         return tree().contains_node(key);
     }
 
@@ -446,6 +466,16 @@ private:
         }
     }
 
+    constexpr void record_insert() const { checking_hooks::record_insert<CheckingType>(1, size()); }
+    constexpr void record_erase(const std::size_t count) const
+    {
+        if (count > 0)
+        {
+            checking_hooks::record_erase<CheckingType>(count, size());
+        }
+    }
+    constexpr void record_lookup() const { checking_hooks::record_lookup<CheckingType>(); }
+
     [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range_impl(
         const NodeIndexAndParentIndex& np_idxs) const noexcept
     {
@@ -1,12 +1,18 @@
 #pragma once
 
 #include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/checking_hooks.hpp"
 #include "fixed_containers/erase_if.hpp"
 #include "fixed_containers/forward_iterator.hpp"
 #include "fixed_containers/preconditions.hpp"
 #include "fixed_containers/source_location.hpp"
 
 #include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <memory>
 
 namespace fixed_containers
@@ -27,6 +33,10 @@ private:
     using TableIndex = typename TableImpl::OpaqueIndexType;
     using TableIteratedIndex = typename TableImpl::OpaqueIteratedType;
 
+    // Keys hashed ahead by the range `insert()`. The hashes don't depend on each other, so
+    // computing them back to back keeps several in flight at once.
+    static constexpr std::size_t HASH_BATCH_SIZE = 16;
+
     class ReferenceProvider
     {
         friend class FixedSetAdapter;
@@ -68,6 +78,7 @@ public:
 
     using size_type = std::size_t;
     using difference_type = ptrdiff_t;
+    using hasher = typename TableImpl::HashType;
 
 public:
     static constexpr size_type static_max_size() noexcept { return TableImpl::CAPACITY; }
@@ -109,7 +120,17 @@ public:
     [[nodiscard]] constexpr std::size_t size() const noexcept { return table().size(); }
     [[nodiscard]] constexpr bool empty() const noexcept { return table().size() == 0; }
 
-    constexpr void clear() noexcept { table().clear(); }
+    [[nodiscard]] constexpr hasher hash_function() const
+    {
+        return table().IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_;
+    }
+
+    constexpr void clear() noexcept
+    {
+        const std::size_t previous_size = size();
+        table().clear();
+        record_erase(previous_size);
+    }
 
     constexpr std::pair<iterator, bool> insert(
         const K& value,
@@ -124,6 +145,7 @@ public:
 
         check_not_full(loc);
         idx = table().emplace(idx, value);
+        record_insert();
         return {create_const_iterator(idx), true};
     }
 
@@ -140,6 +162,7 @@ public:
 
         check_not_full(loc);
         idx = table().emplace(idx, std::move(value));
+        record_insert();
         return {create_const_iterator(idx), true};
     }
 
@@ -165,9 +188,33 @@ public:
                           const std_transition::source_location& loc =
                               std_transition::source_location::current()) noexcept
     {
-        for (; first != last; std::advance(first, 1))
+        // Keys of exactly the key type are hashed ahead, so that the hash is the one the table
+        // would compute.
+        if constexpr (std::forward_iterator<InputIt> && std::same_as<std::iter_value_t<InputIt>, K>)
+        {
+            std::array<std::uint64_t, HASH_BATCH_SIZE> hashes{};
+            while (first != last)
+            {
+                std::size_t batch_size = 0;
+                for (InputIt it = first; batch_size < HASH_BATCH_SIZE && it != last;
+                     std::advance(it, 1))
+                {
+                    hashes[batch_size] = table().hash(*it);
+                    ++batch_size;
+                }
+                for (std::size_t i = 0; i < batch_size; i++)
+                {
+                    insert_with_hash(*first, hashes[i], loc);
+                    std::advance(first, 1);
+                }
+            }
+        }
+        else
         {
-            this->insert(*first, loc);
+            for (; first != last; std::advance(first, 1))
+            {
+                this->insert(*first, loc);
+            }
         }
     }
 
@@ -189,6 +236,7 @@ public:
 
         check_not_full(std_transition::source_location::current());
         idx = table().emplace(idx, key, std::forward<Args>(args)...);
+        record_insert();
         return {create_const_iterator(idx), true};
     }
 
@@ -203,6 +251,7 @@ public:
 
         check_not_full(std_transition::source_location::current());
         idx = table().emplace(idx, std::move(key), std::forward<Args>(args)...);
+        record_insert();
         return {create_const_iterator(idx), true};
     }
 
@@ -242,6 +291,7 @@ public:
         const TableIndex idx = table().opaque_index_of(*pos);
         assert_or_abort(table().exists(idx));
         const TableIteratedIndex next_idx = table().erase(idx);
+        record_erase(1);
         return iterator{ReferenceProvider{std::addressof(table()), next_idx}};
     }
 
@@ -251,8 +301,10 @@ public:
             first.template private_reference_provider<const ReferenceProvider&>();
         const ReferenceProvider& end =
             last.template private_reference_provider<const ReferenceProvider&>();
+        const std::size_t previous_size = size();
         const TableIteratedIndex next_idx =
             table().erase_range(start.current_index_, end.current_index_);
+        record_erase(previous_size - size());
         return iterator{ReferenceProvider{std::addressof(table()), next_idx}};
     }
 
@@ -264,18 +316,34 @@ public:
             return 0;
         }
         table().erase(idx);
+        record_erase(1);
         return 1;
     }
 
     [[nodiscard]] constexpr iterator find(const K& key) noexcept
     {
-        TableIndex idx = table().opaque_index_of(key);
-        return create_checked_iterator(idx);
+        return find(key, table().hash(key));
     }
 
     [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
     {
-        const TableIndex idx = table().opaque_index_of(key);
+        return find(key, table().hash(key));
+    }
+
+    // The following take the hash of `key`, for callers that hashed their keys up front (e.g. with
+    // `wyhash::hash_batch()`). `key_hash` must be `hash_function()(key)`.
+    [[nodiscard]] constexpr iterator find(const K& key, const std::uint64_t key_hash) noexcept
+    {
+        TableIndex idx = table().opaque_index_of(key, key_hash);
+        record_lookup();
+        return create_checked_iterator(idx);
+    }
+
+    [[nodiscard]] constexpr const_iterator find(const K& key,
+                                                const std::uint64_t key_hash) const noexcept
+    {
+        const TableIndex idx = table().opaque_index_of(key, key_hash);
+        record_lookup();
         if (!table().exists(idx))
         {
             return cend();
@@ -287,7 +355,13 @@ public:
 
     [[nodiscard]] constexpr bool contains(const K& key) const noexcept
     {
-        const TableIndex idx = table().opaque_index_of(key);
+        return contains(key, table().hash(key));
+    }
+
+    [[nodiscard]] constexpr bool contains(const K& key, const std::uint64_t key_hash) const noexcept
+    {
+        const TableIndex idx = table().opaque_index_of(key, key_hash);
+        record_lookup();
         return table().exists(idx);
     }
 
@@ -309,6 +383,22 @@ public:
     }
 
 private:
+    template <typename Key>
+    constexpr void insert_with_hash(Key&& key,
+                                    const std::uint64_t key_hash,
+                                    const std_transition::source_location& loc)
+    {
+        const TableIndex idx = table().opaque_index_of(key, key_hash);
+        if (table().exists(idx))
+        {
+            return;
+        }
+
+        check_not_full(loc);
+        table().emplace(idx, std::forward<Key>(key));
+        record_insert();
+    }
+
     constexpr iterator create_checked_iterator(const TableIndex& index) noexcept
     {
         // check for nonexistent indices and replace them with end() so the iterator compares
@@ -334,6 +424,16 @@ private:
             CheckingType::length_error(TableImpl::CAPACITY + 1, loc);
         }
     }
+
+    constexpr void record_insert() const { checking_hooks::record_insert<CheckingType>(1, size()); }
+    constexpr void record_erase(const std::size_t count) const
+    {
+        if (count > 0)
+        {
+            checking_hooks::record_erase<CheckingType>(count, size());
+        }
+    }
+    constexpr void record_lookup() const { checking_hooks::record_lookup<CheckingType>(); }
 };
 
 template <typename K, typename TableImpl, typename CheckingType>
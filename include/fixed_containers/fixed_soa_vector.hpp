@@ -0,0 +1,818 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/checking_hooks.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/iterator_utils.hpp"
+#include "fixed_containers/memory.hpp"
+#include "fixed_containers/optional_storage.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/random_access_iterator.hpp"
+#include "fixed_containers/reflection.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
+#include "fixed_containers/source_location.hpp"
+#include "fixed_containers/struct_decomposition.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::fixed_soa_vector_detail
+{
+template <typename S>
+inline constexpr std::size_t FIELD_COUNT = reflection::field_count_of<S>();
+
+template <typename S>
+constexpr auto field_types_of()
+{
+    S instance{};
+    return struct_decomposition::to_parameter_pack<FIELD_COUNT<S>>(
+        instance,
+        []<typename... Fields>(Fields&... /*fields*/)
+        { return std::type_identity<std::tuple<std::remove_cv_t<Fields>...>>{}; });
+}
+
+// std::tuple<Field0, Field1, ...> of the direct fields of S
+template <typename S>
+using FieldTypes = typename decltype(field_types_of<S>())::type;
+
+// Raw storage, like `FixedVector`: the size is kept once for all columns by `FixedSoaVector`.
+// `OptionalStorageTransparent` makes the column a consecutive block of `Field`s for simple types,
+// so that `column<I>()` can be iterated at compile-time.
+template <std::size_t I, typename Field, std::size_t MAXIMUM_SIZE>
+struct Column
+{
+    using OptionalT = optional_storage_detail::OptionalStorageTransparent<Field>;
+    std::array<OptionalT, MAXIMUM_SIZE> values;
+};
+
+// Not using `std::tuple`, as it is not trivially copyable even when all of its elements are.
+template <typename IndexSequence, typename FieldTypesTuple, std::size_t MAXIMUM_SIZE>
+struct Columns;
+template <std::size_t... INDICES, typename... Fields, std::size_t MAXIMUM_SIZE>
+struct Columns<std::index_sequence<INDICES...>, std::tuple<Fields...>, MAXIMUM_SIZE>
+  : public Column<INDICES, Fields, MAXIMUM_SIZE>...
+{
+    template <std::size_t I>
+    using ColumnType = Column<I, std::tuple_element_t<I, std::tuple<Fields...>>, MAXIMUM_SIZE>;
+
+    template <std::size_t I>
+    constexpr auto& get() noexcept
+    {
+        return static_cast<ColumnType<I>&>(*this).values;
+    }
+    template <std::size_t I>
+    [[nodiscard]] constexpr const auto& get() const noexcept
+    {
+        return static_cast<const ColumnType<I>&>(*this).values;
+    }
+};
+
+template <typename S>
+constexpr auto tie_fields(S& instance)
+{
+    return struct_decomposition::to_parameter_pack<FIELD_COUNT<std::remove_const_t<S>>>(
+        instance, []<typename... Fields>(Fields&... fields) { return std::tie(fields...); });
+}
+
+// Proxy for one row. Reads assemble an `S` from the columns, writes scatter an `S` into them.
+template <typename SoaVector, bool IS_CONST>
+class FixedSoaVectorReference
+{
+    friend class FixedSoaVectorReference<SoaVector, !IS_CONST>;
+    using ConstOrMutableSoaVector = std::conditional_t<IS_CONST, const SoaVector, SoaVector>;
+    using value_type = typename SoaVector::value_type;
+    static constexpr std::size_t FIELD_COUNT = SoaVector::field_count();
+
+private:
+    ConstOrMutableSoaVector* soa_vector_;
+    std::size_t index_;
+
+public:
+    constexpr FixedSoaVectorReference(ConstOrMutableSoaVector* soa_vector,
+                                      const std::size_t index) noexcept
+      : soa_vector_{soa_vector}
+      , index_{index}
+    {
+    }
+
+    constexpr FixedSoaVectorReference(const FixedSoaVectorReference&) noexcept = default;
+    constexpr FixedSoaVectorReference(FixedSoaVectorReference&&) noexcept = default;
+    template <bool IS_CONST_2>
+    constexpr FixedSoaVectorReference(
+        const FixedSoaVectorReference<SoaVector, IS_CONST_2>& mutable_other) noexcept
+        requires(IS_CONST and !IS_CONST_2)
+      : FixedSoaVectorReference{mutable_other.soa_vector_, mutable_other.index_}
+    {
+    }
+
+    // Assignment writes through to the row, like assigning to a `T&` would.
+    constexpr const FixedSoaVectorReference& operator=(const value_type& value) const
+        requires(!IS_CONST)
+    {
+        assign_from(tie_fields(value), std::make_index_sequence<FIELD_COUNT>{});
+        return *this;
+    }
+    constexpr const FixedSoaVectorReference& operator=(value_type&& value) const
+        requires(!IS_CONST)
+    {
+        auto fields = tie_fields(value);
+        move_assign_from(fields, std::make_index_sequence<FIELD_COUNT>{});
+        return *this;
+    }
+    template <bool IS_CONST_2>
+    constexpr const FixedSoaVectorReference& operator=(
+        const FixedSoaVectorReference<SoaVector, IS_CONST_2>& other) const
+        requires(!IS_CONST)
+    {
+        return *this = other.get();
+    }
+    constexpr const FixedSoaVectorReference& operator=(const FixedSoaVectorReference& other) const
+        requires(!IS_CONST)
+    {
+        return *this = other.get();
+    }
+    constexpr FixedSoaVectorReference& operator=(const FixedSoaVectorReference&)
+        requires(IS_CONST)
+    = delete;
+    constexpr ~FixedSoaVectorReference() noexcept = default;
+
+    template <std::size_t I>
+    [[nodiscard]] constexpr auto& get() const
+    {
+        return soa_vector_->template column<I>()[index_];
+    }
+
+    [[nodiscard]] constexpr value_type get() const
+    {
+        return get_impl(std::make_index_sequence<FIELD_COUNT>{});
+    }
+    constexpr operator value_type() const { return get(); }  // NOLINT(google-explicit-constructor)
+
+    template <bool IS_CONST_2>
+    constexpr bool operator==(const FixedSoaVectorReference<SoaVector, IS_CONST_2>& other) const
+    {
+        return fields_equal(other, std::make_index_sequence<FIELD_COUNT>{});
+    }
+
+private:
+    template <std::size_t... INDICES>
+    constexpr value_type get_impl(std::index_sequence<INDICES...> /*unused*/) const
+    {
+        return value_type{get<INDICES>()...};
+    }
+
+    template <typename Tuple, std::size_t... INDICES>
+    constexpr void assign_from(const Tuple& fields,
+                               std::index_sequence<INDICES...> /*unused*/) const
+    {
+        ((get<INDICES>() = std::get<INDICES>(fields)), ...);
+    }
+    template <typename Tuple, std::size_t... INDICES>
+    constexpr void move_assign_from(Tuple& fields, std::index_sequence<INDICES...> /*unused*/) const
+    {
+        ((get<INDICES>() = std::move(std::get<INDICES>(fields))), ...);
+    }
+
+    template <bool IS_CONST_2, std::size_t... INDICES>
+    constexpr bool fields_equal(const FixedSoaVectorReference<SoaVector, IS_CONST_2>& other,
+                                std::index_sequence<INDICES...> /*unused*/) const
+    {
+        return ((get<INDICES>() == other.template get<INDICES>()) && ...);
+    }
+};
+
+}  // namespace fixed_containers::fixed_soa_vector_detail
+
+namespace fixed_containers::fixed_soa_vector_detail
+{
+// [WORKAROUND-1] due to destructors: manually do the split with template specialization, like
+// `FixedVector`. FixedSoaVectorBase is only used for avoiding too much duplication for the split.
+template <typename S, std::size_t MAXIMUM_SIZE, customize::SequenceContainerChecking CheckingType>
+class FixedSoaVectorBase
+{
+    static_assert(std::is_aggregate_v<S>, "FixedSoaVector requires an aggregate value_type");
+    static_assert(reflection::Reflectable<S>,
+                  "FixedSoaVector requires a value_type that supports reflection");
+
+    using Self = FixedSoaVectorBase<S, MAXIMUM_SIZE, CheckingType>;
+    using Checking = CheckingType;
+    using FieldTypes = fixed_soa_vector_detail::FieldTypes<S>;
+    static constexpr std::size_t FIELD_COUNT = fixed_soa_vector_detail::FIELD_COUNT<S>;
+    using Columns = fixed_soa_vector_detail::
+        Columns<std::make_index_sequence<FIELD_COUNT>, FieldTypes, MAXIMUM_SIZE>;
+
+public:
+    using value_type = S;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = fixed_soa_vector_detail::FixedSoaVectorReference<Self, false>;
+    using const_reference = fixed_soa_vector_detail::FixedSoaVectorReference<Self, true>;
+    template <std::size_t I>
+    using field_type = std::tuple_element_t<I, FieldTypes>;
+
+private:
+    template <bool IS_CONST>
+    class ReferenceProvider
+    {
+        friend class ReferenceProvider<!IS_CONST>;
+        using ConstOrMutableSelf = std::conditional_t<IS_CONST, const Self, Self>;
+
+    private:
+        ConstOrMutableSelf* soa_vector_;
+        std::size_t current_index_;
+
+    public:
+        constexpr ReferenceProvider() noexcept
+          : ReferenceProvider{nullptr, 0}
+        {
+        }
+
+        constexpr ReferenceProvider(ConstOrMutableSelf* const soa_vector,
+                                    const std::size_t current_index) noexcept
+          : soa_vector_{soa_vector}
+          , current_index_{current_index}
+        {
+        }
+
+        // https://github.com/llvm/llvm-project/issues/62555
+        template <bool IS_CONST_2>
+        constexpr ReferenceProvider(const ReferenceProvider<IS_CONST_2>& mutable_other) noexcept
+            requires(IS_CONST and !IS_CONST_2)
+          : ReferenceProvider{mutable_other.soa_vector_, mutable_other.current_index_}
+        {
+        }
+
+        constexpr void advance(const std::size_t n) noexcept { current_index_ += n; }
+        constexpr void recede(const std::size_t n) noexcept { current_index_ -= n; }
+
+        [[nodiscard]] constexpr std::conditional_t<IS_CONST, const_reference, reference> get()
+            const noexcept
+        {
+            return {soa_vector_, current_index_};
+        }
+
+        template <bool IS_CONST2>
+        constexpr bool operator==(const ReferenceProvider<IS_CONST2>& other) const noexcept
+        {
+            assert_or_abort(soa_vector_ == other.soa_vector_);
+            return current_index_ == other.current_index_;
+        }
+        template <bool IS_CONST2>
+        constexpr auto operator<=>(const ReferenceProvider<IS_CONST2>& other) const noexcept
+        {
+            assert_or_abort(soa_vector_ == other.soa_vector_);
+            return current_index_ <=> other.current_index_;
+        }
+
+        template <bool IS_CONST2>
+        constexpr std::ptrdiff_t operator-(const ReferenceProvider<IS_CONST2>& other) const
+        {
+            assert_or_abort(soa_vector_ == other.soa_vector_);
+            return static_cast<std::ptrdiff_t>(current_index_ - other.current_index_);
+        }
+    };
+
+    template <IteratorConstness CONSTNESS, IteratorDirection DIRECTION>
+    using Iterator = RandomAccessIterator<ReferenceProvider<true>,
+                                          ReferenceProvider<false>,
+                                          CONSTNESS,
+                                          DIRECTION>;
+
+public:
+    using const_iterator =
+        Iterator<IteratorConstness::CONSTANT_ITERATOR, IteratorDirection::FORWARD>;
+    using iterator = Iterator<IteratorConstness::MUTABLE_ITERATOR, IteratorDirection::FORWARD>;
+    using const_reverse_iterator =
+        Iterator<IteratorConstness::CONSTANT_ITERATOR, IteratorDirection::REVERSE>;
+    using reverse_iterator =
+        Iterator<IteratorConstness::MUTABLE_ITERATOR, IteratorDirection::REVERSE>;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+    [[nodiscard]] static constexpr std::size_t field_count() noexcept { return FIELD_COUNT; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    Columns IMPLEMENTATION_DETAIL_DO_NOT_USE_columns_;
+
+public:
+    constexpr FixedSoaVectorBase() noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_size_{0}
+    // Don't initialize the columns
+    {
+        // A constexpr context requires everything to be initialized. The OptionalStorage wrapper
+        // takes care of that, but initialize the columns of unwrapped fields. See `FixedVector`.
+        if (std::is_constant_evaluated())
+        {
+            for_each_column_index(
+                [&]<std::size_t I>()
+                {
+                    using OptionalT = typename Columns::template ColumnType<I>::OptionalT;
+                    if constexpr (!std::same_as<OptionalT,
+                                                optional_storage_detail::OptionalStorage<
+                                                    field_type<I>>>)
+                    {
+                        memory::construct_at_address_of(columns().template get<I>());
+                    }
+                });
+        }
+    }
+
+    constexpr FixedSoaVectorBase(std::initializer_list<S> list,
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) noexcept
+      : FixedSoaVectorBase()
+    {
+        check_target_size(list.size(), loc);
+        for (const S& entry : list)
+        {
+            push_back_internal(entry);
+        }
+    }
+
+    /**
+     * The contiguous storage of the I-th field of every element.
+     */
+    template <std::size_t I>
+    constexpr std::span<field_type<I>> column() noexcept
+    {
+        if constexpr (MAXIMUM_SIZE == 0)
+        {
+            return {};
+        }
+        else
+        {
+            return {
+                std::addressof(optional_storage_detail::get(*columns().template get<I>().data())),
+                size()};
+        }
+    }
+    template <std::size_t I>
+    [[nodiscard]] constexpr std::span<const field_type<I>> column() const noexcept
+    {
+        if constexpr (MAXIMUM_SIZE == 0)
+        {
+            return {};
+        }
+        else
+        {
+            return {
+                std::addressof(optional_storage_detail::get(*columns().template get<I>().data())),
+                size()};
+        }
+    }
+
+    constexpr void push_back(
+        const value_type& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_full(loc);
+        push_back_internal(value);
+    }
+    constexpr void push_back(
+        value_type&& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_full(loc);
+        push_back_internal(std::move(value));
+    }
+
+    constexpr void pop_back(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_empty(loc);
+        destroy_row(size() - 1);
+        decrement_size();
+    }
+
+    constexpr void resize(
+        size_type count,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_target_size(count, loc);
+
+        // Reinitialize the new members if we are enlarging
+        const value_type value{};
+        while (size() < count)
+        {
+            push_back_internal(value);
+        }
+        // Destroy extras if we are making it smaller.
+        while (size() > count)
+        {
+            destroy_row(size() - 1);
+            decrement_size();
+        }
+    }
+
+    constexpr iterator erase(const_iterator pos,
+                             const std_transition::source_location& loc =
+                                 std_transition::source_location::current()) noexcept
+    {
+        const auto index = static_cast<std::size_t>(std::distance(cbegin(), pos));
+        if (preconditions::test(index < size()))
+        {
+            Checking::out_of_range(index, size(), loc);
+        }
+        for_each_column_index(
+            [&]<std::size_t I>()
+            {
+                for (std::size_t i = index; i + 1 < size(); i++)
+                {
+                    unchecked_at<I>(i) = std::move(unchecked_at<I>(i + 1));
+                }
+            });
+        destroy_row(size() - 1);
+        decrement_size();
+        return std::next(begin(), static_cast<std::ptrdiff_t>(index));
+    }
+
+    constexpr void clear() noexcept
+    {
+        for (std::size_t i = 0; i < size(); i++)
+        {
+            destroy_row(i);
+        }
+        decrement_size(size());
+    }
+
+    constexpr reference operator[](size_type index) noexcept
+    {
+        // Cannot capture real source_location for operator[]
+        // This operator should not range-check according to the spec, but we want the extra safety.
+        return at(index, std_transition::source_location::current());
+    }
+    constexpr const_reference operator[](size_type index) const noexcept
+    {
+        // Cannot capture real source_location for operator[]
+        // This operator should not range-check according to the spec, but we want the extra safety.
+        return at(index, std_transition::source_location::current());
+    }
+
+    constexpr reference at(size_type index,
+                           const std_transition::source_location& loc =
+                               std_transition::source_location::current()) noexcept
+    {
+        if (preconditions::test(index < size()))
+        {
+            Checking::out_of_range(index, size(), loc);
+        }
+        return {this, index};
+    }
+    [[nodiscard]] constexpr const_reference at(
+        size_type index,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const noexcept
+    {
+        if (preconditions::test(index < size()))
+        {
+            Checking::out_of_range(index, size(), loc);
+        }
+        return {this, index};
+    }
+
+    constexpr reference front(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_empty(loc);
+        return {this, 0};
+    }
+    [[nodiscard]] constexpr const_reference front(
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        check_not_empty(loc);
+        return {this, 0};
+    }
+    constexpr reference back(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_empty(loc);
+        return {this, size() - 1};
+    }
+    [[nodiscard]] constexpr const_reference back(
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        check_not_empty(loc);
+        return {this, size() - 1};
+    }
+
+    constexpr iterator begin() noexcept { return create_iterator(0); }
+    [[nodiscard]] constexpr const_iterator begin() const noexcept { return cbegin(); }
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept
+    {
+        return create_const_iterator(0);
+    }
+    constexpr iterator end() noexcept { return create_iterator(size()); }
+    [[nodiscard]] constexpr const_iterator end() const noexcept { return cend(); }
+    [[nodiscard]] constexpr const_iterator cend() const noexcept
+    {
+        return create_const_iterator(size());
+    }
+
+    constexpr reverse_iterator rbegin() noexcept { return reverse_iterator{this, size()}; }
+    [[nodiscard]] constexpr const_reverse_iterator rbegin() const noexcept { return crbegin(); }
+    [[nodiscard]] constexpr const_reverse_iterator crbegin() const noexcept
+    {
+        return const_reverse_iterator{this, size()};
+    }
+    constexpr reverse_iterator rend() noexcept { return reverse_iterator{this, 0}; }
+    [[nodiscard]] constexpr const_reverse_iterator rend() const noexcept { return crend(); }
+    [[nodiscard]] constexpr const_reverse_iterator crend() const noexcept
+    {
+        return const_reverse_iterator{this, 0};
+    }
+
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+    [[nodiscard]] constexpr std::size_t capacity() const noexcept { return max_size(); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+
+    template <std::size_t MAXIMUM_SIZE_2, customize::SequenceContainerChecking CheckingType2>
+    constexpr bool operator==(
+        const FixedSoaVectorBase<S, MAXIMUM_SIZE_2, CheckingType2>& other) const
+    {
+        if (size() != other.size())
+        {
+            return false;
+        }
+        bool out = true;
+        for_each_column_index(
+            [&]<std::size_t I>()
+            { out = out && std::ranges::equal(column<I>(), other.template column<I>()); });
+        return out;
+    }
+
+private:
+    constexpr Columns& columns() noexcept { return IMPLEMENTATION_DETAIL_DO_NOT_USE_columns_; }
+    [[nodiscard]] constexpr const Columns& columns() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_columns_;
+    }
+
+    template <std::size_t I>
+    [[nodiscard]] constexpr const field_type<I>& unchecked_at(const std::size_t index) const
+    {
+        return optional_storage_detail::get(columns().template get<I>()[index]);
+    }
+    template <std::size_t I>
+    constexpr field_type<I>& unchecked_at(const std::size_t index)
+    {
+        return optional_storage_detail::get(columns().template get<I>()[index]);
+    }
+
+    template <typename Func>
+    static constexpr void for_each_column_index(Func&& func)
+    {
+        [&func]<std::size_t... INDICES>(std::index_sequence<INDICES...> /*unused*/)
+        {
+            (func.template operator()<INDICES>(), ...);
+        }(std::make_index_sequence<FIELD_COUNT>{});
+    }
+
+    constexpr void increment_size(const std::size_t n = 1)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ += n;
+        checking_hooks::record_insert<Checking>(n, size());
+    }
+    constexpr void decrement_size(const std::size_t n = 1)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ -= n;
+        checking_hooks::record_erase<Checking>(n, size());
+    }
+
+    constexpr void destroy_row(const std::size_t index)
+    {
+        for_each_column_index(
+            [&]<std::size_t I>()
+            {
+                if constexpr (NotTriviallyDestructible<field_type<I>>)
+                {
+                    memory::destroy_at_address_of(unchecked_at<I>(index));
+                }
+            });
+    }
+
+    constexpr iterator create_iterator(const std::size_t index) noexcept
+    {
+        return iterator{this, index};
+    }
+    [[nodiscard]] constexpr const_iterator create_const_iterator(
+        const std::size_t index) const noexcept
+    {
+        return const_iterator{this, index};
+    }
+
+    static constexpr void check_target_size(size_type target_size,
+                                            const std_transition::source_location& loc)
+    {
+        if (preconditions::test(target_size <= MAXIMUM_SIZE))
+        {
+            Checking::length_error(target_size, loc);
+        }
+    }
+    constexpr void check_not_full(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(size() < MAXIMUM_SIZE))
+        {
+            Checking::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+    constexpr void check_not_empty(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(!empty()))
+        {
+            Checking::empty_container_access(loc);
+        }
+    }
+
+    // [WORKAROUND-1] - Needed by the non-trivially-copyable flavor of FixedSoaVector
+protected:
+    constexpr void push_back_internal(const value_type& value)
+    {
+        const auto fields = fixed_soa_vector_detail::tie_fields(value);
+        for_each_column_index(
+            [&]<std::size_t I>()
+            { memory::construct_at_address_of(unchecked_at<I>(size()), std::get<I>(fields)); });
+        increment_size();
+    }
+    constexpr void push_back_internal(value_type&& value)
+    {
+        auto fields = fixed_soa_vector_detail::tie_fields(value);
+        for_each_column_index(
+            [&]<std::size_t I>()
+            {
+                memory::construct_at_address_of(unchecked_at<I>(size()),
+                                                std::move(std::get<I>(fields)));
+            });
+        increment_size();
+    }
+
+    constexpr void append_rows_from(const FixedSoaVectorBase& other)
+    {
+        for_each_column_index(
+            [&]<std::size_t I>()
+            {
+                for (std::size_t i = 0; i < other.size(); i++)
+                {
+                    memory::construct_at_address_of(unchecked_at<I>(size() + i),
+                                                    other.template unchecked_at<I>(i));
+                }
+            });
+        increment_size(other.size());
+    }
+    constexpr void append_rows_from(FixedSoaVectorBase&& other)
+    {
+        for_each_column_index(
+            [&]<std::size_t I>()
+            {
+                for (std::size_t i = 0; i < other.size(); i++)
+                {
+                    memory::construct_at_address_of(
+                        unchecked_at<I>(size() + i),
+                        std::move(other.template unchecked_at<I>(i)));
+                }
+            });
+        increment_size(other.size());
+    }
+};
+
+}  // namespace fixed_containers::fixed_soa_vector_detail
+
+namespace fixed_containers::fixed_soa_vector_detail::specializations
+{
+template <typename S, std::size_t MAXIMUM_SIZE, customize::SequenceContainerChecking CheckingType>
+class FixedSoaVector
+  : public fixed_soa_vector_detail::FixedSoaVectorBase<S, MAXIMUM_SIZE, CheckingType>
+{
+    using Base = fixed_soa_vector_detail::FixedSoaVectorBase<S, MAXIMUM_SIZE, CheckingType>;
+
+public:
+    constexpr FixedSoaVector() noexcept
+      : Base()
+    {
+    }
+    constexpr FixedSoaVector(std::initializer_list<S> list,
+                             const std_transition::source_location& loc =
+                                 std_transition::source_location::current()) noexcept
+      : Base(list, loc)
+    {
+    }
+
+    constexpr FixedSoaVector(const FixedSoaVector& other)
+      : FixedSoaVector()
+    {
+        this->append_rows_from(other);
+    }
+    constexpr FixedSoaVector(FixedSoaVector&& other) noexcept
+      : FixedSoaVector()
+    {
+        this->append_rows_from(std::move(other));
+        // Clear the moved-out-of-vector, like `FixedVector`.
+        other.clear();
+    }
+    constexpr FixedSoaVector& operator=(const FixedSoaVector& other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        this->clear();
+        this->append_rows_from(other);
+        return *this;
+    }
+    constexpr FixedSoaVector& operator=(FixedSoaVector&& other) noexcept
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        this->clear();
+        this->append_rows_from(std::move(other));
+        return *this;
+    }
+
+    constexpr ~FixedSoaVector() noexcept { this->clear(); }
+};
+
+template <TriviallyCopyable S,
+          std::size_t MAXIMUM_SIZE,
+          customize::SequenceContainerChecking CheckingType>
+class FixedSoaVector<S, MAXIMUM_SIZE, CheckingType>
+  : public fixed_soa_vector_detail::FixedSoaVectorBase<S, MAXIMUM_SIZE, CheckingType>
+{
+    using Base = fixed_soa_vector_detail::FixedSoaVectorBase<S, MAXIMUM_SIZE, CheckingType>;
+
+public:
+    constexpr FixedSoaVector() noexcept
+      : Base()
+    {
+    }
+    constexpr FixedSoaVector(std::initializer_list<S> list,
+                             const std_transition::source_location& loc =
+                                 std_transition::source_location::current()) noexcept
+      : Base(list, loc)
+    {
+    }
+};
+
+}  // namespace fixed_containers::fixed_soa_vector_detail::specializations
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity vector of structs, with a Structure-of-Arrays layout: each direct field of `S` is
+ * stored in its own contiguous column. Scanning a single field only touches the bytes of that
+ * field, and each column can be handed to vectorized kernels as a span via `column<I>()`.
+ *
+ * `S` must be an aggregate whose fields are known via reflection (see `reflection.hpp`).
+ * Element access returns a proxy that converts to `S` and assigns through to the columns.
+ * Properties:
+ *  - constexpr
+ *  - retains the properties of S (e.g. if S is trivially copyable, then so is FixedSoaVector<S>)
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ */
+template <typename S,
+          std::size_t MAXIMUM_SIZE,
+          customize::SequenceContainerChecking CheckingType =
+              customize::SequenceContainerAbortChecking<S, MAXIMUM_SIZE>>
+class FixedSoaVector
+  : public fixed_soa_vector_detail::specializations::FixedSoaVector<S, MAXIMUM_SIZE, CheckingType>
+{
+    using Base =
+        fixed_soa_vector_detail::specializations::FixedSoaVector<S, MAXIMUM_SIZE, CheckingType>;
+
+public:
+    constexpr FixedSoaVector() noexcept
+      : Base()
+    {
+    }
+    constexpr FixedSoaVector(std::initializer_list<S> list,
+                             const std_transition::source_location& loc =
+                                 std_transition::source_location::current()) noexcept
+      : Base(list, loc)
+    {
+    }
+};
+
+template <typename S, std::size_t MAXIMUM_SIZE, typename CheckingType>
+[[nodiscard]] constexpr bool is_full(const FixedSoaVector<S, MAXIMUM_SIZE, CheckingType>& container)
+{
+    return container.size() >= container.max_size();
+}
+
+}  // namespace fixed_containers
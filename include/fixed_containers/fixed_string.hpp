@@ -6,38 +6,111 @@
 #include "fixed_containers/preconditions.hpp"
 #include "fixed_containers/sequence_container_checking.hpp"
 #include "fixed_containers/source_location.hpp"
+#include "fixed_containers/wyhash.hpp"
 
 #include <array>
+#include <charconv>
+#include <compare>
+#include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <istream>
 #include <string_view>
+#include <system_error>
+#include <utility>
+
+#if __has_include(<format>)
+#include <format>
+#endif
 
 namespace fixed_containers
 {
+// What the characters past the null terminator of a `FixedString` hold.
+enum class FixedStringPadding : bool
+{
+    // Whatever was last written there. Comparisons and hashing only look at `size()` characters.
+    INDETERMINATE,
+    // Always '\0'. Every shrinking mutation clears the characters it removes, and in exchange
+    // equality, ordering and `wyhash::hash` run over the whole fixed capacity a word at a time,
+    // without branching on the length. Best for short strings that are compared often (e.g. keys).
+    ZEROED,
+};
+
+namespace fixed_string_detail
+{
+// Compares two zero-padded buffers of `BYTE_COUNT` characters. The differences are accumulated
+// instead of returning early, so the loop has no data-dependent branches and vectorizes.
+template <std::size_t BYTE_COUNT>
+[[nodiscard]] inline bool zero_padded_equal(const char* lhs,
+                                            std::size_t lhs_length,
+                                            const char* rhs,
+                                            std::size_t rhs_length) noexcept
+{
+    using Word = std::uint64_t;
+    static constexpr std::size_t WORD_COUNT = BYTE_COUNT / sizeof(Word);
+
+    Word difference = static_cast<Word>(lhs_length ^ rhs_length);
+    for (std::size_t i = 0; i < WORD_COUNT; i++)
+    {
+        Word lhs_word{};
+        Word rhs_word{};
+        std::memcpy(&lhs_word, std::next(lhs, static_cast<std::ptrdiff_t>(i * sizeof(Word))),
+                    sizeof(Word));
+        std::memcpy(&rhs_word, std::next(rhs, static_cast<std::ptrdiff_t>(i * sizeof(Word))),
+                    sizeof(Word));
+        difference |= lhs_word ^ rhs_word;
+    }
+    for (std::size_t i = WORD_COUNT * sizeof(Word); i < BYTE_COUNT; i++)
+    {
+        difference |= static_cast<Word>(*std::next(lhs, static_cast<std::ptrdiff_t>(i)) ^
+                                        *std::next(rhs, static_cast<std::ptrdiff_t>(i)));
+    }
+    return difference == 0;
+}
+}  // namespace fixed_string_detail
+
 template <std::size_t MAXIMUM_LENGTH,
           customize::SequenceContainerChecking CheckingType =
-              customize::SequenceContainerAbortChecking<char, MAXIMUM_LENGTH>>
+              customize::SequenceContainerAbortChecking<char, MAXIMUM_LENGTH>,
+          FixedStringPadding PADDING = FixedStringPadding::INDETERMINATE>
 class FixedString
 {
     using Checking = CheckingType;
     using CharT = char;
-    using Self = FixedString<MAXIMUM_LENGTH, Checking>;
+    using Self = FixedString<MAXIMUM_LENGTH, Checking, PADDING>;
     using FixedVecStorage = FixedVector<CharT, MAXIMUM_LENGTH + 1, CheckingType>;
 
+    static constexpr bool IS_ZERO_PADDED = PADDING == FixedStringPadding::ZEROED;
+
+    template <std::size_t MAXIMUM_LENGTH_2,
+              customize::SequenceContainerChecking CheckingType2,
+              FixedStringPadding PADDING_2>
+    static constexpr bool IS_SAME_LAYOUT_ZERO_PADDED =
+        IS_ZERO_PADDED && PADDING_2 == FixedStringPadding::ZEROED &&
+        MAXIMUM_LENGTH_2 == MAXIMUM_LENGTH;
+
+    // Restores the invariants once a mutation is done: the null terminator and, in zero-padded
+    // mode, the characters that the mutation may have removed.
     struct ScopedNullTermination
     {
         Self* self_;
+        std::size_t previous_length_;
         std_transition::source_location loc_;
 
         constexpr ScopedNullTermination(Self* self,
                                         const std_transition::source_location& loc) noexcept
           : self_(self)
+          , previous_length_(self->length())
           , loc_(loc)
         {
         }
 
-        constexpr ~ScopedNullTermination() noexcept { self_->null_terminate(loc_); }
+        constexpr ~ScopedNullTermination() noexcept
+        {
+            self_->null_terminate_after_mutation(previous_length_, loc_);
+        }
     };
 
 public:
@@ -55,6 +128,7 @@ public:
 
 public:
     [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_LENGTH; }
+    [[nodiscard]] static constexpr FixedStringPadding padding() noexcept { return PADDING; }
 
     static constexpr size_type npos =  // NOLINT(readability-identifier-naming)
         std::string_view::npos;
@@ -67,7 +141,7 @@ public:
                               std_transition::source_location::current()) noexcept
       : IMPLEMENTATION_DETAIL_DO_NOT_USE_data_{}
     {
-        null_terminate_at_max_length();
+        initialize_padding();
         null_terminate(loc);
     }
 
@@ -77,7 +151,7 @@ public:
         const std_transition::source_location& loc = std_transition::source_location::current())
       : IMPLEMENTATION_DETAIL_DO_NOT_USE_data_{count, character, loc}
     {
-        null_terminate_at_max_length();
+        initialize_padding();
         null_terminate(loc);
     }
 
@@ -93,7 +167,7 @@ public:
         const std_transition::source_location& loc = std_transition::source_location::current())
       : IMPLEMENTATION_DETAIL_DO_NOT_USE_data_{ilist, loc}
     {
-        null_terminate_at_max_length();
+        initialize_padding();
         null_terminate(loc);
     }
 
@@ -102,7 +176,7 @@ public:
                                               std_transition::source_location::current()) noexcept
       : IMPLEMENTATION_DETAIL_DO_NOT_USE_data_{view.begin(), view.end(), loc}
     {
-        null_terminate_at_max_length();
+        initialize_padding();
         null_terminate(loc);
     }
 
@@ -111,8 +185,8 @@ public:
         CharT character,
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
+        const ScopedNullTermination guard{this, loc};
         vec().assign(count, character, loc);
-        null_terminate(loc);
         return *this;
     }
     template <class InputIt>
@@ -121,24 +195,24 @@ public:
         InputIt last,
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
+        const ScopedNullTermination guard{this, loc};
         vec().assign(first, last, loc);
-        null_terminate(loc);
         return *this;
     }
     constexpr FixedString& assign(
         std::initializer_list<CharT> ilist,
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
+        const ScopedNullTermination guard{this, loc};
         vec().assign(ilist, loc);
-        null_terminate(loc);
         return *this;
     }
     constexpr FixedString& assign(
         const std::string_view& view,
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
+        const ScopedNullTermination guard{this, loc};
         vec().assign(view.begin(), view.end(), loc);
-        null_terminate(loc);
         return *this;
     }
 
@@ -249,8 +323,8 @@ public:
 
     constexpr void clear() noexcept
     {
+        const ScopedNullTermination guard{this, std_transition::source_location::current()};
         vec().clear();
-        null_terminate(std_transition::source_location::current());
     }
 
     constexpr iterator insert(
@@ -330,8 +404,8 @@ public:
     constexpr void pop_back(
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
+        const ScopedNullTermination guard{this, loc};
         vec().pop_back(loc);
-        null_terminate(loc);
     }
 
     template <class InputIt>
@@ -385,6 +459,69 @@ public:
         return append(view, std_transition::source_location::current());
     }
 
+    // The `append_number()` and `append_format()` functions write straight into the unused
+    // capacity, without any intermediate buffer or allocation. If the result does not fit, the
+    // string is left unchanged and the overflow is reported with `Checking::length_error()`.
+
+    // Appends `value` as `std::to_chars()` formats it. `bool` is rejected, like
+    // `std::to_chars()` does.
+    template <typename T>
+        requires(std::integral<T> && !std::same_as<T, bool>)
+    FixedString& append_number(
+        T value,
+        int base = 10,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        const std::size_t previous_length = length();
+        const std::to_chars_result result = std::to_chars(
+            unused_capacity_begin(), unused_capacity_end(), value, base);
+        finish_to_chars(previous_length, result, loc);
+        return *this;
+    }
+    // Shortest representation that round-trips.
+    template <std::floating_point T>
+    FixedString& append_number(
+        T value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        const std::size_t previous_length = length();
+        const std::to_chars_result result =
+            std::to_chars(unused_capacity_begin(), unused_capacity_end(), value);
+        finish_to_chars(previous_length, result, loc);
+        return *this;
+    }
+    template <std::floating_point T>
+    FixedString& append_number(
+        T value,
+        std::chars_format format,
+        int precision,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        const std::size_t previous_length = length();
+        const std::to_chars_result result = std::to_chars(
+            unused_capacity_begin(), unused_capacity_end(), value, format, precision);
+        finish_to_chars(previous_length, result, loc);
+        return *this;
+    }
+
+#if defined(__cpp_lib_format) && __cpp_lib_format >= 201907L
+    // Appends `std::format(fmt, args...)`, via `std::format_to_n()`.
+    template <class... Args>
+    FixedString& append_format(std::format_string<Args...> fmt, Args&&... args)
+    {
+        // Cannot capture real source_location, as it can't follow the parameter pack
+        const std::size_t previous_length = length();
+        const auto result = std::format_to_n(unused_capacity_begin(),
+                                             static_cast<std::ptrdiff_t>(unused_capacity()),
+                                             fmt,
+                                             std::forward<Args>(args)...);
+        finish_append(previous_length,
+                      static_cast<std::size_t>(result.size),
+                      std_transition::source_location::current());
+        return *this;
+    }
+#endif
+
     template <std::size_t MAXIMUM_LENGTH_2, customize::SequenceContainerChecking CheckingType2>
     [[nodiscard]] constexpr size_type find(const FixedString<MAXIMUM_LENGTH_2, CheckingType2>& str,
                                            const size_type pos = 0) const
@@ -572,9 +709,21 @@ public:
         return std::string_view(*this).compare(view);
     }
 
-    template <std::size_t MAXIMUM_LENGTH_2, customize::SequenceContainerChecking CheckingType2>
-    constexpr bool operator==(const FixedString<MAXIMUM_LENGTH_2, CheckingType2>& other) const
+    template <std::size_t MAXIMUM_LENGTH_2,
+              customize::SequenceContainerChecking CheckingType2,
+              FixedStringPadding PADDING_2>
+    constexpr bool operator==(
+        const FixedString<MAXIMUM_LENGTH_2, CheckingType2, PADDING_2>& other) const
     {
+        if constexpr (IS_SAME_LAYOUT_ZERO_PADDED<MAXIMUM_LENGTH_2, CheckingType2, PADDING_2>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                // The character at MAXIMUM_LENGTH is always the terminator, no need to compare it.
+                return fixed_string_detail::zero_padded_equal<MAXIMUM_LENGTH>(
+                    data(), length(), other.data(), other.length());
+            }
+        }
         return as_view() == std::string_view{other};
     }
     constexpr bool operator==(const CharT* other) const
@@ -583,11 +732,27 @@ public:
     }
     constexpr bool operator==(std::string_view view) const noexcept { return as_view() == view; }
 
-    template <std::size_t MAXIMUM_LENGTH_2, customize::SequenceContainerChecking CheckingType2>
+    template <std::size_t MAXIMUM_LENGTH_2,
+              customize::SequenceContainerChecking CheckingType2,
+              FixedStringPadding PADDING_2>
     constexpr std::strong_ordering operator<=>(
-        const FixedString<MAXIMUM_LENGTH_2, CheckingType2>& other) const noexcept
+        const FixedString<MAXIMUM_LENGTH_2, CheckingType2, PADDING_2>& other) const noexcept
     {
-        return as_view() <=> other;
+        if constexpr (IS_SAME_LAYOUT_ZERO_PADDED<MAXIMUM_LENGTH_2, CheckingType2, PADDING_2>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                // The padding sorts before any character, so the first difference in the padded
+                // buffers decides, unless one string is the other followed by '\0's.
+                const int result = std::memcmp(data(), other.data(), MAXIMUM_LENGTH);
+                if (result != 0)
+                {
+                    return result <=> 0;
+                }
+                return length() <=> other.length();
+            }
+        }
+        return as_view() <=> std::string_view{other};
     }
     constexpr std::strong_ordering operator<=>(const CharT* other) const noexcept
     {
@@ -651,11 +816,79 @@ public:
         CharT character,
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
+        const ScopedNullTermination guard{this, loc};
         vec().resize(count, character, loc);
-        null_terminate(loc);
     }
 
 private:
+    [[nodiscard]] constexpr std::size_t unused_capacity() const
+    {
+        return MAXIMUM_LENGTH - length();
+    }
+    constexpr CharT* unused_capacity_begin()
+    {
+        return std::next(data(), static_cast<std::ptrdiff_t>(length()));
+    }
+    constexpr CharT* unused_capacity_end()
+    {
+        return std::next(data(), static_cast<std::ptrdiff_t>(MAXIMUM_LENGTH));
+    }
+
+    // For appends that wrote `appended_length` characters past the end: commits them if they fit.
+    // Otherwise, wipes what was written and reports the overflow.
+    constexpr void finish_append(std::size_t previous_length,
+                                 std::size_t appended_length,
+                                 const std_transition::source_location& loc)
+    {
+        if (preconditions::test(appended_length <= MAXIMUM_LENGTH - previous_length))
+        {
+            if constexpr (IS_ZERO_PADDED)
+            {
+                clear_characters(previous_length, MAXIMUM_LENGTH);
+            }
+            null_terminate(previous_length);
+            Checking::length_error(previous_length + appended_length, loc);
+            return;
+        }
+
+        // The characters are in place already, only the size needs to catch up.
+        vec().resize_for_overwrite(previous_length + appended_length, loc);
+        null_terminate(loc);
+    }
+    constexpr void finish_to_chars(std::size_t previous_length,
+                                   const std::to_chars_result& result,
+                                   const std_transition::source_location& loc)
+    {
+        if (result.ec == std::errc::value_too_large)
+        {
+            // The required length is not known, only that it exceeds the capacity
+            finish_append(previous_length, MAXIMUM_LENGTH + 1 - previous_length, loc);
+            return;
+        }
+        finish_append(previous_length,
+                      static_cast<std::size_t>(std::distance(unused_capacity_begin(), result.ptr)),
+                      loc);
+    }
+
+    constexpr void initialize_padding()
+    {
+        if constexpr (IS_ZERO_PADDED)
+        {
+            clear_characters(length(), MAXIMUM_LENGTH + 1);
+        }
+        else
+        {
+            null_terminate_at_max_length();
+        }
+    }
+    constexpr void clear_characters(std::size_t first, std::size_t last)
+    {
+        for (std::size_t i = first; i < last; i++)
+        {
+            null_terminate(i);
+        }
+    }
+
     constexpr void null_terminate(std::size_t n)
     {
         // This bypasses the vector's bounds check
@@ -672,6 +905,15 @@ private:
 
         null_terminate(length());
     }
+    constexpr void null_terminate_after_mutation(std::size_t previous_length,
+                                                 const std_transition::source_location& loc)
+    {
+        if constexpr (IS_ZERO_PADDED)
+        {
+            clear_characters(length(), previous_length);
+        }
+        null_terminate(loc);
+    }
     constexpr void null_terminate_at_max_length() { null_terminate(MAXIMUM_LENGTH); }
 
     [[nodiscard]] constexpr std::string_view as_view() const { return *this; }
@@ -683,8 +925,9 @@ private:
     constexpr FixedVecStorage& vec() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_data_; }
 };
 
-template <std::size_t MAXIMUM_LENGTH, typename CheckingType>
-std::istream& operator>>(std::istream& stream, FixedString<MAXIMUM_LENGTH, CheckingType>& str)
+template <std::size_t MAXIMUM_LENGTH, typename CheckingType, FixedStringPadding PADDING>
+std::istream& operator>>(std::istream& stream,
+                         FixedString<MAXIMUM_LENGTH, CheckingType, PADDING>& str)
 {
     static constexpr std::size_t MAXIMUM_LENGTH_WITH_NULL_TERMINATOR = MAXIMUM_LENGTH + 1;
     str.clear();
@@ -724,14 +967,16 @@ std::istream& operator>>(std::istream& stream, FixedString<MAXIMUM_LENGTH, Check
 
     return stream;
 }
-template <std::size_t MAXIMUM_LENGTH, typename CheckingType>
-std::ostream& operator<<(std::ostream& stream, const FixedString<MAXIMUM_LENGTH, CheckingType>& str)
+template <std::size_t MAXIMUM_LENGTH, typename CheckingType, FixedStringPadding PADDING>
+std::ostream& operator<<(std::ostream& stream,
+                         const FixedString<MAXIMUM_LENGTH, CheckingType, PADDING>& str)
 {
     return stream << std::string_view{str};
 }
 
-template <std::size_t MAXIMUM_LENGTH, typename CheckingType>
-[[nodiscard]] constexpr bool is_full(const FixedString<MAXIMUM_LENGTH, CheckingType>& container)
+template <std::size_t MAXIMUM_LENGTH, typename CheckingType, FixedStringPadding PADDING>
+[[nodiscard]] constexpr bool is_full(
+    const FixedString<MAXIMUM_LENGTH, CheckingType, PADDING>& container)
 {
     return container.size() >= container.max_size();
 }
@@ -768,23 +1013,91 @@ template <std::size_t MAXIMUM_LENGTH_WITH_NULL_TERMINATOR>
         list, loc);
 }
 
-template <std::size_t MAXIMUM_LENGTH, typename CheckingType>
-constexpr FixedString<MAXIMUM_LENGTH, CheckingType>& append_truncating(
-    FixedString<MAXIMUM_LENGTH, CheckingType>& str, std::string_view view)
+template <std::size_t MAXIMUM_LENGTH, typename CheckingType, FixedStringPadding PADDING>
+constexpr FixedString<MAXIMUM_LENGTH, CheckingType, PADDING>& append_truncating(
+    FixedString<MAXIMUM_LENGTH, CheckingType, PADDING>& str, std::string_view view)
 {
     const std::size_t safe_chars = (std::min)(view.size(), MAXIMUM_LENGTH - str.length());
     str.append(view.substr(0, safe_chars));
     return str;
 }
 
+/**
+ * `std::from_chars()` over the characters of `str`. As with `std::from_chars()`, parsing stops at
+ * the first character that doesn't fit the pattern: check `ptr` to reject trailing characters.
+ */
+template <std::size_t MAXIMUM_LENGTH,
+          typename CheckingType,
+          FixedStringPadding PADDING,
+          typename T>
+    requires(std::integral<T> && !std::same_as<T, bool>)
+std::from_chars_result from_chars(const FixedString<MAXIMUM_LENGTH, CheckingType, PADDING>& str,
+                                  T& value,
+                                  int base = 10)
+{
+    const char* const first = str.data();
+    return std::from_chars(
+        first, std::next(first, static_cast<std::ptrdiff_t>(str.length())), value, base);
+}
+template <std::size_t MAXIMUM_LENGTH,
+          typename CheckingType,
+          FixedStringPadding PADDING,
+          std::floating_point T>
+std::from_chars_result from_chars(const FixedString<MAXIMUM_LENGTH, CheckingType, PADDING>& str,
+                                  T& value,
+                                  std::chars_format format = std::chars_format::general)
+{
+    const char* const first = str.data();
+    return std::from_chars(
+        first, std::next(first, static_cast<std::ptrdiff_t>(str.length())), value, format);
+}
+
+template <std::size_t MAXIMUM_LENGTH,
+          customize::SequenceContainerChecking CheckingType =
+              customize::SequenceContainerAbortChecking<char, MAXIMUM_LENGTH>>
+using ZeroPaddedFixedString = FixedString<MAXIMUM_LENGTH, CheckingType, FixedStringPadding::ZEROED>;
+
 }  // namespace fixed_containers
 
+namespace fixed_containers::wyhash
+{
+// Same value as hashing the equivalent `std::string_view`.
+template <std::size_t MAXIMUM_LENGTH, customize::SequenceContainerChecking CheckingType>
+struct hash<FixedString<MAXIMUM_LENGTH, CheckingType, FixedStringPadding::INDETERMINATE>>
+{
+    constexpr std::uint64_t operator()(const FixedString<MAXIMUM_LENGTH,
+                                                         CheckingType,
+                                                         FixedStringPadding::INDETERMINATE>& str)
+        const noexcept
+    {
+        return hash<std::string_view>{}(str);
+    }
+};
+
+// Hashes the whole fixed capacity, so the work does not depend on the length.
+// Not the same value as hashing the equivalent `std::string_view`.
+template <std::size_t MAXIMUM_LENGTH, customize::SequenceContainerChecking CheckingType>
+struct hash<FixedString<MAXIMUM_LENGTH, CheckingType, FixedStringPadding::ZEROED>>
+{
+    constexpr std::uint64_t operator()(const FixedString<MAXIMUM_LENGTH,
+                                                         CheckingType,
+                                                         FixedStringPadding::ZEROED>& str) const
+        noexcept
+    {
+        const std::uint64_t characters_hash =
+            wyhash_detail::hash_objects<MAXIMUM_LENGTH>(str.data(), MAXIMUM_LENGTH);
+        return wyhash_detail::hash(characters_hash ^ static_cast<std::uint64_t>(str.length()));
+    }
+};
+}  // namespace fixed_containers::wyhash
+
 // Specializations
 namespace std
 {
 template <std::size_t MAXIMUM_LENGTH,
-          fixed_containers::customize::SequenceContainerChecking CheckingType>
-struct tuple_size<fixed_containers::FixedString<MAXIMUM_LENGTH, CheckingType>>
+          fixed_containers::customize::SequenceContainerChecking CheckingType,
+          fixed_containers::FixedStringPadding PADDING>
+struct tuple_size<fixed_containers::FixedString<MAXIMUM_LENGTH, CheckingType, PADDING>>
   : std::integral_constant<std::size_t, 0>
 {
     // Implicit Structured Binding due to the fields being public is disabled
@@ -0,0 +1,245 @@
+#pragma once
+
+#include "fixed_containers/fixed_robinhood_hashtable.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
+#include "fixed_containers/source_location.hpp"
+#include "fixed_containers/wyhash.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <string_view>
+
+namespace fixed_containers
+{
+/**
+ * String interning with compact IDs. Each distinct string is stored once, in a single contiguous
+ * character arena, and is identified by a dense `std::uint32_t` ID: 0, 1, 2, ... in insertion
+ * order. Properties:
+ *  - constexpr, so a table can be built at compile time from a list of literals
+ *  - lookup by `std::string_view` goes through a `FixedRobinhoodHashtable` index on the hash of
+ *    the string; lookup by ID is O(1)
+ *  - no pointers stored (data layout doesn't use pointers), so a built table can be copied with
+ *    `memcpy` or mapped from a file, on machines with the same endianness
+ *  - trivially copyable, and a structural type
+ *  - no dynamic allocations
+ *
+ * Symbols can't be removed one by one, only all together with `clear()`. Symbols are not null
+ * terminated.
+ */
+template <std::size_t MAXIMUM_SYMBOL_COUNT,
+          std::size_t ARENA_BYTES,
+          class Hash = wyhash::hash<std::string_view>,
+          customize::SequenceContainerChecking CheckingType =
+              customize::SequenceContainerAbortChecking<char, ARENA_BYTES>>
+class FixedSymbolTable
+{
+public:
+    using id_type = std::uint32_t;
+    using size_type = std::size_t;
+    using hasher = Hash;
+
+    static_assert(MAXIMUM_SYMBOL_COUNT < (std::numeric_limits<id_type>::max)(),
+                  "Symbol IDs must fit in id_type, with one value left as a sentinel");
+    static_assert(ARENA_BYTES <= (std::numeric_limits<std::uint32_t>::max)(),
+                  "Arena offsets must fit in 32 bits");
+
+private:
+    using Checking = CheckingType;
+
+    static constexpr id_type NO_ID = (std::numeric_limits<id_type>::max)();
+
+    // The index is keyed by the 64-bit hash of the symbol, which needs no further mixing.
+    struct IdentityHash
+    {
+        constexpr std::uint64_t operator()(std::uint64_t hash_value) const { return hash_value; }
+    };
+
+    struct SymbolEntry
+    {
+        std::uint32_t end_offset;
+        // Distinct symbols whose hashes collide are chained from the ID that the index holds.
+        id_type next_with_same_hash;
+    };
+
+    using Index = fixed_robinhood_hashtable_detail::FixedRobinhoodHashtable<
+        std::uint64_t,
+        id_type,
+        MAXIMUM_SYMBOL_COUNT,
+        fixed_robinhood_hashtable_detail::default_bucket_count(MAXIMUM_SYMBOL_COUNT),
+        IdentityHash,
+        std::equal_to<std::uint64_t>>;
+    using IndexPosition = typename Index::OpaqueIndexType;
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    FixedVector<char, ARENA_BYTES, CheckingType> IMPLEMENTATION_DETAIL_DO_NOT_USE_arena_{};
+    FixedVector<SymbolEntry, MAXIMUM_SYMBOL_COUNT> IMPLEMENTATION_DETAIL_DO_NOT_USE_symbols_{};
+    Index IMPLEMENTATION_DETAIL_DO_NOT_USE_index_{};
+    Hash IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_{};
+
+public:
+    constexpr FixedSymbolTable() noexcept = default;
+    explicit constexpr FixedSymbolTable(const Hash& hash) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_{hash}
+    {
+    }
+
+    constexpr FixedSymbolTable(
+        std::initializer_list<std::string_view> symbols,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedSymbolTable()
+    {
+        for (const std::string_view& symbol : symbols)
+        {
+            intern(symbol, loc);
+        }
+    }
+
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept
+    {
+        return MAXIMUM_SYMBOL_COUNT;
+    }
+    [[nodiscard]] static constexpr std::size_t arena_capacity() noexcept { return ARENA_BYTES; }
+
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return symbols().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+    // Characters used by all the symbols together.
+    [[nodiscard]] constexpr std::size_t arena_size() const noexcept { return arena().size(); }
+
+    // Returns the ID of `symbol`, adding it first if it is not in the table yet.
+    constexpr id_type intern(
+        std::string_view symbol,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        const std::uint64_t hash_value = hash_of(symbol);
+        const IndexPosition position = index().opaque_index_of(hash_value);
+        if (!index().exists(position))
+        {
+            const id_type new_id = append_symbol(symbol, loc);
+            index().emplace(position, hash_value, new_id);
+            return new_id;
+        }
+
+        id_type current = index().value(position);
+        while (true)
+        {
+            if (symbol_at(current) == symbol)
+            {
+                return current;
+            }
+            const id_type next = symbols()[current].next_with_same_hash;
+            if (next == NO_ID)
+            {
+                break;
+            }
+            current = next;
+        }
+
+        const id_type new_id = append_symbol(symbol, loc);
+        symbols()[current].next_with_same_hash = new_id;
+        return new_id;
+    }
+
+    [[nodiscard]] constexpr std::optional<id_type> find(std::string_view symbol) const
+    {
+        const IndexPosition position = index().opaque_index_of(hash_of(symbol));
+        if (!index().exists(position))
+        {
+            return std::nullopt;
+        }
+        for (id_type current = index().value(position); current != NO_ID;
+             current = symbols()[current].next_with_same_hash)
+        {
+            if (symbol_at(current) == symbol)
+            {
+                return current;
+            }
+        }
+        return std::nullopt;
+    }
+    [[nodiscard]] constexpr bool contains(std::string_view symbol) const
+    {
+        return find(symbol).has_value();
+    }
+
+    [[nodiscard]] constexpr std::string_view at(
+        id_type symbol_id,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        if (preconditions::test(symbol_id < size()))
+        {
+            Checking::out_of_range(symbol_id, size(), loc);
+        }
+        return symbol_at(symbol_id);
+    }
+    [[nodiscard]] constexpr std::string_view operator[](id_type symbol_id) const
+    {
+        // Cannot capture real source_location for operator[]
+        return at(symbol_id, std_transition::source_location::current());
+    }
+
+    constexpr void clear() noexcept
+    {
+        arena().clear();
+        symbols().clear();
+        index().clear();
+    }
+
+private:
+    [[nodiscard]] constexpr std::uint64_t hash_of(std::string_view symbol) const
+    {
+        return static_cast<std::uint64_t>(IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_(symbol));
+    }
+
+    [[nodiscard]] constexpr std::string_view symbol_at(id_type symbol_id) const
+    {
+        const std::size_t begin = symbol_id == 0 ? 0 : symbols()[symbol_id - 1].end_offset;
+        const std::size_t end = symbols()[symbol_id].end_offset;
+        return {std::next(arena().data(), static_cast<std::ptrdiff_t>(begin)), end - begin};
+    }
+
+    constexpr id_type append_symbol(std::string_view symbol,
+                                    const std_transition::source_location& loc)
+    {
+        // Check before touching the arena, so a failed intern leaves the table unchanged
+        if (preconditions::test(size() < MAXIMUM_SYMBOL_COUNT))
+        {
+            Checking::length_error(MAXIMUM_SYMBOL_COUNT + 1, loc);
+        }
+        arena().insert(arena().cend(), symbol.begin(), symbol.end(), loc);
+        symbols().push_back({static_cast<std::uint32_t>(arena().size()), NO_ID});
+        return static_cast<id_type>(size() - 1);
+    }
+
+    [[nodiscard]] constexpr const FixedVector<char, ARENA_BYTES, CheckingType>& arena() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_arena_;
+    }
+    constexpr FixedVector<char, ARENA_BYTES, CheckingType>& arena()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_arena_;
+    }
+    [[nodiscard]] constexpr const FixedVector<SymbolEntry, MAXIMUM_SYMBOL_COUNT>& symbols() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_symbols_;
+    }
+    constexpr FixedVector<SymbolEntry, MAXIMUM_SYMBOL_COUNT>& symbols()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_symbols_;
+    }
+    [[nodiscard]] constexpr const Index& index() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_index_;
+    }
+    constexpr Index& index() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_index_; }
+};
+
+}  // namespace fixed_containers
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "fixed_containers/algorithm.hpp"
+#include "fixed_containers/checking_hooks.hpp"
 #include "fixed_containers/concepts.hpp"
 #include "fixed_containers/iterator_utils.hpp"
 #include "fixed_containers/memory.hpp"
@@ -8,11 +9,15 @@
 #include "fixed_containers/preconditions.hpp"
 #include "fixed_containers/random_access_iterator_transformer.hpp"
 #include "fixed_containers/sequence_container_checking.hpp"
+#include "fixed_containers/sort.hpp"
 #include "fixed_containers/source_location.hpp"
+#include "fixed_containers/wyhash.hpp"
 
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <initializer_list>
 #include <iterator>
 #include <memory>
@@ -253,6 +258,20 @@ public:
         }
     }
 
+    /**
+     * Like `resize()`, but doesn't initialize the new elements: they keep whatever was written to
+     * the unused capacity (e.g. through `data()`) before the call. Only for trivial types.
+     */
+    constexpr void resize_for_overwrite(
+        size_type count,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+        requires(std::is_trivially_default_constructible_v<T> &&
+                 std::is_trivially_destructible_v<T>)
+    {
+        check_target_size(count, loc);
+        set_size(count);
+    }
+
     /**
      * Appends the given element value to the end of the container.
      * Calling push_back on a full container is undefined.
@@ -732,14 +751,25 @@ private:
     constexpr void increment_size(const std::size_t n = 1)
     {
         IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ += n;
+        checking_hooks::record_insert<Checking>(n, size());
     }
     constexpr void decrement_size(const std::size_t n = 1)
     {
         IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ -= n;
+        checking_hooks::record_erase<Checking>(n, size());
     }
     constexpr void set_size(const std::size_t size)
     {
+        const std::size_t previous_size = IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
         IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = size;
+        if (size > previous_size)
+        {
+            checking_hooks::record_insert<Checking>(size - previous_size, size);
+        }
+        else if (size < previous_size)
+        {
+            checking_hooks::record_erase<Checking>(previous_size - size, size);
+        }
     }
 
     [[nodiscard]] constexpr const T& unchecked_at(const std::size_t index) const
@@ -1037,6 +1067,49 @@ constexpr typename FixedVector<T, MAXIMUM_SIZE, CheckingType>::size_type erase_i
     return original_size - container.size();
 }
 
+// Sorting algorithms that choose their strategy at compile-time, based on the capacity. See
+// `sort_detail` for the details.
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          typename CheckingType,
+          typename Compare = std::less<>>
+constexpr void sort(FixedVector<T, MAXIMUM_SIZE, CheckingType>& container, Compare comparator = {})
+{
+    sort_detail::sort<MAXIMUM_SIZE>(container.begin(), container.end(), comparator);
+}
+
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          typename CheckingType,
+          typename Compare = std::less<>>
+constexpr void stable_sort(FixedVector<T, MAXIMUM_SIZE, CheckingType>& container,
+                           Compare comparator = {})
+{
+    sort_detail::stable_sort<MAXIMUM_SIZE>(container.begin(), container.end(), comparator);
+}
+
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          typename CheckingType,
+          typename Compare = std::less<>>
+constexpr void partial_sort(FixedVector<T, MAXIMUM_SIZE, CheckingType>& container,
+                            typename FixedVector<T, MAXIMUM_SIZE, CheckingType>::iterator middle,
+                            Compare comparator = {})
+{
+    sort_detail::partial_sort<MAXIMUM_SIZE>(container.begin(), middle, container.end(), comparator);
+}
+
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          typename CheckingType,
+          typename Compare = std::less<>>
+constexpr void nth_element(FixedVector<T, MAXIMUM_SIZE, CheckingType>& container,
+                           typename FixedVector<T, MAXIMUM_SIZE, CheckingType>::iterator nth,
+                           Compare comparator = {})
+{
+    sort_detail::nth_element<MAXIMUM_SIZE>(container.begin(), nth, container.end(), comparator);
+}
+
 /**
  * Construct a FixedVector with its capacity being deduced from the number of items being passed.
  */
@@ -1087,6 +1160,34 @@ template <typename T>
 
 }  // namespace fixed_containers
 
+namespace fixed_containers::wyhash
+{
+// Hashes the elements only, not the unused capacity. Elements whose bytes are their value are
+// hashed together in one pass.
+template <typename T, std::size_t MAXIMUM_SIZE, customize::SequenceContainerChecking CheckingType>
+struct hash<FixedVector<T, MAXIMUM_SIZE, CheckingType>>
+{
+    constexpr std::uint64_t operator()(
+        const FixedVector<T, MAXIMUM_SIZE, CheckingType>& container) const
+    {
+        if constexpr (wyhash_detail::ByteHashable<T>)
+        {
+            return wyhash_detail::hash_objects<MAXIMUM_SIZE>(container.data(), container.size());
+        }
+        else
+        {
+            std::uint64_t seed =
+                wyhash_detail::hash(static_cast<std::uint64_t>(container.size()));
+            for (const T& element : container)
+            {
+                seed = wyhash_detail::combine(seed, hash<T>{}(element));
+            }
+            return seed;
+        }
+    }
+};
+}  // namespace fixed_containers::wyhash
+
 // Specializations
 namespace std
 {
@@ -0,0 +1,297 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/max_size.hpp"
+#include "fixed_containers/memory.hpp"
+#include "fixed_containers/reflection.hpp"
+#include "fixed_containers/type_name.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdio>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+
+namespace fixed_containers::reflection
+{
+struct FieldLayout
+{
+    std::string_view name;
+    std::string_view type_name;
+    // 0 for the fields of the reported type, 1 for the fields of its nested structs, etc.
+    std::size_t depth;
+    // Whether the field comes from a base class of its struct. The base class lays it out, so
+    // reordering the fields of the struct doesn't move it.
+    bool inherited;
+    // From the start of the reported type
+    std::size_t offset;
+    std::size_t size;
+    std::size_t alignment;
+    // The hole between the end of this field and the next field of the same struct, or the end of
+    // the struct for the last field
+    std::size_t padding_after;
+    // For fixed containers and `std::optional`, the bytes not used to store elements: size
+    // counters, indices of tree/list nodes, `OptionalStorage` flags and their own padding.
+    std::size_t container_overhead;
+};
+
+template <std::size_t MAXIMUM_FIELD_COUNT>
+struct LayoutReport
+{
+    std::string_view type_name;
+    std::size_t size;
+    std::size_t alignment;
+    // Depth-first, in declaration order
+    FixedVector<FieldLayout, MAXIMUM_FIELD_COUNT> fields;
+    // All the padding holes, nested structs included
+    std::size_t padding;
+    // Declaration order of the fields of the reported type that minimizes its padding, and the
+    // resulting size. Nested structs keep their layout. Inherited fields are not part of it and
+    // keep their place before the fields of the reported type.
+    FixedVector<std::string_view, MAXIMUM_FIELD_COUNT> suggested_order;
+    std::size_t suggested_size;
+
+    [[nodiscard]] std::size_t bytes_saved_by_reordering() const { return size - suggested_size; }
+
+    void dump(std::FILE* out = stderr) const
+    {
+        std::fprintf(out,
+                     "%.*s: size %zu, alignment %zu, padding %zu\n",
+                     static_cast<int>(type_name.size()),
+                     type_name.data(),
+                     size,
+                     alignment,
+                     padding);
+        std::fprintf(out,
+                     "%8s %8s %6s %8s %9s  %s\n",
+                     "offset",
+                     "size",
+                     "align",
+                     "padding",
+                     "overhead",
+                     "field");
+        for (const FieldLayout& field : fields)
+        {
+            std::fprintf(out,
+                         "%8zu %8zu %6zu %8zu %9zu  %*s%.*s (%.*s)\n",
+                         field.offset,
+                         field.size,
+                         field.alignment,
+                         field.padding_after,
+                         field.container_overhead,
+                         static_cast<int>(2 * field.depth),
+                         "",
+                         static_cast<int>(field.name.size()),
+                         field.name.data(),
+                         static_cast<int>(field.type_name.size()),
+                         field.type_name.data());
+        }
+        if (bytes_saved_by_reordering() == 0)
+        {
+            std::fprintf(out, "Field order is optimal\n");
+            std::fflush(out);
+            return;
+        }
+        std::fprintf(out,
+                     "Reordering saves %zu bytes (size %zu):",
+                     bytes_saved_by_reordering(),
+                     suggested_size);
+        for (const std::string_view& name : suggested_order)
+        {
+            std::fprintf(out, " %.*s", static_cast<int>(name.size()), name.data());
+        }
+        std::fprintf(out, "\n");
+        std::fflush(out);
+    }
+};
+}  // namespace fixed_containers::reflection
+
+namespace fixed_containers::layout_report_detail
+{
+// Aggregates are reported field by field, like with `recursive_reflection`. Containers and other
+// classes with private fields are reported as a whole.
+template <typename T>
+concept RecursivelyReported =
+    reflection::Reflectable<T> && std::is_aggregate_v<T> && !std::ranges::range<T>;
+
+template <typename T>
+concept IsOptional =
+    requires { requires std::same_as<T, std::optional<typename T::value_type>>; };
+
+template <typename T>
+constexpr std::size_t container_overhead_of()
+{
+    std::size_t element_bytes = sizeof(T);
+    if constexpr (has_static_sizet_static_max_size_void<T> &&
+                  requires { typename T::value_type; })
+    {
+        element_bytes = T::static_max_size() * sizeof(typename T::value_type);
+    }
+    else if constexpr (IsOptional<T>)
+    {
+        element_bytes = sizeof(typename T::value_type);
+    }
+    // Bit-based containers (e.g. EnumSet) store less than one element per entry
+    return sizeof(T) > element_bytes ? sizeof(T) - element_bytes : 0;
+}
+
+template <typename S>
+constexpr auto inherited_fields_of() -> std::array<bool, reflection::field_count_of<S>()>
+{
+    std::array<bool, reflection::field_count_of<S>()> output{};
+    std::size_t index = 0;
+    reflection_detail::for_each_parsed_field_entry(
+        S{},
+        [&output, &index](const reflection_detail::FieldEntry& field_entry)
+        {
+            if (field_entry.enclosing_field_name().empty())
+            {
+                output.at(index) = field_entry.providing_base_class_name().has_value();
+                ++index;
+            }
+        });
+    return output;
+}
+
+// Whether each field of `S`, in `reflection::for_each_field()` order, comes from a base class
+template <typename S>
+inline constexpr auto INHERITED_FIELDS = inherited_fields_of<S>();
+
+constexpr std::size_t align_up(const std::size_t value, const std::size_t alignment)
+{
+    return ((value + alignment - 1) / alignment) * alignment;
+}
+
+// Returns the padding of `instance`, nested structs included
+template <std::size_t MAXIMUM_FIELD_COUNT, typename S>
+std::size_t collect_fields(const S& instance,
+                           const std::size_t base_offset,
+                           const std::size_t depth,
+                           FixedVector<reflection::FieldLayout, MAXIMUM_FIELD_COUNT>& output)
+{
+    const std::byte* const instance_ptr = memory::addressof_as_const_byte_ptr(instance);
+    std::size_t padding = 0;
+    std::size_t end_of_previous_field = 0;
+    std::optional<std::size_t> previous_field_index{};
+    std::size_t field_index = 0;
+
+    reflection::for_each_field(
+        instance,
+        [&]<typename F>(const std::string_view& name, const F& field)
+        {
+            const std::byte* const field_ptr = memory::addressof_as_const_byte_ptr(field);
+            assert_or_abort(instance_ptr <= field_ptr);
+            const auto offset = static_cast<std::size_t>(std::distance(instance_ptr, field_ptr));
+
+            const std::size_t hole =
+                offset > end_of_previous_field ? offset - end_of_previous_field : 0;
+            padding += hole;
+            if (previous_field_index.has_value())
+            {
+                output.at(*previous_field_index).padding_after = hole;
+            }
+
+            previous_field_index = output.size();
+            output.push_back({
+                .name = name,
+                .type_name = type_name<F>(),
+                .depth = depth,
+                .inherited = INHERITED_FIELDS<S>.at(field_index),
+                .offset = base_offset + offset,
+                .size = sizeof(F),
+                .alignment = alignof(F),
+                .padding_after = 0,
+                .container_overhead = container_overhead_of<F>(),
+            });
+            end_of_previous_field = (std::max)(end_of_previous_field, offset + sizeof(F));
+            ++field_index;
+
+            if constexpr (RecursivelyReported<F>)
+            {
+                padding += collect_fields(field, base_offset + offset, depth + 1, output);
+            }
+        });
+
+    const std::size_t tail = sizeof(S) - end_of_previous_field;
+    padding += tail;
+    if (previous_field_index.has_value())
+    {
+        output.at(*previous_field_index).padding_after = tail;
+    }
+    return padding;
+}
+}  // namespace fixed_containers::layout_report_detail
+
+namespace fixed_containers::reflection
+{
+/**
+ * Reports the offset, size, alignment and trailing padding of every field of `T`, recursing into
+ * nested aggregates, along with the overhead of the fixed containers it holds. Also suggests the
+ * order of the fields declared by `T` with the least padding: decreasing alignment. Fields
+ * inherited from base classes are reported, but not reordered.
+ *
+ * Offsets are only known at run time, so this is not `constexpr`. `T` is value-initialized on the
+ * heap to get them.
+ */
+template <typename T, std::size_t MAXIMUM_FIELD_COUNT = 256>
+    requires(Reflectable<std::decay_t<T>>)
+LayoutReport<MAXIMUM_FIELD_COUNT> layout_report()
+{
+    using Type = std::decay_t<T>;
+    const auto instance = std::make_unique<Type>();
+
+    LayoutReport<MAXIMUM_FIELD_COUNT> report{
+        .type_name = type_name<Type>(),
+        .size = sizeof(Type),
+        .alignment = alignof(Type),
+        .fields = {},
+        .padding = 0,
+        .suggested_order = {},
+        .suggested_size = sizeof(Type),
+    };
+    report.padding = layout_report_detail::collect_fields(*instance, 0, 0, report.fields);
+
+    FixedVector<const FieldLayout*, MAXIMUM_FIELD_COUNT> own_fields{};
+    for (const FieldLayout& field : report.fields)
+    {
+        if (field.depth == 0 && !field.inherited)
+        {
+            own_fields.push_back(&field);
+        }
+    }
+    if (own_fields.empty())
+    {
+        return report;
+    }
+
+    // The base classes come first. Starting where the first own field currently is, rather than
+    // right after them, never suggests more savings than reordering can give.
+    std::size_t offset = own_fields.at(0)->offset;
+    // Ties keep the declaration order. `stable_sort()` would do the same, but it allocates a
+    // temporary buffer, which libstdc++ deprecates under clang.
+    std::ranges::sort(own_fields,
+                      [](const FieldLayout* lhs, const FieldLayout* rhs)
+                      {
+                          if (lhs->alignment != rhs->alignment)
+                          {
+                              return lhs->alignment > rhs->alignment;
+                          }
+                          return lhs->offset < rhs->offset;
+                      });
+    for (const FieldLayout* field : own_fields)
+    {
+        offset = layout_report_detail::align_up(offset, field->alignment) + field->size;
+        report.suggested_order.push_back(field->name);
+    }
+    report.suggested_size =
+        (std::min)(sizeof(Type), layout_report_detail::align_up(offset, alignof(Type)));
+    return report;
+}
+}  // namespace fixed_containers::reflection
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "fixed_containers/preconditions.hpp"
 #include "fixed_containers/source_location.hpp"
 #include "fixed_containers/type_name.hpp"
 
@@ -36,4 +37,22 @@ struct MapAbortChecking
         std::abort();
     }
 };
+
+// Compiles out the checks, see `SequenceContainerNoChecking`.
+template <class K, class V, std::size_t /*MAXIMUM_SIZE*/>
+struct MapNoChecking
+{
+    [[noreturn]] static void out_of_range(const K& /*key*/,
+                                          const std::size_t /*size*/,
+                                          const std_transition::source_location& /*loc*/)
+    {
+        preconditions::unreachable();
+    }
+
+    [[noreturn]] static void length_error(const std::size_t /*target_capacity*/,
+                                          const std_transition::source_location& /*loc*/)
+    {
+        preconditions::unreachable();
+    }
+};
 }  // namespace fixed_containers::customize
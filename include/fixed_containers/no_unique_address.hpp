@@ -0,0 +1,9 @@
+#pragma once
+
+// `[[no_unique_address]]` is accepted but ignored by MSVC, which has its own spelling. Lets an
+// empty member (e.g. a stateless hasher) take no space on all compilers.
+#if defined(_MSC_VER)
+#define FIXED_CONTAINERS_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#define FIXED_CONTAINERS_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
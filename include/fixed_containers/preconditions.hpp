@@ -11,4 +11,16 @@ constexpr bool test(const bool condition)
 
     return false;
 }
+
+// Marks a precondition violation as impossible, so the optimizer drops the check guarding it and
+// can assume the precondition holds afterwards. Not constexpr, so a violation during constant
+// evaluation is still a compile error.
+[[noreturn]] inline void unreachable()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    __assume(false);
+#else
+    __builtin_unreachable();
+#endif
+}
 }  // namespace fixed_containers::preconditions
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "fixed_containers/preconditions.hpp"
 #include "fixed_containers/source_location.hpp"
 #include "fixed_containers/string_literal.hpp"
 #include "fixed_containers/type_name.hpp"
@@ -52,4 +53,36 @@ struct SequenceContainerAbortChecking
         std::abort();
     }
 };
+
+// For hot paths in release builds where the preconditions are known to hold. Violating one is
+// undefined behavior. The checks compile out, and with them the `source_location` arguments, which
+// are only ever read by the handlers. Violations in constant expressions are still compile errors.
+template <typename T, std::size_t /*MAXIMUM_SIZE*/>
+struct SequenceContainerNoChecking
+{
+    [[noreturn]] static void out_of_range(const std::size_t /*index*/,
+                                          const std::size_t /*size*/,
+                                          const std_transition::source_location& /*loc*/)
+    {
+        preconditions::unreachable();
+    }
+
+    [[noreturn]] static void length_error(const std::size_t /*target_capacity*/,
+                                          const std_transition::source_location& /*loc*/)
+    {
+        preconditions::unreachable();
+    }
+
+    [[noreturn]] static void empty_container_access(const std_transition::source_location& /*loc*/)
+    {
+        preconditions::unreachable();
+    }
+
+    [[noreturn]] static void invalid_argument(
+        const fixed_containers::StringLiteral& /*error_message*/,
+        const std_transition::source_location& /*loc*/)
+    {
+        preconditions::unreachable();
+    }
+};
 }  // namespace fixed_containers::customize
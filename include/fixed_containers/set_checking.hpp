@@ -1,5 +1,6 @@
 #pragma once
 
+#include "fixed_containers/preconditions.hpp"
 #include "fixed_containers/source_location.hpp"
 #include "fixed_containers/type_name.hpp"
 
@@ -27,4 +28,15 @@ struct SetAbortChecking
         std::abort();
     }
 };
+
+// Compiles out the checks, see `SequenceContainerNoChecking`.
+template <class K, std::size_t /*MAXIMUM_SIZE*/>
+struct SetNoChecking
+{
+    [[noreturn]] static void length_error(const std::size_t /*target_capacity*/,
+                                          const std_transition::source_location& /*loc*/)
+    {
+        preconditions::unreachable();
+    }
+};
 }  // namespace fixed_containers::customize
@@ -0,0 +1,633 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+// Sorting routines that pick their strategy at compile-time, based on the capacity of the
+// container. The container-facing overloads (`fixed_containers::sort()` etc.) live next to
+// `erase_if()` in each container's header.
+namespace fixed_containers::sort_detail
+{
+// Sorting networks are used for capacities up to this.
+inline constexpr std::size_t SORTING_NETWORK_MAX_SIZE = 32;
+
+inline constexpr std::ptrdiff_t INSERTION_SORT_THRESHOLD = 24;
+inline constexpr std::ptrdiff_t NINTHER_THRESHOLD = 128;
+inline constexpr std::ptrdiff_t PARTIAL_INSERTION_SORT_LIMIT = 8;
+inline constexpr std::ptrdiff_t STABLE_SORT_CHUNK_SIZE = 16;
+
+struct ComparatorPair
+{
+    std::uint8_t lhs;
+    std::uint8_t rhs;
+};
+
+// Batcher's odd-even merge sort, for `size` being a power of two.
+template <typename Callback>
+constexpr void for_each_odd_even_merge_comparator(std::size_t size, Callback callback)
+{
+    for (std::size_t p = 1; p < size; p *= 2)
+    {
+        for (std::size_t k = p; k >= 1; k /= 2)
+        {
+            for (std::size_t j = k % p; j + k < size; j += 2 * k)
+            {
+                for (std::size_t i = 0; i < k && i + j + k < size; i++)
+                {
+                    if ((i + j) / (2 * p) == (i + j + k) / (2 * p))
+                    {
+                        callback(i + j, i + j + k);
+                    }
+                }
+            }
+        }
+    }
+}
+
+template <std::size_t SIZE>
+constexpr std::size_t odd_even_merge_comparator_count()
+{
+    std::size_t count = 0;
+    for_each_odd_even_merge_comparator(SIZE, [&count](std::size_t, std::size_t) { count++; });
+    return count;
+}
+
+template <std::size_t SIZE>
+constexpr auto make_sorting_network()
+{
+    static_assert(std::has_single_bit(SIZE) && SIZE <= SORTING_NETWORK_MAX_SIZE);
+    std::array<ComparatorPair, odd_even_merge_comparator_count<SIZE>()> out{};
+    std::size_t current = 0;
+    for_each_odd_even_merge_comparator(
+        SIZE,
+        [&out, &current](std::size_t lhs, std::size_t rhs)
+        {
+            out.at(current) = {static_cast<std::uint8_t>(lhs), static_cast<std::uint8_t>(rhs)};
+            current++;
+        });
+    return out;
+}
+
+template <std::size_t SIZE>
+inline constexpr auto SORTING_NETWORK = make_sorting_network<SIZE>();
+
+// Small trivially copyable types are selected without a branch, which compiles to conditional
+// moves. Everything else falls back to a conditional swap.
+template <typename T>
+inline constexpr bool HAS_BRANCHLESS_COMPARE_EXCHANGE =
+    std::is_trivially_copyable_v<T> && sizeof(T) <= 2 * sizeof(void*);
+
+template <typename RandomIt, typename Compare>
+constexpr void compare_exchange(RandomIt lhs_it, RandomIt rhs_it, Compare& comparator)
+{
+    using T = std::iter_value_t<RandomIt>;
+    if constexpr (HAS_BRANCHLESS_COMPARE_EXCHANGE<T>)
+    {
+        const T lhs = *lhs_it;
+        const T rhs = *rhs_it;
+        const bool should_swap = comparator(rhs, lhs);
+        *lhs_it = should_swap ? rhs : lhs;
+        *rhs_it = should_swap ? lhs : rhs;
+    }
+    else
+    {
+        if (comparator(*rhs_it, *lhs_it))
+        {
+            std::iter_swap(lhs_it, rhs_it);
+        }
+    }
+}
+
+template <std::size_t SIZE, typename RandomIt, typename Compare>
+constexpr void apply_sorting_network(RandomIt first, std::size_t count, Compare& comparator)
+{
+    // The network for SIZE also sorts any `count <= SIZE`: treating the missing entries as
+    // +infinity, a comparator touching them would never swap, so it can be skipped.
+    for (const ComparatorPair& pair : SORTING_NETWORK<SIZE>)
+    {
+        if (pair.rhs < count)
+        {
+            compare_exchange(first + pair.lhs, first + pair.rhs, comparator);
+        }
+    }
+}
+
+template <std::size_t CAPACITY, typename RandomIt, typename Compare>
+constexpr void sorting_network_sort(RandomIt first, RandomIt last, Compare& comparator)
+{
+    static_assert(CAPACITY <= SORTING_NETWORK_MAX_SIZE);
+    const auto count = static_cast<std::size_t>(last - first);
+    // Only instantiate the networks that the capacity can need
+    if (count <= 1)
+    {
+        return;
+    }
+    if (count <= 2)
+    {
+        compare_exchange(first, first + 1, comparator);
+        return;
+    }
+    if constexpr (CAPACITY > 2)
+    {
+        if (count <= 4)
+        {
+            apply_sorting_network<4>(first, count, comparator);
+            return;
+        }
+    }
+    if constexpr (CAPACITY > 4)
+    {
+        if (count <= 8)
+        {
+            apply_sorting_network<8>(first, count, comparator);
+            return;
+        }
+    }
+    if constexpr (CAPACITY > 8)
+    {
+        if (count <= 16)
+        {
+            apply_sorting_network<16>(first, count, comparator);
+            return;
+        }
+    }
+    if constexpr (CAPACITY > 16)
+    {
+        apply_sorting_network<32>(first, count, comparator);
+    }
+}
+
+// Stable.
+template <typename RandomIt, typename Compare>
+constexpr void insertion_sort(RandomIt first, RandomIt last, Compare& comparator)
+{
+    if (first == last)
+    {
+        return;
+    }
+
+    for (RandomIt current = std::next(first); current != last; ++current)
+    {
+        RandomIt hole = current;
+        RandomIt before_hole = std::prev(current);
+        if (comparator(*hole, *before_hole))
+        {
+            auto tmp = std::move(*hole);
+            do
+            {
+                *hole-- = std::move(*before_hole);
+            } while (hole != first && comparator(tmp, *--before_hole));
+            *hole = std::move(tmp);
+        }
+    }
+}
+
+// Requires an element before `first` that is not greater than any element in the range.
+template <typename RandomIt, typename Compare>
+constexpr void unguarded_insertion_sort(RandomIt first, RandomIt last, Compare& comparator)
+{
+    if (first == last)
+    {
+        return;
+    }
+
+    for (RandomIt current = std::next(first); current != last; ++current)
+    {
+        RandomIt hole = current;
+        RandomIt before_hole = std::prev(current);
+        if (comparator(*hole, *before_hole))
+        {
+            auto tmp = std::move(*hole);
+            do
+            {
+                *hole-- = std::move(*before_hole);
+            } while (comparator(tmp, *--before_hole));
+            *hole = std::move(tmp);
+        }
+    }
+}
+
+// Each element is compare-exchanged with its predecessor all the way down to `first`, instead of
+// stopping once it is in place. That is about twice the comparisons of `insertion_sort()` on
+// random input, but none of them is a data-dependent branch. It is faster for the short, unsorted
+// partitions that quicksort leaves behind, but much slower on sorted input, where
+// `insertion_sort()` does one comparison per element. Stable, as equal neighbours are never
+// exchanged.
+template <typename RandomIt, typename Compare>
+constexpr void branchless_insertion_sort(RandomIt first, RandomIt last, Compare& comparator)
+{
+    if (first == last)
+    {
+        return;
+    }
+
+    for (RandomIt current = std::next(first); current != last; ++current)
+    {
+        for (RandomIt hole = current; hole != first; --hole)
+        {
+            compare_exchange(std::prev(hole), hole, comparator);
+        }
+    }
+}
+
+// Gives up (returning false) after moving more than a handful of elements.
+template <typename RandomIt, typename Compare>
+constexpr bool partial_insertion_sort(RandomIt first, RandomIt last, Compare& comparator)
+{
+    if (first == last)
+    {
+        return true;
+    }
+
+    std::ptrdiff_t moved_count = 0;
+    for (RandomIt current = std::next(first); current != last; ++current)
+    {
+        if (moved_count > PARTIAL_INSERTION_SORT_LIMIT)
+        {
+            return false;
+        }
+
+        RandomIt hole = current;
+        RandomIt before_hole = std::prev(current);
+        if (comparator(*hole, *before_hole))
+        {
+            auto tmp = std::move(*hole);
+            do
+            {
+                *hole-- = std::move(*before_hole);
+            } while (hole != first && comparator(tmp, *--before_hole));
+            *hole = std::move(tmp);
+            moved_count += current - hole;
+        }
+    }
+    return true;
+}
+
+template <typename RandomIt, typename Compare>
+constexpr void sort3(RandomIt first, RandomIt second, RandomIt third, Compare& comparator)
+{
+    compare_exchange(first, second, comparator);
+    compare_exchange(second, third, comparator);
+    compare_exchange(first, second, comparator);
+}
+
+// Partitions around the pivot at `first`; elements equal to the pivot go to the right.
+// Returns the final pivot position and whether the range was already partitioned.
+template <typename RandomIt, typename Compare>
+constexpr std::pair<RandomIt, bool> partition_right(RandomIt first,
+                                                    RandomIt last,
+                                                    Compare& comparator)
+{
+    auto pivot = std::move(*first);
+    RandomIt left = first;
+    RandomIt right = last;
+
+    // The median-of-3 guarantees that an element not less than the pivot exists.
+    while (comparator(*++left, pivot))
+    {
+    }
+
+    if (std::prev(left) == first)
+    {
+        while (left < right && !comparator(*--right, pivot))
+        {
+        }
+    }
+    else
+    {
+        while (!comparator(*--right, pivot))
+        {
+        }
+    }
+
+    const bool already_partitioned = left >= right;
+    while (left < right)
+    {
+        std::iter_swap(left, right);
+        while (comparator(*++left, pivot))
+        {
+        }
+        while (!comparator(*--right, pivot))
+        {
+        }
+    }
+
+    RandomIt pivot_position = std::prev(left);
+    *first = std::move(*pivot_position);
+    *pivot_position = std::move(pivot);
+    return {pivot_position, already_partitioned};
+}
+
+// Like `partition_right()`, but elements equal to the pivot go to the left. Used when the
+// pivot is known to be equal to the element before `first`, which puts every element equal to
+// it in its final position.
+template <typename RandomIt, typename Compare>
+constexpr RandomIt partition_left(RandomIt first, RandomIt last, Compare& comparator)
+{
+    auto pivot = std::move(*first);
+    RandomIt left = first;
+    RandomIt right = last;
+
+    while (comparator(pivot, *--right))
+    {
+    }
+
+    if (std::next(right) == last)
+    {
+        while (left < right && !comparator(pivot, *++left))
+        {
+        }
+    }
+    else
+    {
+        while (!comparator(pivot, *++left))
+        {
+        }
+    }
+
+    while (left < right)
+    {
+        std::iter_swap(left, right);
+        while (comparator(pivot, *--right))
+        {
+        }
+        while (!comparator(pivot, *++left))
+        {
+        }
+    }
+
+    RandomIt pivot_position = right;
+    *first = std::move(*pivot_position);
+    *pivot_position = std::move(pivot);
+    return pivot_position;
+}
+
+// Breaks up patterns that lead to unbalanced partitions.
+template <typename RandomIt>
+constexpr void shuffle_for_balance(RandomIt first, RandomIt last)
+{
+    const std::ptrdiff_t size = last - first;
+    if (size < INSERTION_SORT_THRESHOLD)
+    {
+        return;
+    }
+
+    const std::ptrdiff_t quarter = size / 4;
+    std::iter_swap(first, first + quarter);
+    std::iter_swap(last - 1, last - quarter);
+    if (size > NINTHER_THRESHOLD)
+    {
+        std::iter_swap(first + 1, first + (quarter + 1));
+        std::iter_swap(first + 2, first + (quarter + 2));
+        std::iter_swap(last - 2, last - (quarter + 1));
+        std::iter_swap(last - 3, last - (quarter + 2));
+    }
+}
+
+// Pattern-defeating quicksort (Orson Peters). Quicksort with median-of-3 (or ninther) pivots,
+// insertion sort for small ranges, detection of already-partitioned ranges and a heapsort
+// fallback that bounds the worst case to O(n log n).
+template <typename RandomIt, typename Compare>
+constexpr void pdqsort_loop(RandomIt first,
+                            RandomIt last,
+                            Compare& comparator,
+                            int bad_partitions_allowed,
+                            bool leftmost)
+{
+    while (true)
+    {
+        const std::ptrdiff_t size = last - first;
+        if (size < INSERTION_SORT_THRESHOLD)
+        {
+            if constexpr (HAS_BRANCHLESS_COMPARE_EXCHANGE<std::iter_value_t<RandomIt>>)
+            {
+                // Partitions of mostly sorted input are often sorted already. Checking costs
+                // one or two comparisons otherwise.
+                if (!std::is_sorted(first, last, comparator))
+                {
+                    branchless_insertion_sort(first, last, comparator);
+                }
+            }
+            else if (leftmost)
+            {
+                insertion_sort(first, last, comparator);
+            }
+            else
+            {
+                unguarded_insertion_sort(first, last, comparator);
+            }
+            return;
+        }
+
+        const std::ptrdiff_t half = size / 2;
+        if (size > NINTHER_THRESHOLD)
+        {
+            sort3(first, first + half, last - 1, comparator);
+            sort3(first + 1, first + (half - 1), last - 2, comparator);
+            sort3(first + 2, first + (half + 1), last - 3, comparator);
+            sort3(first + (half - 1), first + half, first + (half + 1), comparator);
+            std::iter_swap(first, first + half);
+        }
+        else
+        {
+            sort3(first + half, first, last - 1, comparator);
+        }
+
+        // If the pivot equals the element before this range (the pivot of a parent partition),
+        // everything equal to it is already in place.
+        if (!leftmost && !comparator(*std::prev(first), *first))
+        {
+            first = std::next(partition_left(first, last, comparator));
+            continue;
+        }
+
+        const auto [pivot_position, already_partitioned] =
+            partition_right(first, last, comparator);
+
+        const std::ptrdiff_t left_size = pivot_position - first;
+        const std::ptrdiff_t right_size = last - std::next(pivot_position);
+        if (left_size < size / 8 || right_size < size / 8)
+        {
+            bad_partitions_allowed--;
+            if (bad_partitions_allowed == 0)
+            {
+                std::make_heap(first, last, comparator);
+                std::sort_heap(first, last, comparator);
+                return;
+            }
+
+            shuffle_for_balance(first, pivot_position);
+            shuffle_for_balance(std::next(pivot_position), last);
+        }
+        else if (already_partitioned &&
+                 partial_insertion_sort(first, pivot_position, comparator) &&
+                 partial_insertion_sort(std::next(pivot_position), last, comparator))
+        {
+            return;
+        }
+
+        pdqsort_loop(first, pivot_position, comparator, bad_partitions_allowed, leftmost);
+        first = std::next(pivot_position);
+        leftmost = false;
+    }
+}
+
+template <typename RandomIt, typename Compare>
+constexpr void pdqsort(RandomIt first, RandomIt last, Compare& comparator)
+{
+    const auto size = static_cast<std::size_t>(last - first);
+    if (size <= 1)
+    {
+        return;
+    }
+    // A short input may well be sorted already, which `branchless_insertion_sort()` is slow on.
+    // Only the partitions are sorted without branches.
+    if (size < static_cast<std::size_t>(INSERTION_SORT_THRESHOLD))
+    {
+        insertion_sort(first, last, comparator);
+        return;
+    }
+    pdqsort_loop(first, last, comparator, static_cast<int>(std::bit_width(size)), true);
+}
+
+// In-place (rotation based) stable merge of the sorted ranges [first, middle) and
+// [middle, last).
+template <typename RandomIt, typename Compare>
+constexpr void merge_in_place(RandomIt first,
+                              RandomIt middle,
+                              RandomIt last,
+                              std::ptrdiff_t left_size,
+                              std::ptrdiff_t right_size,
+                              Compare& comparator)
+{
+    if (left_size == 0 || right_size == 0)
+    {
+        return;
+    }
+    if (left_size + right_size == 2)
+    {
+        if (comparator(*middle, *first))
+        {
+            std::iter_swap(first, middle);
+        }
+        return;
+    }
+
+    RandomIt left_cut = first;
+    RandomIt right_cut = middle;
+    std::ptrdiff_t left_cut_size = 0;
+    std::ptrdiff_t right_cut_size = 0;
+    if (left_size > right_size)
+    {
+        left_cut_size = left_size / 2;
+        left_cut = first + left_cut_size;
+        right_cut = std::lower_bound(middle, last, *left_cut, comparator);
+        right_cut_size = right_cut - middle;
+    }
+    else
+    {
+        right_cut_size = right_size / 2;
+        right_cut = middle + right_cut_size;
+        left_cut = std::upper_bound(first, middle, *right_cut, comparator);
+        left_cut_size = left_cut - first;
+    }
+
+    RandomIt new_middle = std::rotate(left_cut, middle, right_cut);
+    merge_in_place(first, left_cut, new_middle, left_cut_size, right_cut_size, comparator);
+    merge_in_place(new_middle,
+                   right_cut,
+                   last,
+                   left_size - left_cut_size,
+                   right_size - right_cut_size,
+                   comparator);
+}
+
+// Bottom-up merge sort over insertion-sorted chunks. Needs no buffer, so it works for any
+// movable type without allocating (or reserving stack for) another `CAPACITY` elements.
+template <typename RandomIt, typename Compare>
+constexpr void stable_merge_sort(RandomIt first, RandomIt last, Compare& comparator)
+{
+    const std::ptrdiff_t size = last - first;
+    for (std::ptrdiff_t i = 0; i < size; i += STABLE_SORT_CHUNK_SIZE)
+    {
+        insertion_sort(first + i, first + (std::min)(i + STABLE_SORT_CHUNK_SIZE, size), comparator);
+    }
+
+    for (std::ptrdiff_t width = STABLE_SORT_CHUNK_SIZE; width < size; width *= 2)
+    {
+        for (std::ptrdiff_t i = 0; i + width < size; i += 2 * width)
+        {
+            const std::ptrdiff_t right_size = (std::min)(width, size - (i + width));
+            merge_in_place(first + i,
+                           first + (i + width),
+                           first + (i + width + right_size),
+                           width,
+                           right_size,
+                           comparator);
+        }
+    }
+}
+
+template <std::size_t CAPACITY, typename RandomIt, typename Compare>
+constexpr void sort(RandomIt first, RandomIt last, Compare comparator)
+{
+    if constexpr (CAPACITY <= SORTING_NETWORK_MAX_SIZE)
+    {
+        sorting_network_sort<CAPACITY>(first, last, comparator);
+    }
+    else
+    {
+        pdqsort(first, last, comparator);
+    }
+}
+
+template <std::size_t CAPACITY, typename RandomIt, typename Compare>
+constexpr void stable_sort(RandomIt first, RandomIt last, Compare comparator)
+{
+    // Sorting networks are not stable, so small capacities use insertion sort.
+    if constexpr (CAPACITY <= SORTING_NETWORK_MAX_SIZE)
+    {
+        insertion_sort(first, last, comparator);
+    }
+    else
+    {
+        stable_merge_sort(first, last, comparator);
+    }
+}
+
+template <std::size_t CAPACITY, typename RandomIt, typename Compare>
+constexpr void partial_sort(RandomIt first, RandomIt middle, RandomIt last, Compare comparator)
+{
+    // For small capacities, sorting everything with a network is cheaper than heap selection.
+    if constexpr (CAPACITY <= SORTING_NETWORK_MAX_SIZE)
+    {
+        (void)middle;
+        sorting_network_sort<CAPACITY>(first, last, comparator);
+    }
+    else
+    {
+        std::partial_sort(first, middle, last, comparator);
+    }
+}
+
+template <std::size_t CAPACITY, typename RandomIt, typename Compare>
+constexpr void nth_element(RandomIt first, RandomIt nth, RandomIt last, Compare comparator)
+{
+    if constexpr (CAPACITY <= SORTING_NETWORK_MAX_SIZE)
+    {
+        (void)nth;
+        sorting_network_sort<CAPACITY>(first, last, comparator);
+    }
+    else
+    {
+        std::nth_element(first, nth, last, comparator);
+    }
+}
+
+}  // namespace fixed_containers::sort_detail
@@ -0,0 +1,661 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/bidirectional_iterator.hpp"
+#include "fixed_containers/checking_hooks.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/emplace.hpp"
+#include "fixed_containers/enum_utils.hpp"
+#include "fixed_containers/erase_if.hpp"
+#include "fixed_containers/fixed_bitset.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/map_checking.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/source_location.hpp"
+#include "fixed_containers/string_literal.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::sparse_enum_map_detail
+{
+// `SparseEnumMap` checks the keys and the size itself before touching its values, so running out
+// of capacity is the only failure its value array can see. That goes to the map's checking, and the
+// rest compile out along with the checks of the map.
+template <class K, customize::MapChecking<K> CheckingType>
+struct ValueArrayChecking
+{
+    [[noreturn]] static void out_of_range(const std::size_t /*index*/,
+                                          const std::size_t /*size*/,
+                                          const std_transition::source_location& /*loc*/)
+    {
+        preconditions::unreachable();
+    }
+
+    [[noreturn]] static void length_error(const std::size_t target_capacity,
+                                          const std_transition::source_location& loc)
+    {
+        CheckingType::length_error(target_capacity, loc);
+    }
+
+    [[noreturn]] static void empty_container_access(const std_transition::source_location& /*loc*/)
+    {
+        preconditions::unreachable();
+    }
+
+    [[noreturn]] static void invalid_argument(
+        const fixed_containers::StringLiteral& /*error_message*/,
+        const std_transition::source_location& /*loc*/)
+    {
+        preconditions::unreachable();
+    }
+};
+}  // namespace fixed_containers::sparse_enum_map_detail
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity map for enum keys, for large enums of which only a few keys are present at a
+ * time. Where `EnumMap` reserves a value slot for every enum constant, this stores a presence
+ * bitset over all the keys and only `MAXIMUM_SIZE` values, densely and in key order. The value
+ * of a key is found at the rank of its bit: the number of set bits before it.
+ * Properties:
+ *  - constexpr
+ *  - retains the properties of V (e.g. if T is trivially copyable, then so is SparseEnumMap)
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ *  - memory is `ENUM_COUNT` bits plus `MAXIMUM_SIZE` values, and a count per 64 keys
+ *
+ * Lookups are one popcount: a running count of the keys before each word of the bitset is kept
+ * alongside it. Inserting or erasing a key shifts the values after it and updates the running
+ * counts of the words after it, and invalidates iterators.
+ */
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          customize::MapChecking<K> CheckingType = customize::MapAbortChecking<K, V, MAXIMUM_SIZE>>
+class SparseEnumMap
+{
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<const K, V>;
+    using reference = std::pair<const K&, V&>;
+    using const_reference = std::pair<const K&, const V&>;
+    using pointer = std::add_pointer_t<reference>;
+    using const_pointer = std::add_pointer_t<const_reference>;
+
+private:
+    using EnumAdapterType = rich_enums::EnumAdapter<K>;
+    static constexpr std::size_t ENUM_COUNT = EnumAdapterType::count();
+    static_assert(MAXIMUM_SIZE <= ENUM_COUNT, "SparseEnumMap cannot hold more entries than keys");
+
+    using KeyArrayType = FixedBitset<ENUM_COUNT>;
+    using ValueArrayType = FixedVector<V,
+                                       MAXIMUM_SIZE,
+                                       sparse_enum_map_detail::ValueArrayChecking<K, CheckingType>>;
+    using BitsetHelper = fixed_bitset_detail::FixedBitsetHelper<ENUM_COUNT>;
+    using RankType = std::conditional_t<
+        (MAXIMUM_SIZE <= UINT8_MAX),
+        std::uint8_t,
+        std::conditional_t<(MAXIMUM_SIZE <= UINT16_MAX), std::uint16_t, std::size_t>>;
+    // Entry `i` is the number of keys present in the words of the bitset before word `i`
+    using RankArrayType = std::array<RankType, BitsetHelper::WORD_COUNT + 1>;
+    static constexpr const auto& ENUM_VALUES = EnumAdapterType::values();
+
+    template <bool IS_CONST>
+    class PairProvider
+    {
+        friend class PairProvider<!IS_CONST>;
+        using ConstOrMutableValueArray =
+            std::conditional_t<IS_CONST, const ValueArrayType, ValueArrayType>;
+
+    private:
+        fixed_bitset_detail::SetBitIndexProvider<KeyArrayType> present_indices_;
+        ConstOrMutableValueArray* values_;
+        // Position of the current entry in `values_`. Moves in lockstep with `present_indices_`,
+        // including wrapping around to `-1` before the first entry.
+        std::size_t dense_index_;
+
+    public:
+        constexpr PairProvider() noexcept
+          : PairProvider{nullptr, nullptr, ENUM_COUNT, 0}
+        {
+        }
+
+        constexpr PairProvider(const KeyArrayType* array_set,
+                               ConstOrMutableValueArray* const values,
+                               const std::size_t current_index,
+                               const std::size_t dense_index) noexcept
+          : present_indices_{array_set, current_index}
+          , values_{values}
+          , dense_index_{dense_index}
+        {
+        }
+
+        constexpr PairProvider(const PairProvider&) = default;
+        constexpr PairProvider(PairProvider&&) noexcept = default;
+        constexpr PairProvider& operator=(const PairProvider& other) = default;
+        constexpr PairProvider& operator=(PairProvider&&) noexcept = default;
+
+        // https://github.com/llvm/llvm-project/issues/62555
+        template <bool IS_CONST_2>
+        constexpr PairProvider(const PairProvider<IS_CONST_2>& mutable_other) noexcept
+            requires(IS_CONST and !IS_CONST_2)
+          : present_indices_{mutable_other.present_indices_}
+          , values_{mutable_other.values_}
+          , dense_index_{mutable_other.dense_index_}
+        {
+        }
+
+        constexpr void advance() noexcept
+        {
+            present_indices_.advance();
+            ++dense_index_;
+        }
+        constexpr void recede() noexcept
+        {
+            present_indices_.recede();
+            --dense_index_;
+        }
+
+        [[nodiscard]] constexpr std::conditional_t<IS_CONST, const_reference, reference> get()
+            const noexcept
+        {
+            return {ENUM_VALUES[present_indices_.get()], *std::next(values_->begin(), offset())};
+        }
+
+        template <bool IS_CONST2>
+        constexpr bool operator==(const PairProvider<IS_CONST2>& other) const noexcept
+        {
+            return values_ == other.values_ && present_indices_ == other.present_indices_;
+        }
+
+    private:
+        [[nodiscard]] constexpr std::ptrdiff_t offset() const noexcept
+        {
+            return static_cast<std::ptrdiff_t>(dense_index_);
+        }
+    };
+
+    template <IteratorConstness CONSTNESS, IteratorDirection DIRECTION>
+    using IteratorImpl =
+        BidirectionalIterator<PairProvider<true>, PairProvider<false>, CONSTNESS, DIRECTION>;
+
+public:
+    using const_iterator =
+        IteratorImpl<IteratorConstness::CONSTANT_ITERATOR, IteratorDirection::FORWARD>;
+    using iterator = IteratorImpl<IteratorConstness::MUTABLE_ITERATOR, IteratorDirection::FORWARD>;
+    using const_reverse_iterator =
+        IteratorImpl<IteratorConstness::CONSTANT_ITERATOR, IteratorDirection::REVERSE>;
+    using reverse_iterator =
+        IteratorImpl<IteratorConstness::MUTABLE_ITERATOR, IteratorDirection::REVERSE>;
+    using size_type = typename KeyArrayType::size_type;
+    using difference_type = typename KeyArrayType::difference_type;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    KeyArrayType IMPLEMENTATION_DETAIL_DO_NOT_USE_array_set_;
+    RankArrayType IMPLEMENTATION_DETAIL_DO_NOT_USE_ranks_;
+    ValueArrayType IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+
+public:
+    constexpr SparseEnumMap() noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_array_set_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_ranks_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_values_{}
+    {
+    }
+
+    template <InputIterator InputIt>
+    constexpr SparseEnumMap(InputIt first,
+                            InputIt last,
+                            const std_transition::source_location& loc =
+                                std_transition::source_location::current())
+      : SparseEnumMap()
+    {
+        insert(first, last, loc);
+    }
+
+    constexpr SparseEnumMap(std::initializer_list<value_type> list,
+                            const std_transition::source_location& loc =
+                                std_transition::source_location::current()) noexcept
+      : SparseEnumMap()
+    {
+        this->insert(list, loc);
+    }
+
+public:
+    [[nodiscard]] constexpr V& at(const K& key,
+                                  const std_transition::source_location& loc =
+                                      std_transition::source_location::current()) noexcept
+    {
+        const std::size_t ordinal = EnumAdapterType::ordinal(key);
+        if (preconditions::test(contains_at(ordinal)))
+        {
+            CheckingType::out_of_range(key, size(), loc);
+        }
+        return unchecked_at(ordinal);
+    }
+    [[nodiscard]] constexpr const V& at(
+        const K& key,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const noexcept
+    {
+        const std::size_t ordinal = EnumAdapterType::ordinal(key);
+        if (preconditions::test(contains_at(ordinal)))
+        {
+            CheckingType::out_of_range(key, size(), loc);
+        }
+        return unchecked_at(ordinal);
+    }
+    constexpr V& operator[](const K& key) noexcept
+    {
+        const std::size_t ordinal = EnumAdapterType::ordinal(key);
+        if (!contains_at(ordinal))
+        {
+            check_not_full(std_transition::source_location::current());
+            emplace_at(ordinal);
+        }
+        return unchecked_at(ordinal);
+    }
+
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept
+    {
+        return create_const_iterator(0);
+    }
+    [[nodiscard]] constexpr const_iterator cend() const noexcept
+    {
+        return create_const_iterator(ENUM_COUNT);
+    }
+    [[nodiscard]] constexpr const_iterator begin() const noexcept { return cbegin(); }
+    constexpr iterator begin() noexcept { return create_iterator(0); }
+    [[nodiscard]] constexpr const_iterator end() const noexcept { return cend(); }
+    constexpr iterator end() noexcept { return create_iterator(ENUM_COUNT); }
+
+    constexpr reverse_iterator rbegin() noexcept { return create_reverse_iterator(ENUM_COUNT); }
+    [[nodiscard]] constexpr const_reverse_iterator rbegin() const noexcept { return crbegin(); }
+    [[nodiscard]] constexpr const_reverse_iterator crbegin() const noexcept
+    {
+        return create_const_reverse_iterator(ENUM_COUNT);
+    }
+    constexpr reverse_iterator rend() noexcept { return create_reverse_iterator(0); }
+    [[nodiscard]] constexpr const_reverse_iterator rend() const noexcept { return crend(); }
+    [[nodiscard]] constexpr const_reverse_iterator crend() const noexcept
+    {
+        return create_const_reverse_iterator(0);
+    }
+
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return values().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+
+    constexpr void clear() noexcept
+    {
+        const std::size_t previous_size = size();
+        values().clear();
+        array_set().reset();
+        ranks() = {};
+        record_erase(previous_size);
+    }
+
+    constexpr std::pair<iterator, bool> insert(
+        const value_type& value,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return try_emplace_impl(value.first, loc, value.second);
+    }
+    constexpr std::pair<iterator, bool> insert(
+        value_type&& value,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return try_emplace_impl(value.first, loc, std::move(value.second));
+    }
+
+    template <InputIterator InputIt>
+    constexpr void insert(InputIt first,
+                          InputIt last,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        for (; first != last; std::advance(first, 1))
+        {
+            this->insert(*first, loc);
+        }
+    }
+    constexpr void insert(std::initializer_list<value_type> list,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        this->insert(list.begin(), list.end(), loc);
+    }
+
+    template <class M>
+    constexpr std::pair<iterator, bool> insert_or_assign(
+        const K& key,
+        M&& obj,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+        requires std::is_assignable_v<mapped_type&, M&&>
+    {
+        const std::size_t ordinal = EnumAdapterType::ordinal(key);
+        if (contains_at(ordinal))
+        {
+            unchecked_at(ordinal) = std::forward<M>(obj);
+            return {create_iterator(ordinal), false};
+        }
+
+        check_not_full(loc);
+        emplace_at(ordinal, std::forward<M>(obj));
+        return {create_iterator(ordinal), true};
+    }
+    template <class M>
+    constexpr iterator insert_or_assign(const_iterator /*hint*/,
+                                        const K& key,
+                                        M&& obj,
+                                        const std_transition::source_location& loc =
+                                            std_transition::source_location::current()) noexcept
+        requires std::is_assignable_v<mapped_type&, M&&>
+    {
+        return insert_or_assign(key, std::forward<M>(obj), loc).first;
+    }
+
+    template <class... Args>
+    constexpr std::pair<iterator, bool> try_emplace(const K& key, Args&&... args) noexcept
+    {
+        return try_emplace_impl(
+            key, std_transition::source_location::current(), std::forward<Args>(args)...);
+    }
+    template <class... Args>
+    constexpr std::pair<iterator, bool> try_emplace(const_iterator /*hint*/,
+                                                    const K& key,
+                                                    Args&&... args) noexcept
+    {
+        return try_emplace(key, std::forward<Args>(args)...);
+    }
+
+    template <class... Args>
+        requires(sizeof...(Args) >= 1 and sizeof...(Args) <= 3)
+    constexpr std::pair<iterator, bool> emplace(Args&&... args) noexcept
+    {
+        return emplace_detail::emplace_in_terms_of_try_emplace_impl(*this,
+                                                                    std::forward<Args>(args)...);
+    }
+    template <class... Args>
+    constexpr std::pair<iterator, bool> emplace_hint(const_iterator /*hint*/,
+                                                     Args&&... args) noexcept
+    {
+        return emplace(std::forward<Args>(args)...);
+    }
+
+    constexpr iterator erase(const_iterator pos) noexcept
+    {
+        assert_or_abort(pos != cend());
+        const std::size_t index = EnumAdapterType::ordinal(pos->first);
+        assert_or_abort(contains_at(index));
+        reset_at(index);
+        return create_iterator(index);
+    }
+    constexpr iterator erase(iterator pos) noexcept { return erase(const_iterator{pos}); }
+
+    constexpr iterator erase(const_iterator first, const_iterator last) noexcept
+    {
+        const std::size_t from_inclusive =
+            first == cend() ? ENUM_COUNT : EnumAdapterType::ordinal(first->first);
+        const std::size_t to_exclusive =
+            last == cend() ? ENUM_COUNT : EnumAdapterType::ordinal(last->first);
+        assert_or_abort(from_inclusive <= to_exclusive);
+
+        // The erased entries are contiguous in `values()`, so they are removed in one go.
+        const std::size_t dense_from = rank(from_inclusive);
+        const std::size_t dense_to = rank(to_exclusive);
+        values().erase(std::next(values().begin(), static_cast<std::ptrdiff_t>(dense_from)),
+                       std::next(values().begin(), static_cast<std::ptrdiff_t>(dense_to)));
+        for (std::size_t i = from_inclusive; i < to_exclusive; i = array_set().find_next(i))
+        {
+            array_set().reset(i);
+        }
+        // The running count of a word drops by the number of erased keys before it: the part of
+        // `[dense_from, dense_to)` that it covers.
+        for (std::size_t w_pos = (from_inclusive / BitsetHelper::BITS_PER_WORD) + 1;
+             w_pos < ranks().size();
+             ++w_pos)
+        {
+            const std::size_t previous_rank = ranks()[w_pos];
+            const std::size_t erased_before =
+                std::clamp(previous_rank, dense_from, dense_to) - dense_from;
+            ranks()[w_pos] = static_cast<RankType>(previous_rank - erased_before);
+        }
+        record_erase(dense_to - dense_from);
+
+        return create_iterator(to_exclusive);
+    }
+
+    constexpr size_type erase(const K& key) noexcept
+    {
+        const std::size_t index = EnumAdapterType::ordinal(key);
+        if (!contains_at(index))
+        {
+            return 0;
+        }
+
+        reset_at(index);
+        return 1;
+    }
+
+    [[nodiscard]] constexpr iterator find(const K& key) noexcept
+    {
+        const std::size_t ordinal = EnumAdapterType::ordinal(key);
+        checking_hooks::record_lookup<CheckingType>();
+        if (!this->contains_at(ordinal))
+        {
+            return this->end();
+        }
+
+        return create_iterator(ordinal);
+    }
+
+    [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
+    {
+        const std::size_t ordinal = EnumAdapterType::ordinal(key);
+        checking_hooks::record_lookup<CheckingType>();
+        if (!this->contains_at(ordinal))
+        {
+            return this->cend();
+        }
+
+        return create_const_iterator(ordinal);
+    }
+
+    [[nodiscard]] constexpr bool contains(const K& key) const noexcept
+    {
+        checking_hooks::record_lookup<CheckingType>();
+        return contains_at(EnumAdapterType::ordinal(key));
+    }
+
+    [[nodiscard]] constexpr std::size_t count(const K& key) const noexcept
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+
+    template <std::size_t MAXIMUM_SIZE_2, customize::MapChecking<K> CheckingType2>
+    [[nodiscard]] constexpr bool operator==(
+        const SparseEnumMap<K, V, MAXIMUM_SIZE_2, CheckingType2>& other) const
+    {
+        // Both store their values in key order, so equal key sets means aligned values.
+        return array_set() == other.IMPLEMENTATION_DETAIL_DO_NOT_USE_array_set_ &&
+               std::equal(values().begin(),
+                          values().end(),
+                          other.IMPLEMENTATION_DETAIL_DO_NOT_USE_values_.begin());
+    }
+
+private:
+    template <class... Args>
+    constexpr std::pair<iterator, bool> try_emplace_impl(
+        const K& key, const std_transition::source_location& loc, Args&&... args)
+    {
+        const std::size_t ordinal = EnumAdapterType::ordinal(key);
+        if (contains_at(ordinal))
+        {
+            return {create_iterator(ordinal), false};
+        }
+
+        check_not_full(loc);
+        emplace_at(ordinal, std::forward<Args>(args)...);
+        return {create_iterator(ordinal), true};
+    }
+
+    template <class... Args>
+    constexpr void emplace_at(const std::size_t ordinal, Args&&... args)
+    {
+        const auto dense_index = static_cast<std::ptrdiff_t>(rank(ordinal));
+        values().emplace(std::next(values().cbegin(), dense_index), std::forward<Args>(args)...);
+        array_set().set(ordinal);
+        update_ranks_after(ordinal, 1);
+        checking_hooks::record_insert<CheckingType>(1, size());
+    }
+
+    constexpr void reset_at(const std::size_t index) noexcept
+    {
+        assert_or_abort(contains_at(index));
+        const auto dense_index = static_cast<std::ptrdiff_t>(rank(index));
+        values().erase(std::next(values().cbegin(), dense_index));
+        array_set().reset(index);
+        update_ranks_after(index, -1);
+        record_erase(1);
+    }
+
+    // Number of keys present before `index`
+    [[nodiscard]] constexpr std::size_t rank(const std::size_t index) const noexcept
+    {
+        if (index >= ENUM_COUNT)
+        {
+            return size();
+        }
+        return ranks()[index / BitsetHelper::BITS_PER_WORD] + array_set().rank_within_word(index);
+    }
+
+    constexpr void update_ranks_after(const std::size_t index, const int delta) noexcept
+    {
+        for (std::size_t w_pos = (index / BitsetHelper::BITS_PER_WORD) + 1; w_pos < ranks().size();
+             ++w_pos)
+        {
+            ranks()[w_pos] = static_cast<RankType>(ranks()[w_pos] + delta);
+        }
+    }
+
+    constexpr void record_erase(const std::size_t count) const
+    {
+        if (count > 0)
+        {
+            checking_hooks::record_erase<CheckingType>(count, size());
+        }
+    }
+
+    constexpr void check_not_full(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(size() < MAXIMUM_SIZE))
+        {
+            CheckingType::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+
+    constexpr iterator create_iterator(const std::size_t start_index) noexcept
+    {
+        return iterator{PairProvider<false>{std::addressof(array_set()),
+                                            std::addressof(values()),
+                                            start_index,
+                                            rank(start_index)}};
+    }
+
+    [[nodiscard]] constexpr const_iterator create_const_iterator(
+        const std::size_t start_index) const noexcept
+    {
+        return const_iterator{PairProvider<true>{std::addressof(array_set()),
+                                                 std::addressof(values()),
+                                                 start_index,
+                                                 rank(start_index)}};
+    }
+
+    constexpr reverse_iterator create_reverse_iterator(const std::size_t start_index) noexcept
+    {
+        return reverse_iterator{PairProvider<false>{std::addressof(array_set()),
+                                                    std::addressof(values()),
+                                                    start_index,
+                                                    rank(start_index)}};
+    }
+
+    [[nodiscard]] constexpr const_reverse_iterator create_const_reverse_iterator(
+        const std::size_t start_index) const noexcept
+    {
+        return const_reverse_iterator{PairProvider<true>{std::addressof(array_set()),
+                                                         std::addressof(values()),
+                                                         start_index,
+                                                         rank(start_index)}};
+    }
+
+    [[nodiscard]] constexpr const KeyArrayType& array_set() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_array_set_;
+    }
+    constexpr KeyArrayType& array_set() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_array_set_; }
+
+    [[nodiscard]] constexpr const RankArrayType& ranks() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_ranks_;
+    }
+    constexpr RankArrayType& ranks() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_ranks_; }
+
+    [[nodiscard]] constexpr const ValueArrayType& values() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+    }
+    constexpr ValueArrayType& values() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_values_; }
+
+    [[nodiscard]] constexpr const V& unchecked_at(const std::size_t index) const
+    {
+        const auto dense_index = static_cast<std::ptrdiff_t>(rank(index));
+        return *std::next(values().begin(), dense_index);
+    }
+    constexpr V& unchecked_at(const std::size_t index)
+    {
+        const auto dense_index = static_cast<std::ptrdiff_t>(rank(index));
+        return *std::next(values().begin(), dense_index);
+    }
+
+    [[nodiscard]] constexpr bool contains_at(const std::size_t index) const noexcept
+    {
+        return array_set().test(index);
+    }
+};
+
+template <class K, class V, std::size_t MAXIMUM_SIZE, customize::MapChecking<K> CheckingType>
+[[nodiscard]] constexpr bool is_full(
+    const SparseEnumMap<K, V, MAXIMUM_SIZE, CheckingType>& container)
+{
+    return container.size() >= container.max_size();
+}
+
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          customize::MapChecking<K> CheckingType,
+          class Predicate>
+constexpr typename SparseEnumMap<K, V, MAXIMUM_SIZE, CheckingType>::size_type erase_if(
+    SparseEnumMap<K, V, MAXIMUM_SIZE, CheckingType>& container, Predicate predicate)
+{
+    return erase_if_detail::erase_if_impl(container, predicate);
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,352 @@
+#pragma once
+
+#include "fixed_containers/source_location.hpp"
+#include "fixed_containers/string_literal.hpp"
+#include "fixed_containers/type_name.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+#include <type_traits>
+
+namespace fixed_containers::customize
+{
+/**
+ * Usage statistics of one container type, collected by the `StatsChecking` policies. All the
+ * counters are updated with relaxed atomics, so they can be read while the containers are in use.
+ */
+struct ContainerStats
+{
+    // An insert that brings the size to this share of the capacity is a near-overflow event.
+    static constexpr std::size_t NEAR_FULL_PERCENT = 90;
+
+    std::string_view container_kind;
+    std::string_view element_type_name;
+    // Empty for anything but maps
+    std::string_view mapped_type_name;
+    std::string_view tag_name;
+    std::size_t capacity;
+
+    std::atomic<std::size_t> high_water_mark{};
+    std::atomic<std::uint64_t> insert_count{};
+    std::atomic<std::uint64_t> erase_count{};
+    std::atomic<std::uint64_t> lookup_count{};
+    std::atomic<std::uint64_t> near_full_count{};
+    std::atomic<std::uint64_t> overflow_count{};
+
+    // Registry bookkeeping. `next` is only written before the entry is published.
+    std::atomic<bool> registered{};
+    ContainerStats* next{};
+
+    constexpr ContainerStats(std::string_view kind,
+                             std::string_view element_name,
+                             std::string_view mapped_name,
+                             std::string_view tag,
+                             std::size_t maximum_size) noexcept
+      : container_kind{kind}
+      , element_type_name{element_name}
+      , mapped_type_name{mapped_name}
+      , tag_name{tag}
+      , capacity{maximum_size}
+    {
+    }
+
+    [[nodiscard]] constexpr std::size_t near_full_threshold() const
+    {
+        return ((capacity * NEAR_FULL_PERCENT) + 99) / 100;
+    }
+};
+
+/**
+ * Process-wide list of the `ContainerStats` of every container type that has been used with a
+ * `StatsChecking` policy. Entries add themselves on first use with a compare-and-swap and are
+ * never removed, so neither registering nor reading ever takes a lock.
+ */
+class ContainerStatsRegistry
+{
+    static inline std::atomic<ContainerStats*> head_{};
+
+public:
+    static void add(ContainerStats& stats) noexcept
+    {
+        if (stats.registered.load(std::memory_order_relaxed) ||
+            stats.registered.exchange(true, std::memory_order_relaxed))
+        {
+            return;
+        }
+        ContainerStats* head = head_.load(std::memory_order_relaxed);
+        do
+        {
+            stats.next = head;
+        } while (!head_.compare_exchange_weak(
+            head, &stats, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    template <typename Function>
+    static void for_each(Function&& function)
+    {
+        for (const ContainerStats* stats = head_.load(std::memory_order_acquire); stats != nullptr;
+             stats = stats->next)
+        {
+            function(*stats);
+        }
+    }
+
+    // One line per container type, most recently registered first.
+    static void dump(std::FILE* out = stderr)
+    {
+        std::fprintf(out,
+                     "%-9s %10s %10s %12s %12s %12s %9s %9s  %s\n",
+                     "kind",
+                     "capacity",
+                     "high_water",
+                     "inserts",
+                     "erases",
+                     "lookups",
+                     "near_full",
+                     "overflows",
+                     "type [tag]");
+        for_each(
+            [out](const ContainerStats& stats)
+            {
+                std::fprintf(out,
+                             "%-9.*s %10zu %10zu %12llu %12llu %12llu %9llu %9llu  %.*s",
+                             static_cast<int>(stats.container_kind.size()),
+                             stats.container_kind.data(),
+                             stats.capacity,
+                             stats.high_water_mark.load(std::memory_order_relaxed),
+                             as_printable(stats.insert_count),
+                             as_printable(stats.erase_count),
+                             as_printable(stats.lookup_count),
+                             as_printable(stats.near_full_count),
+                             as_printable(stats.overflow_count),
+                             static_cast<int>(stats.element_type_name.size()),
+                             stats.element_type_name.data());
+                if (!stats.mapped_type_name.empty())
+                {
+                    std::fprintf(out,
+                                 " -> %.*s",
+                                 static_cast<int>(stats.mapped_type_name.size()),
+                                 stats.mapped_type_name.data());
+                }
+                if (!stats.tag_name.empty())
+                {
+                    std::fprintf(out,
+                                 " [%.*s]",
+                                 static_cast<int>(stats.tag_name.size()),
+                                 stats.tag_name.data());
+                }
+                std::fprintf(out, "\n");
+            });
+        std::fflush(out);
+    }
+
+    // Dumps to stderr when the process exits normally. Calling this more than once has no effect.
+    static void dump_at_exit()
+    {
+        static const bool INSTALLED = std::atexit([]() { dump(stderr); }) == 0;
+        static_cast<void>(INSTALLED);
+    }
+
+private:
+    static unsigned long long as_printable(const std::atomic<std::uint64_t>& counter)
+    {
+        return static_cast<unsigned long long>(counter.load(std::memory_order_relaxed));
+    }
+};
+
+namespace stats_checking_detail
+{
+template <typename Tag>
+constexpr std::string_view tag_name()
+{
+    if constexpr (std::is_void_v<Tag>)
+    {
+        return {};
+    }
+    else
+    {
+        return type_name<Tag>();
+    }
+}
+
+inline void record_insert(ContainerStats& stats, std::size_t count, std::size_t size_after)
+{
+    ContainerStatsRegistry::add(stats);
+    stats.insert_count.fetch_add(count, std::memory_order_relaxed);
+
+    std::size_t high_water_mark = stats.high_water_mark.load(std::memory_order_relaxed);
+    while (size_after > high_water_mark &&
+           !stats.high_water_mark.compare_exchange_weak(
+               high_water_mark, size_after, std::memory_order_relaxed))
+    {
+    }
+
+    const std::size_t threshold = stats.near_full_threshold();
+    if (size_after >= threshold && size_after - count < threshold)
+    {
+        stats.near_full_count.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+inline void record_erase(ContainerStats& stats, std::size_t count)
+{
+    ContainerStatsRegistry::add(stats);
+    stats.erase_count.fetch_add(count, std::memory_order_relaxed);
+}
+
+inline void record_lookup(ContainerStats& stats)
+{
+    ContainerStatsRegistry::add(stats);
+    stats.lookup_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+// The report is most useful right before the abort, as atexit handlers won't run.
+[[noreturn]] inline void overflow(ContainerStats& stats)
+{
+    ContainerStatsRegistry::add(stats);
+    stats.overflow_count.fetch_add(1, std::memory_order_relaxed);
+    ContainerStatsRegistry::dump(stderr);
+    std::abort();
+}
+}  // namespace stats_checking_detail
+
+/**
+ * Checking policy for capacity planning: aborts on violations like
+ * `SequenceContainerAbortChecking`, and additionally records the high-water mark, the insert and
+ * erase counts and the near-overflow events of the container type in `ContainerStatsRegistry`. A
+ * capacity overflow dumps the registry to stderr before aborting.
+ *
+ * Statistics are per type: all containers with the same policy share them. Pass a distinct `Tag`
+ * to tell apart containers that would otherwise have the same element type and capacity.
+ */
+template <typename T, std::size_t MAXIMUM_SIZE, typename Tag = void>
+struct SequenceContainerStatsChecking
+{
+    static constexpr auto TYPE_NAME = fixed_containers::type_name<T>();
+
+    static ContainerStats& stats() noexcept { return STATS; }
+
+    static void record_insert(const std::size_t count, const std::size_t size_after)
+    {
+        stats_checking_detail::record_insert(STATS, count, size_after);
+    }
+    static void record_erase(const std::size_t count, const std::size_t /*size_after*/)
+    {
+        stats_checking_detail::record_erase(STATS, count);
+    }
+
+    [[noreturn]] static void out_of_range(const std::size_t /*index*/,
+                                          const std::size_t /*size*/,
+                                          const std_transition::source_location& /*loc*/)
+    {
+        std::abort();
+    }
+
+    [[noreturn]] static void length_error(const std::size_t /*target_capacity*/,
+                                          const std_transition::source_location& /*loc*/)
+    {
+        stats_checking_detail::overflow(STATS);
+    }
+
+    [[noreturn]] static void empty_container_access(const std_transition::source_location& /*loc*/)
+    {
+        std::abort();
+    }
+
+    [[noreturn]] static void invalid_argument(
+        const fixed_containers::StringLiteral& /*error_message*/,
+        const std_transition::source_location& /*loc*/)
+    {
+        std::abort();
+    }
+
+private:
+    static inline ContainerStats STATS{
+        "sequence", TYPE_NAME, {}, stats_checking_detail::tag_name<Tag>(), MAXIMUM_SIZE};
+};
+
+// Same as `SequenceContainerStatsChecking`, for maps. Also counts lookups. Satisfies
+// `EnumMapChecking` too, so it can be used with `EnumMap` and `SparseEnumMap`.
+template <class K, class V, std::size_t MAXIMUM_SIZE, typename Tag = void>
+struct MapStatsChecking
+{
+    static constexpr auto KEY_TYPE_NAME = fixed_containers::type_name<K>();
+    static constexpr auto VALUE_TYPE_NAME = fixed_containers::type_name<V>();
+
+    static ContainerStats& stats() noexcept { return STATS; }
+
+    static void record_insert(const std::size_t count, const std::size_t size_after)
+    {
+        stats_checking_detail::record_insert(STATS, count, size_after);
+    }
+    static void record_erase(const std::size_t count, const std::size_t /*size_after*/)
+    {
+        stats_checking_detail::record_erase(STATS, count);
+    }
+    static void record_lookup() { stats_checking_detail::record_lookup(STATS); }
+
+    [[noreturn]] static void out_of_range(const K& /*key*/,
+                                          const std::size_t /*size*/,
+                                          const std_transition::source_location& /*loc*/)
+    {
+        std::abort();
+    }
+
+    [[noreturn]] static void length_error(const std::size_t /*target_capacity*/,
+                                          const std_transition::source_location& /*loc*/)
+    {
+        stats_checking_detail::overflow(STATS);
+    }
+
+    [[noreturn]] static void missing_enum_entries(const std_transition::source_location& /*loc*/)
+    {
+        std::abort();
+    }
+
+    [[noreturn]] static void duplicate_enum_entries(
+        const std_transition::source_location& /*loc*/)
+    {
+        std::abort();
+    }
+
+private:
+    static inline ContainerStats STATS{"map",
+                                       KEY_TYPE_NAME,
+                                       VALUE_TYPE_NAME,
+                                       stats_checking_detail::tag_name<Tag>(),
+                                       MAXIMUM_SIZE};
+};
+
+// Same as `SequenceContainerStatsChecking`, for sets. Also counts lookups.
+template <class K, std::size_t MAXIMUM_SIZE, typename Tag = void>
+struct SetStatsChecking
+{
+    static constexpr auto KEY_TYPE_NAME = fixed_containers::type_name<K>();
+
+    static ContainerStats& stats() noexcept { return STATS; }
+
+    static void record_insert(const std::size_t count, const std::size_t size_after)
+    {
+        stats_checking_detail::record_insert(STATS, count, size_after);
+    }
+    static void record_erase(const std::size_t count, const std::size_t /*size_after*/)
+    {
+        stats_checking_detail::record_erase(STATS, count);
+    }
+    static void record_lookup() { stats_checking_detail::record_lookup(STATS); }
+
+    [[noreturn]] static void length_error(const std::size_t /*target_capacity*/,
+                                          const std_transition::source_location& /*loc*/)
+    {
+        stats_checking_detail::overflow(STATS);
+    }
+
+private:
+    static inline ContainerStats STATS{
+        "set", KEY_TYPE_NAME, {}, stats_checking_detail::tag_name<Tag>(), MAXIMUM_SIZE};
+};
+}  // namespace fixed_containers::customize
@@ -1,12 +1,21 @@
 #pragma once
 
+#include "fixed_containers/assert_or_abort.hpp"
+
+#include <algorithm>
 #include <array>
 #include <bit>
+#include <concepts>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <iterator>
 #include <memory>
+#include <span>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 
 // This is a stripped-down implementation of wyhash: https://github.com/wangyi-fudan/wyhash
 // No big-endian support (because different values on different machines don't matter),
@@ -61,37 +70,50 @@ constexpr void mum(std::uint64_t* aaa, std::uint64_t* bbb)
     return aaa ^ bbb;
 }
 
+// Any single-byte type can be read, so that `char` strings can be hashed in constant expressions,
+// where they can't be reinterpreted as `std::uint8_t`.
+template <typename T>
+concept HashableByte = sizeof(T) == 1 && std::is_trivially_copyable_v<T>;
+
+[[nodiscard]] constexpr std::uint8_t to_byte(HashableByte auto byte)
+{
+    return std::bit_cast<std::uint8_t>(byte);
+}
+
 // read functions. WARNING: we don't care about endianness, so results are different on big endian!
-[[nodiscard]] inline auto r8(const std::uint8_t* ppp) -> std::uint64_t
+template <HashableByte ByteT>
+[[nodiscard]] constexpr auto r8(const ByteT* ppp) -> std::uint64_t
 {
     std::array<std::uint8_t, 8> bytes{};
-    std::copy_n(ppp, 8, bytes.begin());
+    std::transform(ppp, std::next(ppp, 8), bytes.begin(), to_byte<ByteT>);
     return std::bit_cast<std::uint64_t>(bytes);
 }
 
-[[nodiscard]] inline auto r4(const std::uint8_t* ppp) -> std::uint64_t
+template <HashableByte ByteT>
+[[nodiscard]] constexpr auto r4(const ByteT* ppp) -> std::uint64_t
 {
     std::array<std::uint8_t, 4> bytes{};
-    std::copy_n(ppp, 4, bytes.begin());
+    std::transform(ppp, std::next(ppp, 4), bytes.begin(), to_byte<ByteT>);
     return static_cast<std::uint64_t>(std::bit_cast<std::uint32_t>(bytes));
 }
 
 // reads 1, 2, or 3 bytes
-[[nodiscard]] inline auto r3(const std::uint8_t* ppp, std::int64_t kkk) -> std::uint64_t
+template <HashableByte ByteT>
+[[nodiscard]] constexpr auto r3(const ByteT* ppp, std::int64_t kkk) -> std::uint64_t
 {
-    return (static_cast<std::uint64_t>(*ppp) << 16U) |
-           (static_cast<std::uint64_t>(*std::next(ppp, kkk >> 1U)) << 8U) |
-           *std::next(ppp, kkk - 1);
+    return (static_cast<std::uint64_t>(to_byte(*ppp)) << 16U) |
+           (static_cast<std::uint64_t>(to_byte(*std::next(ppp, kkk >> 1U))) << 8U) |
+           to_byte(*std::next(ppp, kkk - 1));
 }
 
-[[maybe_unused]] [[nodiscard]] inline auto hash(void const* key, std::int64_t len) -> std::uint64_t
+template <HashableByte ByteT>
+[[nodiscard]] constexpr auto hash_bytes(const ByteT* ppp, std::int64_t len) -> std::uint64_t
 {
     constexpr auto SECRET = std::array{UINT64_C(0xa0761d6478bd642f),
                                        UINT64_C(0xe7037ed1a0b428db),
                                        UINT64_C(0x8ebc6af09c88c6e3),
                                        UINT64_C(0x589965cc75374cc3)};
 
-    auto const* ppp = static_cast<std::uint8_t const*>(key);
     std::uint64_t seed = SECRET[0];
     std::uint64_t aaa{};
     std::uint64_t bbb{};
@@ -144,11 +166,58 @@ constexpr void mum(std::uint64_t* aaa, std::uint64_t* bbb)
     return mix(SECRET[1] ^ static_cast<std::uint64_t>(len), mix(aaa ^ SECRET[1], bbb ^ seed));
 }
 
+[[maybe_unused]] [[nodiscard]] inline auto hash(void const* key, std::int64_t len) -> std::uint64_t
+{
+    return hash_bytes(static_cast<std::uint8_t const*>(key), len);
+}
+
 [[nodiscard]] constexpr std::uint64_t hash(std::uint64_t value)
 {
     return mix(value, UINT64_C(0x9E3779B97F4A7C15));
 }
 
+// Types whose value is exactly their bytes: equal values have equal bytes and vice versa.
+template <typename T>
+concept ByteHashable =
+    std::is_trivially_copyable_v<T> && std::has_unique_object_representations_v<T>;
+
+// Hashes the bytes of `count` contiguous objects, in one call. Gives the same results in constant
+// expressions, where the objects are first gathered into a byte array, as their bytes can't be
+// read in place there.
+template <std::size_t MAXIMUM_COUNT, ByteHashable T>
+[[nodiscard]] constexpr std::uint64_t hash_objects(const T* first, std::size_t count)
+{
+    const auto len = static_cast<std::int64_t>(count * sizeof(T));
+    if (!std::is_constant_evaluated())
+    {
+        return hash(static_cast<void const*>(first), len);
+    }
+
+    if constexpr (HashableByte<T>)
+    {
+        return hash_bytes(first, len);
+    }
+    else
+    {
+        std::array<std::uint8_t, MAXIMUM_COUNT * sizeof(T)> bytes{};
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const auto object_bytes =
+                std::bit_cast<std::array<std::uint8_t, sizeof(T)>>(*std::next(first, i));
+            std::copy(object_bytes.begin(),
+                      object_bytes.end(),
+                      std::next(bytes.begin(), static_cast<std::ptrdiff_t>(i * sizeof(T))));
+        }
+        return hash_bytes(bytes.data(), len);
+    }
+}
+
+// For composites whose parts must be hashed one by one.
+[[nodiscard]] constexpr std::uint64_t combine(std::uint64_t seed, std::uint64_t value)
+{
+    return mix(seed ^ UINT64_C(0xa0761d6478bd642f), value ^ UINT64_C(0xe7037ed1a0b428db));
+}
+
 }  // namespace fixed_containers::wyhash_detail
 
 namespace fixed_containers::wyhash
@@ -186,6 +255,16 @@ struct hash<std::basic_string_view<CharT>>
     }
 };
 
+// Also usable in constant expressions, with the same results as at runtime.
+template <wyhash_detail::HashableByte CharT>
+struct hash<std::basic_string_view<CharT>>
+{
+    constexpr std::uint64_t operator()(std::basic_string_view<CharT> const& str) const noexcept
+    {
+        return wyhash_detail::hash_bytes(str.data(), static_cast<std::int64_t>(str.size()));
+    }
+};
+
 template <class T>
 struct hash<T*>
 {
@@ -234,4 +313,66 @@ struct hash<T>
     }
 };
 
+template <typename T, std::size_t N>
+struct hash<std::array<T, N>>
+{
+    constexpr std::uint64_t operator()(const std::array<T, N>& array) const
+    {
+        if constexpr (wyhash_detail::ByteHashable<T>)
+        {
+            return wyhash_detail::hash_objects<N>(array.data(), N);
+        }
+        else
+        {
+            std::uint64_t seed = wyhash_detail::hash(static_cast<std::uint64_t>(N));
+            for (const T& element : array)
+            {
+                seed = wyhash_detail::combine(seed, hash<T>{}(element));
+            }
+            return seed;
+        }
+    }
+};
+
+template <typename T1, typename T2>
+struct hash<std::pair<T1, T2>>
+{
+    constexpr std::uint64_t operator()(const std::pair<T1, T2>& pair) const
+    {
+        return wyhash_detail::combine(hash<T1>{}(pair.first), hash<T2>{}(pair.second));
+    }
+};
+
+// Plain structs (e.g. the ones used with reflection) whose bytes are their value, i.e. without
+// padding, are hashed in one pass over their bytes. Types with a `std::hash` keep using it.
+template <typename T>
+    requires(std::is_aggregate_v<T> && wyhash_detail::ByteHashable<T> &&
+             !std::is_default_constructible_v<std::hash<T>> &&
+             !std::convertible_to<T, std::uint64_t>)
+struct hash<T>
+{
+    constexpr std::uint64_t operator()(const T& value) const noexcept
+    {
+        return wyhash_detail::hash_objects<1>(&value, 1);
+    }
+};
+
+// Writes the hash of `keys[i]` to `hashes[i]`, with the same values as calling `hasher` on each
+// key. Meant for hashing many keys up front, so that the lookups can then go through the
+// `find(key, hash)` and `contains(key, hash)` of the unordered containers, with their
+// `hash_function()` as `hasher`. The hashes of different keys don't depend on each other, so the
+// loop keeps several multiplications in flight at once. `hashes` must be at least as long as
+// `keys`.
+template <typename K, class Hash = hash<K>>
+constexpr void hash_batch(std::span<const K> keys,
+                          std::span<std::uint64_t> hashes,
+                          const Hash& hasher = Hash{})
+{
+    assert_or_abort(hashes.size() >= keys.size());
+    for (std::size_t i = 0; i < keys.size(); i++)
+    {
+        hashes[i] = static_cast<std::uint64_t>(hasher(keys[i]));
+    }
+}
+
 }  // namespace fixed_containers::wyhash
@@ -0,0 +1,99 @@
+#include "fixed_containers/atomic_enum_set.hpp"
+
+#include "enums_test_common.hpp"
+
+#include "fixed_containers/enum_set.hpp"
+#include "fixed_containers/fixed_bitset_raw_view.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using TestEnum1 = rich_enums::TestEnum1;
+using TestRichEnum1 = rich_enums::TestRichEnum1;
+
+using AES_1 = AtomicEnumSet<TestEnum1>;
+static_assert(!std::is_copy_constructible_v<AES_1>);
+static_assert(std::is_nothrow_default_constructible_v<AES_1>);
+static_assert(sizeof(AES_1) == sizeof(FixedBitset<4>));
+}  // namespace
+
+TEST(AtomicEnumSet, DefaultConstructor)
+{
+    const AtomicEnumSet<TestEnum1> var1{};
+    EXPECT_TRUE(var1.empty());
+    EXPECT_EQ(0, var1.size());
+    EXPECT_EQ(4, var1.max_size());
+}
+
+TEST(AtomicEnumSet, InsertAndErase)
+{
+    AtomicEnumSet<TestEnum1> var1{TestEnum1::TWO};
+    EXPECT_TRUE(var1.insert(TestEnum1::ONE));
+    EXPECT_FALSE(var1.insert(TestEnum1::ONE));
+    EXPECT_TRUE(var1.contains(TestEnum1::ONE));
+    EXPECT_TRUE(var1.contains(TestEnum1::TWO));
+    EXPECT_FALSE(var1.contains(TestEnum1::THREE));
+    EXPECT_EQ(2, var1.size());
+
+    EXPECT_EQ(1, var1.erase(TestEnum1::ONE));
+    EXPECT_EQ(0, var1.erase(TestEnum1::ONE));
+    EXPECT_EQ(1, var1.size());
+
+    var1.insert(EnumSet<TestEnum1>{TestEnum1::THREE, TestEnum1::FOUR});
+    EXPECT_EQ(3, var1.size());
+
+    var1.clear();
+    EXPECT_TRUE(var1.empty());
+}
+
+TEST(AtomicEnumSet, SnapshotAndTake)
+{
+    AtomicEnumSet<TestRichEnum1> var1{};
+    var1.insert(TestRichEnum1::C_ONE());
+    var1.insert(TestRichEnum1::C_FOUR());
+
+    const EnumSet<TestRichEnum1> snapshot = var1.snapshot();
+    EXPECT_EQ((EnumSet<TestRichEnum1>{TestRichEnum1::C_ONE(), TestRichEnum1::C_FOUR()}), snapshot);
+    EXPECT_EQ(2, snapshot.size());
+
+    EXPECT_EQ(snapshot, var1.take());
+    EXPECT_TRUE(var1.empty());
+}
+
+TEST(AtomicEnumSet, RawView)
+{
+    AtomicEnumSet<TestEnum1> var1{TestEnum1::TWO, TestEnum1::FOUR};
+
+    const fixed_bitset_detail::FixedBitsetRawView view{&var1, AES_1::static_max_size()};
+    std::vector<std::size_t> actual{};
+    for (const std::size_t index : view)
+    {
+        actual.push_back(index);
+    }
+    EXPECT_EQ((std::vector<std::size_t>{1, 3}), actual);
+}
+
+TEST(AtomicEnumSet, ConcurrentDirtyFlags)
+{
+    AtomicEnumSet<TestEnum1> var1{};
+    std::vector<std::thread> threads{};
+    threads.emplace_back([&]() { var1.insert(TestEnum1::ONE); });
+    threads.emplace_back([&]() { var1.insert(TestEnum1::THREE); });
+    threads.emplace_back([&]() { var1.insert(TestEnum1::THREE); });
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ((EnumSet<TestEnum1>{TestEnum1::ONE, TestEnum1::THREE}), var1.take());
+}
+
+}  // namespace fixed_containers
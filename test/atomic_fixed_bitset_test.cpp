@@ -0,0 +1,192 @@
+#include "fixed_containers/atomic_fixed_bitset.hpp"
+
+#include "fixed_containers/fixed_bitset.hpp"
+#include "fixed_containers/fixed_bitset_raw_view.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using AtomicBitsetType = AtomicFixedBitset<100>;
+static_assert(!std::is_copy_constructible_v<AtomicBitsetType>);
+static_assert(!std::is_move_constructible_v<AtomicBitsetType>);
+static_assert(std::is_nothrow_default_constructible_v<AtomicBitsetType>);
+static_assert(std::is_standard_layout_v<AtomicBitsetType>);
+
+// Same layout as FixedBitset, so the raw views work on both
+static_assert(sizeof(AtomicFixedBitset<5>) == sizeof(FixedBitset<5>));
+static_assert(sizeof(AtomicFixedBitset<64>) == sizeof(FixedBitset<64>));
+static_assert(sizeof(AtomicFixedBitset<100>) == sizeof(FixedBitset<100>));
+static_assert(alignof(AtomicFixedBitset<5>) == alignof(FixedBitset<5>));
+static_assert(alignof(AtomicFixedBitset<100>) == alignof(FixedBitset<100>));
+static_assert(sizeof(AtomicFixedBitset<100>) == fixed_bitset_detail::get_storage_size(100));
+
+// Constant-initialized
+constinit AtomicFixedBitset<70> STATIC_INSTANCE{};
+}  // namespace
+
+TEST(AtomicFixedBitset, DefaultConstructor)
+{
+    const AtomicFixedBitset<8> var1{};
+    EXPECT_EQ(8, var1.size());
+    EXPECT_EQ(0, var1.count());
+    EXPECT_TRUE(var1.none());
+    EXPECT_TRUE(STATIC_INSTANCE.none());
+}
+
+TEST(AtomicFixedBitset, FixedBitsetConstructor)
+{
+    const AtomicFixedBitset<8> var1{FixedBitset<8>{"01100101"}};
+    EXPECT_EQ(4, var1.count());
+    EXPECT_TRUE(var1.test(0));
+    EXPECT_FALSE(var1.test(1));
+    EXPECT_EQ(FixedBitset<8>{"01100101"}, var1.snapshot());
+}
+
+TEST(AtomicFixedBitset, TestAndSetAndReset)
+{
+    AtomicFixedBitset<100> var1{};
+    EXPECT_FALSE(var1.test_and_set(3));
+    EXPECT_TRUE(var1.test_and_set(3));
+    EXPECT_FALSE(var1.test_and_set(99, std::memory_order_relaxed));
+    EXPECT_TRUE(var1.test(3));
+    EXPECT_TRUE(var1.test(99, std::memory_order_acquire));
+    EXPECT_EQ(2, var1.count());
+
+    EXPECT_TRUE(var1.test_and_reset(3));
+    EXPECT_FALSE(var1.test_and_reset(3));
+    EXPECT_FALSE(var1.test(3));
+
+    var1.set(64);
+    var1.reset(99);
+    EXPECT_TRUE(var1.any());
+    EXPECT_EQ(1, var1.count());
+    EXPECT_TRUE(var1.snapshot().test(64));
+
+    var1.reset_all();
+    EXPECT_TRUE(var1.none());
+}
+
+TEST(AtomicFixedBitset, OutOfBounds)
+{
+    AtomicFixedBitset<100> var1{};
+    EXPECT_DEATH((void)var1.test(100), "");
+    EXPECT_DEATH((void)var1.test_and_set(100), "");
+    EXPECT_DEATH((void)var1.test_and_reset(100), "");
+    EXPECT_DEATH((void)var1.load_word(2), "");
+}
+
+TEST(AtomicFixedBitset, WordOperations)
+{
+    AtomicFixedBitset<100> var1{};
+    EXPECT_EQ(2, var1.word_count());
+    EXPECT_EQ(0, var1.fetch_or_word(1, 0b1010));
+    EXPECT_EQ(0b1010, var1.fetch_and_word(1, 0b0010));
+    EXPECT_EQ(0b0010, var1.load_word(1));
+    EXPECT_TRUE(var1.test(65));
+    EXPECT_EQ(1, var1.count());
+}
+
+TEST(AtomicFixedBitset, WholeBitsetOperations)
+{
+    AtomicFixedBitset<8> var1{FixedBitset<8>{"00001111"}};
+
+    EXPECT_EQ(FixedBitset<8>{"00001111"}, var1.fetch_or(FixedBitset<8>{"00110000"}));
+    EXPECT_EQ(FixedBitset<8>{"00111111"}, var1.fetch_and(FixedBitset<8>{"11110000"}));
+    EXPECT_EQ(FixedBitset<8>{"00110000"}, var1.exchange(FixedBitset<8>{"10000000"}));
+    EXPECT_EQ(FixedBitset<8>{"10000000"}, var1.take());
+    EXPECT_TRUE(var1.none());
+}
+
+TEST(AtomicFixedBitset, RawView)
+{
+    AtomicFixedBitset<100> var1{};
+    var1.set(1);
+    var1.set(64);
+    var1.set(99);
+
+    const fixed_bitset_detail::FixedBitsetRawView view{&var1, 100};
+    std::vector<std::size_t> actual{};
+    for (const std::size_t index : view)
+    {
+        actual.push_back(index);
+    }
+    EXPECT_EQ((std::vector<std::size_t>{1, 64, 99}), actual);
+}
+
+TEST(AtomicFixedBitset, ConcurrentTestAndSet)
+{
+    static constexpr std::size_t BIT_COUNT = 1000;
+    static constexpr std::size_t THREAD_COUNT = 4;
+
+    AtomicFixedBitset<BIT_COUNT> var1{};
+    std::atomic<std::size_t> winner_count{0};
+    std::vector<std::thread> threads{};
+    for (std::size_t thread_index = 0; thread_index < THREAD_COUNT; thread_index++)
+    {
+        threads.emplace_back(
+            [&]()
+            {
+                // Every thread races for every bit; exactly one must see it unset.
+                for (std::size_t i = 0; i < BIT_COUNT; i++)
+                {
+                    if (!var1.test_and_set(i, std::memory_order_relaxed))
+                    {
+                        winner_count.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(BIT_COUNT, winner_count.load());
+    EXPECT_EQ(BIT_COUNT, var1.count());
+}
+
+TEST(AtomicFixedBitset, ConcurrentTakeLosesNothing)
+{
+    static constexpr std::size_t BIT_COUNT = 256;
+
+    AtomicFixedBitset<BIT_COUNT> var1{};
+    std::atomic<bool> done{false};
+    std::size_t taken = 0;
+
+    std::thread consumer{[&]()
+                         {
+                             while (!done.load(std::memory_order_acquire))
+                             {
+                                 taken += var1.take().count();
+                             }
+                             taken += var1.take().count();
+                         }};
+
+    std::size_t produced = 0;
+    for (std::size_t round = 0; round < 200; round++)
+    {
+        for (std::size_t i = 0; i < BIT_COUNT; i++)
+        {
+            if (!var1.test_and_set(i))
+            {
+                produced++;
+            }
+        }
+    }
+    done.store(true, std::memory_order_release);
+    consumer.join();
+
+    EXPECT_EQ(produced, taken);
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,126 @@
+#include "fixed_containers/fixed_map.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/map_checking.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+// Compares the default abort-on-violation policies against the `NoChecking` ones on hot paths.
+// The difference in generated code can be seen by disassembling this binary, e.g.
+// `objdump -d --no-show-raw-insn checking_policy_perf_test | c++filt`: the `NoChecking` variants
+// have neither the compare-and-branch to `abort()` nor the `source_location` setup.
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t CAPACITY = 1024;
+
+template <typename T>
+using AbortVector = FixedVector<T, CAPACITY>;
+template <typename T>
+using UncheckedVector =
+    FixedVector<T, CAPACITY, customize::SequenceContainerNoChecking<T, CAPACITY>>;
+
+template <typename K, typename V, template <class, class, std::size_t> class Checking>
+using MapWithChecking =
+    FixedMap<K,
+             V,
+             CAPACITY,
+             std::less<K>,
+             fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+             FixedIndexBasedPoolStorage,
+             Checking<K, V, CAPACITY>>;
+
+template <typename VectorType>
+void benchmark_vector_push_back(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        VectorType instance{};
+        for (std::size_t i = 0; i < CAPACITY; i++)
+        {
+            instance.push_back(static_cast<std::int64_t>(i));
+        }
+        benchmark::DoNotOptimize(instance);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * CAPACITY));
+}
+
+template <typename VectorType>
+void benchmark_vector_at(benchmark::State& state)
+{
+    VectorType instance{};
+    for (std::size_t i = 0; i < CAPACITY; i++)
+    {
+        instance.push_back(static_cast<std::int64_t>(i));
+    }
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(instance);
+        std::int64_t sum = 0;
+        for (std::size_t i = 0; i < CAPACITY; i++)
+        {
+            sum += instance.at(i);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * CAPACITY));
+}
+
+template <typename MapType>
+void benchmark_map_insert(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        MapType instance{};
+        for (std::size_t i = 0; i < CAPACITY; i++)
+        {
+            instance.try_emplace(static_cast<int>((i * 7) % CAPACITY), static_cast<int>(i));
+        }
+        benchmark::DoNotOptimize(instance);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * CAPACITY));
+}
+
+template <typename MapType>
+void benchmark_map_at(benchmark::State& state)
+{
+    MapType instance{};
+    for (std::size_t i = 0; i < CAPACITY; i++)
+    {
+        instance.try_emplace(static_cast<int>(i), static_cast<int>(i));
+    }
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(instance);
+        std::int64_t sum = 0;
+        for (std::size_t i = 0; i < CAPACITY; i++)
+        {
+            sum += instance.at(static_cast<int>((i * 7) % CAPACITY));
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * CAPACITY));
+}
+}  // namespace
+
+BENCHMARK(benchmark_vector_push_back<AbortVector<std::int64_t>>);
+BENCHMARK(benchmark_vector_push_back<UncheckedVector<std::int64_t>>);
+
+BENCHMARK(benchmark_vector_at<AbortVector<std::int64_t>>);
+BENCHMARK(benchmark_vector_at<UncheckedVector<std::int64_t>>);
+
+BENCHMARK(benchmark_map_insert<MapWithChecking<int, int, customize::MapAbortChecking>>);
+BENCHMARK(benchmark_map_insert<MapWithChecking<int, int, customize::MapNoChecking>>);
+
+BENCHMARK(benchmark_map_at<MapWithChecking<int, int, customize::MapAbortChecking>>);
+BENCHMARK(benchmark_map_at<MapWithChecking<int, int, customize::MapNoChecking>>);
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -0,0 +1,492 @@
+#include "fixed_containers/enum_map.hpp"
+#include "fixed_containers/enum_set.hpp"
+#include "fixed_containers/fixed_bitset.hpp"
+#include "fixed_containers/fixed_circular_deque.hpp"
+#include "fixed_containers/fixed_deque.hpp"
+#include "fixed_containers/fixed_list.hpp"
+#include "fixed_containers/fixed_map.hpp"
+#include "fixed_containers/fixed_set.hpp"
+#include "fixed_containers/fixed_string.hpp"
+#include "fixed_containers/fixed_unordered_map.hpp"
+#include "fixed_containers/fixed_unordered_set.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+
+#include <benchmark/benchmark.h>
+
+#if defined(FIXED_CONTAINERS_BENCHMARK_BOOST)
+#include <boost/container/flat_map.hpp>
+#include <boost/container/flat_set.hpp>
+#include <boost/container/static_vector.hpp>
+#endif
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Hot operations of the fixed containers side by side with their std:: equivalents, and with
+// boost::container::static_vector/flat_map/flat_set when the build provides boost (the CMake
+// build defines FIXED_CONTAINERS_BENCHMARK_BOOST when it finds it).
+//
+// Every benchmark takes the fill level as its argument: a quarter-full and a full container of
+// CAPACITY elements. Sequence containers are also run with a 64-byte element, maps with a 64-byte
+// mapped value. The std:: containers reserve where they can, so what is measured is the
+// per-element cost plus one allocation, not reallocation.
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t CAPACITY = 1024;
+constexpr std::int64_t QUARTER_FULL = CAPACITY / 4;
+constexpr std::int64_t FULL = CAPACITY;
+
+struct Payload64
+{
+    std::array<std::uint64_t, 8> words{};
+
+    constexpr Payload64() = default;
+    constexpr Payload64(std::uint64_t value)  // NOLINT(google-explicit-constructor)
+      : words{value}
+    {
+    }
+};
+static_assert(sizeof(Payload64) == 64);
+
+constexpr std::uint64_t first_word(const std::uint64_t value) { return value; }
+constexpr std::uint64_t first_word(const Payload64& value) { return value.words[0]; }
+
+// Visits 0 .. count-1 out of order, so that tree-based containers don't only see sorted inserts.
+// CAPACITY is a power of two, so any odd multiplier gives a permutation.
+constexpr std::uint64_t shuffled_key(const std::size_t i) { return (i * 7919) % CAPACITY; }
+
+std::size_t fill_level(const benchmark::State& state)
+{
+    return static_cast<std::size_t>(state.range(0));
+}
+
+void set_items_processed(benchmark::State& state)
+{
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename ContainerType>
+ContainerType make_empty(const std::size_t count)
+{
+    ContainerType instance{};
+    if constexpr (requires { instance.reserve(count); })
+    {
+        instance.reserve(count);
+    }
+    return instance;
+}
+
+// SEQUENCE CONTAINERS
+
+template <typename SequenceType>
+void benchmark_push_back(benchmark::State& state)
+{
+    using T = typename SequenceType::value_type;
+    const std::size_t count = fill_level(state);
+    for (auto _ : state)
+    {
+        SequenceType instance = make_empty<SequenceType>(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            instance.push_back(T{i});
+        }
+        benchmark::DoNotOptimize(instance);
+    }
+    set_items_processed(state);
+}
+
+template <typename SequenceType>
+void benchmark_iterate(benchmark::State& state)
+{
+    using T = typename SequenceType::value_type;
+    const std::size_t count = fill_level(state);
+    SequenceType instance = make_empty<SequenceType>(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        instance.push_back(T{i});
+    }
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(instance);
+        std::uint64_t sum = 0;
+        for (const T& entry : instance)
+        {
+            sum += first_word(entry);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    set_items_processed(state);
+}
+
+// Queue usage: the size stays at the fill level while entries go in at the back and come out at
+// the front, which exercises the wrap-around of the circular containers.
+template <typename DequeType>
+void benchmark_queue_churn(benchmark::State& state)
+{
+    using T = typename DequeType::value_type;
+    const std::size_t count = fill_level(state);
+    DequeType instance{};
+    for (std::size_t i = 0; i < count - 1; i++)
+    {
+        instance.push_back(T{i});
+    }
+
+    std::uint64_t next = 0;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            instance.push_back(T{next++});
+            benchmark::DoNotOptimize(instance.front());
+            instance.pop_front();
+        }
+    }
+    set_items_processed(state);
+}
+
+template <typename T>
+using StdVectorType = std::vector<T>;
+template <typename T>
+using FixedVectorType = FixedVector<T, CAPACITY>;
+template <typename T>
+using StdDequeType = std::deque<T>;
+template <typename T>
+using FixedDequeType = FixedDeque<T, CAPACITY>;
+template <typename T>
+using FixedCircularDequeType = FixedCircularDeque<T, CAPACITY>;
+template <typename T>
+using StdListType = std::list<T>;
+template <typename T>
+using FixedListType = FixedList<T, CAPACITY>;
+#if defined(FIXED_CONTAINERS_BENCHMARK_BOOST)
+template <typename T>
+using BoostStaticVectorType = boost::container::static_vector<T, CAPACITY>;
+#endif
+
+// ASSOCIATIVE CONTAINERS
+
+template <typename ContainerType>
+void insert_key(ContainerType& instance, const std::uint64_t key)
+{
+    if constexpr (requires { typename ContainerType::mapped_type; })
+    {
+        instance.try_emplace(key, typename ContainerType::mapped_type{key});
+    }
+    else
+    {
+        instance.insert(key);
+    }
+}
+
+template <typename ContainerType>
+ContainerType make_filled(const std::size_t count)
+{
+    ContainerType instance = make_empty<ContainerType>(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        insert_key(instance, shuffled_key(i));
+    }
+    return instance;
+}
+
+template <typename ContainerType>
+void benchmark_insert(benchmark::State& state)
+{
+    const std::size_t count = fill_level(state);
+    for (auto _ : state)
+    {
+        ContainerType instance = make_filled<ContainerType>(count);
+        benchmark::DoNotOptimize(instance);
+    }
+    set_items_processed(state);
+}
+
+// Half of the lookups hit and half miss.
+template <typename ContainerType>
+void benchmark_find(benchmark::State& state)
+{
+    const std::size_t count = fill_level(state);
+    const ContainerType instance = make_filled<ContainerType>(count / 2);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(instance);
+        std::size_t found = 0;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            if (instance.find(shuffled_key(i)) != instance.end())
+            {
+                found++;
+            }
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    set_items_processed(state);
+}
+
+// Erases all entries in insertion order. Filling the container is excluded from the timing.
+template <typename ContainerType>
+void benchmark_erase(benchmark::State& state)
+{
+    const std::size_t count = fill_level(state);
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        ContainerType instance = make_filled<ContainerType>(count);
+        state.ResumeTiming();
+        for (std::size_t i = 0; i < count; i++)
+        {
+            instance.erase(shuffled_key(i));
+        }
+        benchmark::DoNotOptimize(instance);
+    }
+    set_items_processed(state);
+}
+
+template <typename V>
+using StdMapType = std::map<std::uint64_t, V>;
+template <typename V>
+using FixedMapType = FixedMap<std::uint64_t, V, CAPACITY>;
+template <typename V>
+using StdUnorderedMapType = std::unordered_map<std::uint64_t, V>;
+template <typename V>
+using FixedUnorderedMapType = FixedUnorderedMap<std::uint64_t, V, CAPACITY>;
+using StdSetType = std::set<std::uint64_t>;
+using FixedSetType = FixedSet<std::uint64_t, CAPACITY>;
+using StdUnorderedSetType = std::unordered_set<std::uint64_t>;
+using FixedUnorderedSetType = FixedUnorderedSet<std::uint64_t, CAPACITY>;
+#if defined(FIXED_CONTAINERS_BENCHMARK_BOOST)
+template <typename V>
+using BoostFlatMapType = boost::container::flat_map<std::uint64_t, V>;
+using BoostFlatSetType = boost::container::flat_set<std::uint64_t>;
+#endif
+
+// ENUM CONTAINERS
+
+enum class Signal
+{
+    S00,
+    S01,
+    S02,
+    S03,
+    S04,
+    S05,
+    S06,
+    S07,
+    S08,
+    S09,
+    S10,
+    S11,
+    S12,
+    S13,
+    S14,
+    S15,
+};
+constexpr std::size_t SIGNAL_COUNT = 16;
+
+constexpr Signal signal_at(const std::size_t i)
+{
+    return static_cast<Signal>((i * 7) % SIGNAL_COUNT);
+}
+
+// Each iteration writes then reads every key once; the argument is the number of passes, so that
+// the items processed are comparable with the other benchmarks.
+template <typename MapType>
+void benchmark_enum_map_update_and_read(benchmark::State& state)
+{
+    const std::size_t passes = fill_level(state) / SIGNAL_COUNT;
+    MapType instance{};
+    for (auto _ : state)
+    {
+        std::uint64_t sum = 0;
+        for (std::size_t pass = 0; pass < passes; pass++)
+        {
+            for (std::size_t i = 0; i < SIGNAL_COUNT; i++)
+            {
+                instance[signal_at(i)] = pass + i;
+            }
+            for (std::size_t i = 0; i < SIGNAL_COUNT; i++)
+            {
+                sum += instance.at(signal_at(i));
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    set_items_processed(state);
+}
+
+template <typename SetType>
+void benchmark_enum_set_insert_and_contains(benchmark::State& state)
+{
+    const std::size_t passes = fill_level(state) / SIGNAL_COUNT;
+    for (auto _ : state)
+    {
+        SetType instance{};
+        std::size_t found = 0;
+        for (std::size_t pass = 0; pass < passes; pass++)
+        {
+            instance.insert(signal_at(pass));
+            for (std::size_t i = 0; i < SIGNAL_COUNT; i++)
+            {
+                if (instance.contains(signal_at(i)))
+                {
+                    found++;
+                }
+            }
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    set_items_processed(state);
+}
+
+// BITSETS
+
+// Sets `count` bits spread over the whole range, intersects with a second bitset and counts.
+template <typename BitsetType>
+void benchmark_bitset_set_and_count(benchmark::State& state)
+{
+    const std::size_t count = fill_level(state);
+    BitsetType mask{};
+    for (std::size_t i = 0; i < CAPACITY; i += 2)
+    {
+        mask.set(i);
+    }
+
+    for (auto _ : state)
+    {
+        BitsetType instance{};
+        for (std::size_t i = 0; i < count; i++)
+        {
+            instance.set(shuffled_key(i));
+        }
+        instance &= mask;
+        benchmark::DoNotOptimize(instance.count());
+    }
+    set_items_processed(state);
+}
+
+// STRINGS
+
+template <typename StringType>
+void benchmark_string_append_and_find(benchmark::State& state)
+{
+    const std::size_t count = fill_level(state);
+    for (auto _ : state)
+    {
+        StringType instance = make_empty<StringType>(count);
+        for (std::size_t i = 0; i + 1 < count; i++)
+        {
+            instance.push_back(static_cast<char>('a' + (i % 26)));
+        }
+        instance.push_back('!');
+        benchmark::DoNotOptimize(instance.find('!'));
+    }
+    set_items_processed(state);
+}
+}  // namespace
+
+BENCHMARK(benchmark_push_back<StdVectorType<std::uint64_t>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_push_back<FixedVectorType<std::uint64_t>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_push_back<StdVectorType<Payload64>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_push_back<FixedVectorType<Payload64>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_push_back<StdDequeType<std::uint64_t>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_push_back<FixedDequeType<std::uint64_t>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_push_back<StdListType<std::uint64_t>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_push_back<FixedListType<std::uint64_t>>)->Arg(QUARTER_FULL)->Arg(FULL);
+#if defined(FIXED_CONTAINERS_BENCHMARK_BOOST)
+BENCHMARK(benchmark_push_back<BoostStaticVectorType<std::uint64_t>>)
+    ->Arg(QUARTER_FULL)
+    ->Arg(FULL);
+BENCHMARK(benchmark_push_back<BoostStaticVectorType<Payload64>>)->Arg(QUARTER_FULL)->Arg(FULL);
+#endif
+
+BENCHMARK(benchmark_iterate<StdVectorType<std::uint64_t>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_iterate<FixedVectorType<std::uint64_t>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_iterate<StdVectorType<Payload64>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_iterate<FixedVectorType<Payload64>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_iterate<StdDequeType<std::uint64_t>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_iterate<FixedDequeType<std::uint64_t>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_iterate<StdListType<std::uint64_t>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_iterate<FixedListType<std::uint64_t>>)->Arg(QUARTER_FULL)->Arg(FULL);
+
+BENCHMARK(benchmark_queue_churn<StdDequeType<std::uint64_t>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_queue_churn<FixedDequeType<std::uint64_t>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_queue_churn<FixedCircularDequeType<std::uint64_t>>)
+    ->Arg(QUARTER_FULL)
+    ->Arg(FULL);
+BENCHMARK(benchmark_queue_churn<StdDequeType<Payload64>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_queue_churn<FixedCircularDequeType<Payload64>>)
+    ->Arg(QUARTER_FULL)
+    ->Arg(FULL);
+
+BENCHMARK(benchmark_insert<StdMapType<std::uint64_t>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_insert<FixedMapType<std::uint64_t>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_insert<StdMapType<Payload64>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_insert<FixedMapType<Payload64>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_insert<StdUnorderedMapType<std::uint64_t>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_insert<FixedUnorderedMapType<std::uint64_t>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_insert<StdSetType>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_insert<FixedSetType>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_insert<StdUnorderedSetType>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_insert<FixedUnorderedSetType>)->Arg(QUARTER_FULL)->Arg(FULL);
+#if defined(FIXED_CONTAINERS_BENCHMARK_BOOST)
+BENCHMARK(benchmark_insert<BoostFlatMapType<std::uint64_t>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_insert<BoostFlatMapType<Payload64>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_insert<BoostFlatSetType>)->Arg(QUARTER_FULL)->Arg(FULL);
+#endif
+
+BENCHMARK(benchmark_find<StdMapType<std::uint64_t>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_find<FixedMapType<std::uint64_t>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_find<StdUnorderedMapType<std::uint64_t>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_find<FixedUnorderedMapType<std::uint64_t>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_find<StdSetType>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_find<FixedSetType>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_find<StdUnorderedSetType>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_find<FixedUnorderedSetType>)->Arg(QUARTER_FULL)->Arg(FULL);
+#if defined(FIXED_CONTAINERS_BENCHMARK_BOOST)
+BENCHMARK(benchmark_find<BoostFlatMapType<std::uint64_t>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_find<BoostFlatSetType>)->Arg(QUARTER_FULL)->Arg(FULL);
+#endif
+
+BENCHMARK(benchmark_erase<StdMapType<std::uint64_t>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_erase<FixedMapType<std::uint64_t>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_erase<StdUnorderedMapType<std::uint64_t>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_erase<FixedUnorderedMapType<std::uint64_t>>)->Arg(QUARTER_FULL)->Arg(FULL);
+#if defined(FIXED_CONTAINERS_BENCHMARK_BOOST)
+BENCHMARK(benchmark_erase<BoostFlatMapType<std::uint64_t>>)->Arg(QUARTER_FULL)->Arg(FULL);
+#endif
+
+BENCHMARK(benchmark_enum_map_update_and_read<std::map<Signal, std::uint64_t>>)
+    ->Arg(QUARTER_FULL)
+    ->Arg(FULL);
+BENCHMARK(benchmark_enum_map_update_and_read<EnumMap<Signal, std::uint64_t>>)
+    ->Arg(QUARTER_FULL)
+    ->Arg(FULL);
+BENCHMARK(benchmark_enum_set_insert_and_contains<std::set<Signal>>)
+    ->Arg(QUARTER_FULL)
+    ->Arg(FULL);
+BENCHMARK(benchmark_enum_set_insert_and_contains<EnumSet<Signal>>)
+    ->Arg(QUARTER_FULL)
+    ->Arg(FULL);
+
+BENCHMARK(benchmark_bitset_set_and_count<std::bitset<CAPACITY>>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_bitset_set_and_count<FixedBitset<CAPACITY>>)->Arg(QUARTER_FULL)->Arg(FULL);
+
+BENCHMARK(benchmark_string_append_and_find<std::string>)->Arg(QUARTER_FULL)->Arg(FULL);
+BENCHMARK(benchmark_string_append_and_find<FixedString<CAPACITY>>)->Arg(QUARTER_FULL)->Arg(FULL);
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -8,6 +8,7 @@
 #include "fixed_containers/arrow_proxy.hpp"
 #include "fixed_containers/assert_or_abort.hpp"
 #include "fixed_containers/concepts.hpp"
+#include "fixed_containers/enum_set.hpp"
 #include "fixed_containers/consteval_compare.hpp"
 #include "fixed_containers/max_size.hpp"
 #include "fixed_containers/memory.hpp"
@@ -20,6 +21,7 @@
 #include <map>
 #include <memory>
 #include <ranges>
+#include <string>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -1429,6 +1431,60 @@ TEST(EnumMap, Equality)
     }
 }
 
+TEST(EnumMap, Merge)
+{
+    constexpr std::pair<EnumMap<TestEnum1, int>, EnumMap<TestEnum1, int>> VAL1 = []()
+    {
+        EnumMap<TestEnum1, int> var1{{TestEnum1::ONE, 10}, {TestEnum1::TWO, 20}};
+        EnumMap<TestEnum1, int> var2{{TestEnum1::TWO, 22}, {TestEnum1::FOUR, 44}};
+        var1.merge(var2);
+        return std::pair{var1, var2};
+    }();
+
+    static_assert(3 == VAL1.first.size());
+    static_assert(VAL1.first == EnumMap<TestEnum1, int>{{TestEnum1::ONE, 10},
+                                                        {TestEnum1::TWO, 20},
+                                                        {TestEnum1::FOUR, 44}});
+    // Entries whose keys were already present stay in the source
+    static_assert(1 == VAL1.second.size());
+    static_assert(VAL1.second == EnumMap<TestEnum1, int>{{TestEnum1::TWO, 22}});
+}
+
+TEST(EnumMap, MergeNonTriviallyCopyable)
+{
+    EnumMap<TestEnum1, MockMoveableButNotCopyable> var1{};
+    var1.try_emplace(TestEnum1::ONE);
+    EnumMap<TestEnum1, MockMoveableButNotCopyable> var2{};
+    var2.try_emplace(TestEnum1::ONE);
+    var2.try_emplace(TestEnum1::THREE);
+
+    var1.merge(std::move(var2));
+    EXPECT_EQ(2, var1.size());
+    EXPECT_TRUE(var1.contains(TestEnum1::THREE));
+}
+
+TEST(EnumMap, AssignFromMask)
+{
+    constexpr EnumMap<TestEnum1, int> VAL1 = []()
+    {
+        EnumMap<TestEnum1, int> var{{TestEnum1::ONE, 10}, {TestEnum1::TWO, 20}};
+        var.assign_from_mask(EnumSet<TestEnum1>{TestEnum1::TWO, TestEnum1::FOUR}, 99);
+        return var;
+    }();
+
+    static_assert(2 == VAL1.size());
+    static_assert(VAL1 == EnumMap<TestEnum1, int>{{TestEnum1::TWO, 20}, {TestEnum1::FOUR, 99}});
+
+    EnumMap<TestEnum1, std::string> var2{{TestEnum1::ONE, "one"}};
+    var2.assign_from_mask(EnumSet<TestEnum1>{TestEnum1::ONE, TestEnum1::THREE}, 2, 'x');
+    EXPECT_EQ(2, var2.size());
+    EXPECT_EQ("one", var2.at(TestEnum1::ONE));
+    EXPECT_EQ("xx", var2.at(TestEnum1::THREE));
+
+    var2.assign_from_mask(EnumSet<TestEnum1>{});
+    EXPECT_TRUE(var2.empty());
+}
+
 TEST(EnumMap, Ranges)
 {
 #if !defined(__clang__) || __clang_major__ >= 16
@@ -296,6 +296,19 @@ TEST(EnumSet, EmptySizeFull)
     static_assert(!is_full(VAL4));
 }
 
+TEST(EnumSet, Bitset)
+{
+    constexpr EnumSet<TestEnum1> VAL1{TestEnum1::TWO, TestEnum1::FOUR};
+    static_assert(VAL1.bitset().size() == 4);
+    static_assert(VAL1.bitset().count() == 2);
+    static_assert(!VAL1.bitset().test(0));
+    static_assert(VAL1.bitset().test(1));
+    static_assert(VAL1.bitset().test(3));
+
+    constexpr EnumSet<TestEnum1> VAL2{};
+    static_assert(VAL2.bitset().none());
+}
+
 TEST(EnumSet, Insert)
 {
     constexpr auto VAL1 = []()
@@ -929,6 +942,85 @@ TEST(EnumSet, StdRangesUnion)
     static_assert(!VAL1.contains(TestEnum1::FOUR));
 }
 
+TEST(EnumSet, BulkOperations)
+{
+    constexpr EnumSet<TestEnum1> VAL1{TestEnum1::ONE, TestEnum1::TWO};
+    constexpr EnumSet<TestEnum1> VAL2{TestEnum1::TWO, TestEnum1::THREE};
+
+    constexpr EnumSet<TestEnum1> VAL3 = [&]()
+    {
+        EnumSet<TestEnum1> var = VAL1;
+        var |= VAL2;
+        return var;
+    }();
+    static_assert(VAL3 == EnumSet<TestEnum1>{TestEnum1::ONE, TestEnum1::TWO, TestEnum1::THREE});
+    static_assert(3 == VAL3.size());
+
+    constexpr EnumSet<TestEnum1> VAL4 = [&]()
+    {
+        EnumSet<TestEnum1> var = VAL1;
+        var &= VAL2;
+        return var;
+    }();
+    static_assert(VAL4 == EnumSet<TestEnum1>{TestEnum1::TWO});
+    static_assert(1 == VAL4.size());
+
+    constexpr EnumSet<TestEnum1> VAL5 = [&]()
+    {
+        EnumSet<TestEnum1> var = VAL1;
+        var -= VAL2;
+        return var;
+    }();
+    static_assert(VAL5 == EnumSet<TestEnum1>{TestEnum1::ONE});
+    static_assert(1 == VAL5.size());
+
+    static_assert((VAL1 | VAL2) == VAL3);
+    static_assert((VAL1 & VAL2) == VAL4);
+    static_assert((VAL1 - VAL2) == VAL5);
+    static_assert((VAL1 - VAL1).empty());
+}
+
+TEST(EnumSet, SubsetAndIntersects)
+{
+    constexpr EnumSet<TestEnum1> VAL1{TestEnum1::ONE, TestEnum1::TWO};
+    constexpr EnumSet<TestEnum1> VAL2{TestEnum1::ONE, TestEnum1::TWO, TestEnum1::FOUR};
+    constexpr EnumSet<TestEnum1> VAL3{TestEnum1::THREE};
+    constexpr EnumSet<TestEnum1> EMPTY{};
+
+    static_assert(VAL1.is_subset_of(VAL2));
+    static_assert(VAL1.is_subset_of(VAL1));
+    static_assert(!VAL2.is_subset_of(VAL1));
+    static_assert(!VAL3.is_subset_of(VAL2));
+    static_assert(EMPTY.is_subset_of(VAL1));
+
+    static_assert(VAL1.intersects(VAL2));
+    static_assert(!VAL1.intersects(VAL3));
+    static_assert(!EMPTY.intersects(VAL1));
+
+    // Same at runtime, where the word kernels may be used
+    const EnumSet<TestEnum1> var1 = VAL1;
+    EXPECT_TRUE(var1.is_subset_of(VAL2));
+    EXPECT_FALSE(VAL2.is_subset_of(var1));
+    EXPECT_TRUE(var1.intersects(VAL2));
+    EXPECT_FALSE(var1.intersects(VAL3));
+}
+
+TEST(EnumSet, BulkOperationsLargeEnum)
+{
+    using TestEnum65 = rich_enums::TestEnum65;
+    EnumSet<TestEnum65> var1{TestEnum65::V0, TestEnum65::V63, TestEnum65::V64};
+    const EnumSet<TestEnum65> var2{TestEnum65::V1, TestEnum65::V64};
+
+    var1 |= var2;
+    EXPECT_EQ(4, var1.size());
+    var1 -= EnumSet<TestEnum65>{TestEnum65::V64};
+    EXPECT_EQ(3, var1.size());
+    EXPECT_FALSE(var1.contains(TestEnum65::V64));
+    var1 &= var2;
+    EXPECT_EQ((EnumSet<TestEnum65>{TestEnum65::V1}), var1);
+    EXPECT_TRUE(var1.is_subset_of(var2));
+}
+
 namespace
 {
 template <EnumSet<TestEnum1> /*INSTANCE*/>
@@ -14,6 +14,7 @@
 
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <optional>
 #include <type_traits>
@@ -78,6 +79,23 @@ enum class SortedContiguousValuesTestEnum4
     FOUR = 14,
 };
 
+enum class SparseValuesTestEnum5
+{
+    ONE = 1,
+    THREE = 3,
+    NINE = 9,
+    TWENTY = 20,
+};
+
+enum class SparseValuesTestEnum6 : std::int16_t
+{
+    MINUS_HUNDRED = -100,
+    ZERO = 0,
+    SEVEN = 7,
+    HUNDRED = 100,
+    HUNDRED_TWENTY = 120,
+};
+
 static_assert(std::is_trivially_copyable_v<TestRichEnum1>);
 static_assert(!std::is_trivial_v<TestRichEnum1>);
 static_assert(std::is_standard_layout_v<TestRichEnum1>);
@@ -250,6 +268,51 @@ TEST(BuiltinEnumAdapter, Ordinal)
     }
 }
 
+TEST(BuiltinEnumAdapter, OrdinalLookup)
+{
+    static_assert(EnumOrdinalLookup::CONTIGUOUS ==
+                  EnumAdapter<DefaultValuesTestEnum2>::ordinal_lookup());
+    static_assert(EnumOrdinalLookup::CONTIGUOUS ==
+                  EnumAdapter<UnsortedContiguousValuesTestEnum3>::ordinal_lookup());
+    static_assert(EnumOrdinalLookup::DIRECT_TABLE ==
+                  EnumAdapter<CustomValuesTestEnum1>::ordinal_lookup());
+    static_assert(EnumOrdinalLookup::DIRECT_TABLE ==
+                  EnumAdapter<SparseValuesTestEnum5>::ordinal_lookup());
+    static_assert(EnumOrdinalLookup::PERFECT_HASH ==
+                  EnumAdapter<SparseValuesTestEnum6>::ordinal_lookup());
+
+    {
+        using E5 = SparseValuesTestEnum5;
+
+        static_assert(0 == EnumAdapter<E5>::ordinal(E5::ONE));
+        static_assert(1 == EnumAdapter<E5>::ordinal(E5::THREE));
+        static_assert(2 == EnumAdapter<E5>::ordinal(E5::NINE));
+        static_assert(3 == EnumAdapter<E5>::ordinal(E5::TWENTY));
+    }
+    {
+        using E6 = SparseValuesTestEnum6;
+
+        static_assert(0 == EnumAdapter<E6>::ordinal(E6::MINUS_HUNDRED));
+        static_assert(1 == EnumAdapter<E6>::ordinal(E6::ZERO));
+        static_assert(2 == EnumAdapter<E6>::ordinal(E6::SEVEN));
+        static_assert(3 == EnumAdapter<E6>::ordinal(E6::HUNDRED));
+        static_assert(4 == EnumAdapter<E6>::ordinal(E6::HUNDRED_TWENTY));
+    }
+}
+
+TEST(BuiltinEnumAdapter, OrdinalOfInvalidValue)
+{
+    EXPECT_DEATH((void)EnumAdapter<DefaultValuesTestEnum2>::ordinal(
+                     static_cast<DefaultValuesTestEnum2>(4)),
+                 "");
+    EXPECT_DEATH((void)EnumAdapter<SparseValuesTestEnum5>::ordinal(
+                     static_cast<SparseValuesTestEnum5>(2)),
+                 "");
+    EXPECT_DEATH((void)EnumAdapter<SparseValuesTestEnum6>::ordinal(
+                     static_cast<SparseValuesTestEnum6>(50)),
+                 "");
+}
+
 TEST(RichEnumAdapter, Ordinal)
 {
     static_assert(4 == EnumAdapter<TestRichEnum1>::count());
@@ -0,0 +1,163 @@
+#include "fixed_containers/fixed_bitset.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <bit>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+namespace fixed_containers
+{
+namespace
+{
+// Baseline for comparison: the word-by-word loops FixedBitset uses without vector kernels.
+template <std::size_t BIT_COUNT>
+struct PlainWords
+{
+    std::array<std::uint64_t, (BIT_COUNT + 63) / 64> words{};
+
+    void set(std::size_t pos) { words.at(pos / 64) |= std::uint64_t{1} << (pos % 64); }
+
+    PlainWords& operator&=(const PlainWords& other)
+    {
+        for (std::size_t i = 0; i < words.size(); ++i)
+        {
+            words[i] &= other.words[i];
+        }
+        return *this;
+    }
+
+    [[nodiscard]] std::size_t count() const
+    {
+        std::size_t result = 0;
+        for (const std::uint64_t word : words)
+        {
+            result += static_cast<std::size_t>(std::popcount(word));
+        }
+        return result;
+    }
+};
+
+template <typename BitsetType, std::size_t BIT_COUNT>
+BitsetType make_random_bitset(std::uint64_t seed)
+{
+    std::mt19937_64 generator{seed};
+    std::bernoulli_distribution distribution{0.5};
+    BitsetType out{};
+    for (std::size_t i = 0; i < BIT_COUNT; ++i)
+    {
+        if (distribution(generator))
+        {
+            out.set(i);
+        }
+    }
+    return out;
+}
+
+template <typename BitsetType, std::size_t BIT_COUNT>
+void benchmark_and_assign(benchmark::State& state)
+{
+    BitsetType instance = make_random_bitset<BitsetType, BIT_COUNT>(1);
+    const BitsetType other = make_random_bitset<BitsetType, BIT_COUNT>(2);
+    for (auto _ : state)
+    {
+        instance &= other;
+        benchmark::DoNotOptimize(instance);
+    }
+}
+
+template <typename BitsetType, std::size_t BIT_COUNT>
+void benchmark_count(benchmark::State& state)
+{
+    const BitsetType instance = make_random_bitset<BitsetType, BIT_COUNT>(1);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(instance);
+        benchmark::DoNotOptimize(instance.count());
+    }
+}
+
+// What the fused `count_and()` replaces.
+template <typename BitsetType, std::size_t BIT_COUNT>
+void benchmark_count_of_intersection(benchmark::State& state)
+{
+    const BitsetType instance = make_random_bitset<BitsetType, BIT_COUNT>(1);
+    const BitsetType other = make_random_bitset<BitsetType, BIT_COUNT>(2);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(instance);
+        benchmark::DoNotOptimize((instance & other).count());
+    }
+}
+
+template <std::size_t BIT_COUNT>
+void benchmark_fixed_bitset_count_and(benchmark::State& state)
+{
+    using BitsetType = FixedBitset<BIT_COUNT>;
+    const BitsetType instance = make_random_bitset<BitsetType, BIT_COUNT>(1);
+    const BitsetType other = make_random_bitset<BitsetType, BIT_COUNT>(2);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(instance);
+        benchmark::DoNotOptimize(instance.count_and(other));
+    }
+}
+
+template <std::size_t BIT_COUNT>
+void benchmark_fixed_bitset_shift_left(benchmark::State& state)
+{
+    using BitsetType = FixedBitset<BIT_COUNT>;
+    BitsetType instance = make_random_bitset<BitsetType, BIT_COUNT>(1);
+    for (auto _ : state)
+    {
+        instance <<= 3;
+        instance.set(0);
+        benchmark::DoNotOptimize(instance);
+    }
+}
+
+template <std::size_t BIT_COUNT>
+void benchmark_std_bitset_shift_left(benchmark::State& state)
+{
+    using BitsetType = std::bitset<BIT_COUNT>;
+    BitsetType instance = make_random_bitset<BitsetType, BIT_COUNT>(1);
+    for (auto _ : state)
+    {
+        instance <<= 3;
+        instance.set(0);
+        benchmark::DoNotOptimize(instance);
+    }
+}
+}  // namespace
+
+BENCHMARK(benchmark_and_assign<std::bitset<4096>, 4096>);
+BENCHMARK(benchmark_and_assign<PlainWords<4096>, 4096>);
+BENCHMARK(benchmark_and_assign<FixedBitset<4096>, 4096>);
+BENCHMARK(benchmark_and_assign<std::bitset<65536>, 65536>);
+BENCHMARK(benchmark_and_assign<PlainWords<65536>, 65536>);
+BENCHMARK(benchmark_and_assign<FixedBitset<65536>, 65536>);
+
+BENCHMARK(benchmark_count<std::bitset<4096>, 4096>);
+BENCHMARK(benchmark_count<PlainWords<4096>, 4096>);
+BENCHMARK(benchmark_count<FixedBitset<4096>, 4096>);
+BENCHMARK(benchmark_count<std::bitset<65536>, 65536>);
+BENCHMARK(benchmark_count<PlainWords<65536>, 65536>);
+BENCHMARK(benchmark_count<FixedBitset<65536>, 65536>);
+
+BENCHMARK(benchmark_count_of_intersection<std::bitset<4096>, 4096>);
+BENCHMARK(benchmark_count_of_intersection<FixedBitset<4096>, 4096>);
+BENCHMARK(benchmark_fixed_bitset_count_and<4096>);
+BENCHMARK(benchmark_count_of_intersection<std::bitset<65536>, 65536>);
+BENCHMARK(benchmark_count_of_intersection<FixedBitset<65536>, 65536>);
+BENCHMARK(benchmark_fixed_bitset_count_and<65536>);
+
+BENCHMARK(benchmark_std_bitset_shift_left<4096>);
+BENCHMARK(benchmark_fixed_bitset_shift_left<4096>);
+BENCHMARK(benchmark_std_bitset_shift_left<65536>);
+BENCHMARK(benchmark_fixed_bitset_shift_left<65536>);
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
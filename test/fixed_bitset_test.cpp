@@ -7,10 +7,13 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
 #include <bitset>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <random>
 #include <string>
 #include <type_traits>
 
@@ -27,6 +30,25 @@ static_assert(sizeof(FixedBitset<33>) == 8);
 static_assert(sizeof(FixedBitset<64>) == 8);
 static_assert(sizeof(FixedBitset<65>) == 16);
 
+// The CMake build also compiles this file with the flags of each vector kernel.
+#if defined(__AVX512F__) && defined(__AVX512VPOPCNTDQ__)
+static_assert(fixed_bitset_simd_detail::ENABLED);
+static_assert(fixed_bitset_simd_detail::Isa::WORDS_PER_REG == 8);
+static_assert(
+    std::is_same_v<fixed_bitset_simd_detail::Isa, fixed_bitset_simd_detail::isa_avx512::Isa>);
+static_assert(fixed_bitset_simd_detail::USE_KERNELS<std::uint64_t, 32>);
+#elif defined(__AVX2__)
+static_assert(fixed_bitset_simd_detail::ENABLED);
+static_assert(fixed_bitset_simd_detail::Isa::WORDS_PER_REG == 4);
+static_assert(
+    std::is_same_v<fixed_bitset_simd_detail::Isa, fixed_bitset_simd_detail::isa_avx2::Isa>);
+static_assert(fixed_bitset_simd_detail::USE_KERNELS<std::uint64_t, 16>);
+#elif !defined(__aarch64__)
+static_assert(
+    std::is_same_v<fixed_bitset_simd_detail::Isa, fixed_bitset_simd_detail::isa_none::Isa>);
+static_assert(!fixed_bitset_simd_detail::USE_KERNELS<std::uint64_t, 1024>);
+#endif
+
 TEST(FixedBitset, DefaultConstructor)
 {
     constexpr FixedBitset<8> VAL1{};
@@ -316,6 +338,162 @@ TEST(FixedBitset, Size)
     }
 }
 
+TEST(FixedBitset, FindFirstAndNext)
+{
+    {
+        constexpr FixedBitset<8> VAL1{42};  // [0,0,1,0,1,0,1,0]
+        static_assert(1 == VAL1.find_first());
+        static_assert(3 == VAL1.find_next(1));
+        static_assert(3 == VAL1.find_next(2));
+        static_assert(5 == VAL1.find_next(3));
+        static_assert(8 == VAL1.find_next(5));
+        static_assert(8 == VAL1.find_next(7));
+        static_assert(8 == VAL1.find_next(100));
+    }
+
+    {
+        constexpr FixedBitset<8> VAL1{};
+        static_assert(8 == VAL1.find_first());
+        static_assert(8 == VAL1.find_last());
+        constexpr FixedBitset<0> VAL2{};
+        static_assert(0 == VAL2.find_first());
+        static_assert(0 == VAL2.find_last());
+    }
+
+    {
+        constexpr auto VAL1 = []()
+        {
+            FixedBitset<300> var{};
+            var.set(0);
+            var.set(64);
+            var.set(200);
+            var.set(299);
+            return var;
+        }();
+        static_assert(0 == VAL1.find_first());
+        static_assert(64 == VAL1.find_next(0));
+        static_assert(200 == VAL1.find_next(64));
+        static_assert(299 == VAL1.find_next(200));
+        static_assert(300 == VAL1.find_next(299));
+    }
+}
+
+TEST(FixedBitset, FindLastAndPrev)
+{
+    {
+        constexpr FixedBitset<8> VAL1{42};  // [0,0,1,0,1,0,1,0]
+        static_assert(5 == VAL1.find_last());
+        static_assert(5 == VAL1.find_prev(8));
+        static_assert(3 == VAL1.find_prev(5));
+        static_assert(1 == VAL1.find_prev(3));
+        static_assert(1 == VAL1.find_prev(2));
+        static_assert(8 == VAL1.find_prev(1));
+        static_assert(8 == VAL1.find_prev(0));
+    }
+
+    {
+        constexpr auto VAL1 = []()
+        {
+            FixedBitset<300> var{};
+            var.set(0);
+            var.set(64);
+            var.set(299);
+            return var;
+        }();
+        static_assert(299 == VAL1.find_last());
+        static_assert(64 == VAL1.find_prev(299));
+        static_assert(64 == VAL1.find_prev(65));
+        static_assert(0 == VAL1.find_prev(64));
+        static_assert(300 == VAL1.find_prev(0));
+    }
+}
+
+TEST(FixedBitset, ForEachSetBit)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedBitset<130> var{};
+        var.set(3);
+        var.set(63);
+        var.set(64);
+        var.set(129);
+
+        std::array<std::size_t, 4> out{};
+        std::size_t count = 0;
+        var.for_each_set_bit([&](std::size_t index) { out.at(count++) = index; });
+        return out;
+    }();
+
+    static_assert(VAL1 == std::array<std::size_t, 4>{3, 63, 64, 129});
+}
+
+TEST(FixedBitset, FindMatchesTest)
+{
+    FixedBitset<200> var1{};
+    for (std::size_t i = 0; i < 200; i += 7)
+    {
+        var1.set(i);
+    }
+    var1.set(199);
+
+    std::size_t expected_next = 0;
+    for (std::size_t i = var1.find_first(); i < var1.size(); i = var1.find_next(i))
+    {
+        while (!var1.test(expected_next))
+        {
+            expected_next++;
+        }
+        EXPECT_EQ(expected_next, i);
+        expected_next++;
+    }
+
+    std::size_t visited = 0;
+    var1.for_each_set_bit([&](std::size_t index) { EXPECT_TRUE(var1.test(index)); visited++; });
+    EXPECT_EQ(var1.count(), visited);
+}
+
+TEST(FixedBitset, Rank)
+{
+    constexpr FixedBitset<8> VAL1{"01100101"};
+    static_assert(0 == VAL1.rank(0));
+    static_assert(1 == VAL1.rank(1));
+    static_assert(2 == VAL1.rank(3));
+    static_assert(4 == VAL1.rank(8));
+    static_assert(4 == VAL1.rank(100));
+
+    FixedBitset<200> var1{};
+    std::size_t expected = 0;
+    for (std::size_t i = 0; i < 200; i++)
+    {
+        EXPECT_EQ(expected, var1.rank(i));
+        if (i % 3 == 0)
+        {
+            var1.set(i);
+            expected++;
+        }
+    }
+    EXPECT_EQ(var1.count(), var1.rank(200));
+}
+
+TEST(FixedBitset, RankWithinWord)
+{
+    constexpr FixedBitset<8> VAL1{"01100101"};
+    static_assert(0 == VAL1.rank_within_word(0));
+    static_assert(2 == VAL1.rank_within_word(3));
+    static_assert(4 == VAL1.rank_within_word(7));
+
+    FixedBitset<200> var1{};
+    for (std::size_t i = 0; i < 200; i += 3)
+    {
+        var1.set(i);
+    }
+    for (std::size_t i = 0; i < 200; i++)
+    {
+        const std::size_t word_start = i - (i % 64);
+        EXPECT_EQ(var1.rank(i) - var1.rank(word_start), var1.rank_within_word(i));
+    }
+}
+
 TEST(FixedBitset, OperatorBitwiseAnd)
 {
     constexpr FixedBitset<4> LEFT{"1101"};
@@ -383,6 +561,78 @@ TEST(FixedBitset, OperatorBinaryShiftRight)
     static_assert(VAL6 == (VAL5 >> 1));
 }
 
+TEST(FixedBitset, FusedOperations)
+{
+    constexpr FixedBitset<8> VAL1{"01110010"};
+    constexpr FixedBitset<8> VAL2{"00111001"};
+
+    static_assert(2 == VAL1.count_and(VAL2));
+    static_assert(VAL1.any_and(VAL2));
+    static_assert(!VAL1.any_and(~VAL1));
+
+    constexpr auto VAL3 = [&]()
+    {
+        FixedBitset<8> var = VAL1;
+        var.and_not(VAL2);
+        return var;
+    }();
+    static_assert(FixedBitset<8>{"01000010"} == VAL3);
+}
+
+namespace
+{
+template <std::size_t BIT_COUNT>
+void check_large_bitset_matches_std_bitset()
+{
+    std::mt19937_64 generator{BIT_COUNT};
+    std::bernoulli_distribution distribution{0.5};
+
+    FixedBitset<BIT_COUNT> var1{};
+    FixedBitset<BIT_COUNT> var2{};
+    for (std::size_t i = 0; i < BIT_COUNT; i++)
+    {
+        var1.set(i, distribution(generator));
+        var2.set(i, distribution(generator));
+    }
+    const std::bitset<BIT_COUNT> expected1{var1.to_string()};
+    const std::bitset<BIT_COUNT> expected2{var2.to_string()};
+
+    ASSERT_EQ(expected1.count(), var1.count());
+    ASSERT_EQ((expected1 & expected2).count(), var1.count_and(var2));
+    ASSERT_EQ((expected1 & expected2).to_string(), (var1 & var2).to_string());
+    ASSERT_EQ((expected1 | expected2).to_string(), (var1 | var2).to_string());
+    ASSERT_EQ((expected1 ^ expected2).to_string(), (var1 ^ var2).to_string());
+    ASSERT_EQ((expected1 & ~expected2).to_string(), FixedBitset{var1}.and_not(var2).to_string());
+
+    const std::array<std::size_t, 8> shifts{1, 7, 63, 64, 65, 300, BIT_COUNT - 1, BIT_COUNT};
+    for (const std::size_t shift : shifts)
+    {
+        ASSERT_EQ((expected1 << shift).to_string(), (var1 << shift).to_string()) << shift;
+        ASSERT_EQ((expected1 >> shift).to_string(), (var1 >> shift).to_string()) << shift;
+    }
+
+    FixedBitset<BIT_COUNT> var3{};
+    ASSERT_FALSE(var3.any());
+    ASSERT_FALSE(var1.any_and(var3));
+    var3.set(BIT_COUNT - 1);
+    ASSERT_TRUE(var3.any());
+    ASSERT_TRUE(var3.any_and(var3));
+    ASSERT_FALSE(var3.all());
+    var3.set();
+    ASSERT_TRUE(var3.all());
+    var3.reset(BIT_COUNT - 1);
+    ASSERT_FALSE(var3.all());
+    ASSERT_EQ(BIT_COUNT - 1, var3.count());
+}
+}  // namespace
+
+TEST(FixedBitset, LargeBitsetMatchesStdBitset)
+{
+    check_large_bitset_matches_std_bitset<4096>();
+    check_large_bitset_matches_std_bitset<4093>();
+    check_large_bitset_matches_std_bitset<1000>();
+}
+
 TEST(FixedBitset, Set)
 {
     {
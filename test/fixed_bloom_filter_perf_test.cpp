@@ -0,0 +1,79 @@
+#include "fixed_containers/fixed_bloom_filter.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+std::vector<std::uint64_t> make_random_keys(std::size_t count, std::uint64_t seed)
+{
+    std::mt19937_64 generator{seed};
+    std::vector<std::uint64_t> out(count);
+    for (std::uint64_t& key : out)
+    {
+        key = generator();
+    }
+    return out;
+}
+
+template <std::size_t BIT_COUNT, std::size_t HASH_COUNT>
+void benchmark_insert(benchmark::State& state)
+{
+    const std::vector<std::uint64_t> keys = make_random_keys(BIT_COUNT / 10, 1);
+    for (auto _ : state)
+    {
+        FixedBloomFilter<std::uint64_t, BIT_COUNT, HASH_COUNT> instance{};
+        for (const std::uint64_t key : keys)
+        {
+            instance.insert(key);
+        }
+        benchmark::DoNotOptimize(instance);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * keys.size()));
+}
+
+// Looks up keys that were never inserted, so every positive is a false positive. Reports the
+// measured rate next to the one the filter estimates from its occupancy.
+template <std::size_t BIT_COUNT, std::size_t HASH_COUNT>
+void benchmark_false_positive_rate(benchmark::State& state)
+{
+    const auto bits_per_key = static_cast<std::size_t>(state.range(0));
+    FixedBloomFilter<std::uint64_t, BIT_COUNT, HASH_COUNT> instance{};
+    for (const std::uint64_t key : make_random_keys(BIT_COUNT / bits_per_key, 1))
+    {
+        instance.insert(key);
+    }
+    const std::vector<std::uint64_t> absent = make_random_keys(100'000, 2);
+
+    std::size_t false_positives = 0;
+    std::size_t lookups = 0;
+    for (auto _ : state)
+    {
+        for (const std::uint64_t key : absent)
+        {
+            false_positives += instance.contains(key) ? 1 : 0;
+        }
+        lookups += absent.size();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(lookups));
+    state.counters["false_positive_rate"] =
+        static_cast<double>(false_positives) / static_cast<double>(lookups);
+    state.counters["estimated_false_positive_rate"] = instance.estimated_false_positive_rate();
+}
+}  // namespace
+
+BENCHMARK(benchmark_insert<65'536, 7>);
+BENCHMARK(benchmark_insert<1'048'576, 7>);
+
+BENCHMARK(benchmark_false_positive_rate<1'048'576, 4>)->Arg(6)->Arg(10)->Arg(16);
+BENCHMARK(benchmark_false_positive_rate<1'048'576, 7>)->Arg(6)->Arg(10)->Arg(16);
+BENCHMARK(benchmark_false_positive_rate<1'048'576, 11>)->Arg(6)->Arg(10)->Arg(16);
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -0,0 +1,185 @@
+#include "fixed_containers/fixed_bloom_filter.hpp"
+
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using FilterType = FixedBloomFilter<std::uint64_t, 8192, 7>;
+static_assert(std::is_trivially_copyable_v<FilterType>);
+static_assert(IsStructuralType<FilterType>);
+static_assert(FilterType::block_count() == 16);
+
+// Every block is one cache line
+static_assert(std::is_standard_layout_v<FilterType>);
+static_assert(offsetof(FilterType, IMPLEMENTATION_DETAIL_DO_NOT_USE_bits_) == 0);
+static_assert(alignof(FilterType) == 64);
+// The default hasher is stateless and takes no space
+static_assert(sizeof(FilterType) == 8192 / 8);
+
+struct SeededHash
+{
+    std::uint64_t seed;
+    constexpr std::uint64_t operator()(const std::uint64_t key) const
+    {
+        return wyhash::hash<std::uint64_t>{}(key ^ seed);
+    }
+};
+using SeededFilterType = FixedBloomFilter<std::uint64_t, 1024, 7, SeededHash>;
+static_assert(std::is_standard_layout_v<SeededFilterType>);
+static_assert(offsetof(SeededFilterType, IMPLEMENTATION_DETAIL_DO_NOT_USE_bits_) == 0);
+static_assert(alignof(SeededFilterType) == 64);
+}  // namespace
+
+TEST(FixedBloomFilter, DefaultConstructor)
+{
+    constexpr FilterType VAL1{};
+    static_assert(VAL1.empty());
+    static_assert(!VAL1.contains(1));
+    static_assert(VAL1.estimated_false_positive_rate() == 0.0);
+}
+
+TEST(FixedBloomFilter, Insert)
+{
+    constexpr FilterType VAL1 = []()
+    {
+        FilterType var{};
+        var.insert(10);
+        var.insert(20);
+        var.insert(30);
+        return var;
+    }();
+
+    static_assert(VAL1.contains(10));
+    static_assert(VAL1.contains(20));
+    static_assert(VAL1.contains(30));
+    static_assert(!VAL1.empty());
+    static_assert(VAL1.count_set_bits() <= 3 * FilterType::hash_count());
+
+    FilterType var1{};
+    EXPECT_TRUE(var1.insert(42));
+    EXPECT_FALSE(var1.insert(42));
+    EXPECT_TRUE(var1.contains(42));
+}
+
+TEST(FixedBloomFilter, IteratorConstructor)
+{
+    constexpr std::array<std::uint64_t, 4> ENTRIES{1, 2, 3, 4};
+    constexpr FilterType VAL1{ENTRIES.begin(), ENTRIES.end()};
+    static_assert(VAL1.contains(1));
+    static_assert(VAL1.contains(4));
+}
+
+TEST(FixedBloomFilter, ProbesStayWithinOneBlock)
+{
+    FilterType var1{};
+    var1.insert(123'456);
+    const auto& words = var1.bitset().IMPLEMENTATION_DETAIL_DO_NOT_USE_data_;
+    std::size_t blocks_touched = 0;
+    for (std::size_t block = 0; block < FilterType::block_count(); block++)
+    {
+        bool touched = false;
+        for (std::size_t w = 0; w < 8; w++)
+        {
+            touched = touched || words[(block * 8) + w] != 0;
+        }
+        blocks_touched += touched ? 1 : 0;
+    }
+    EXPECT_EQ(1, blocks_touched);
+}
+
+TEST(FixedBloomFilter, BlocksAreCacheLineAligned)
+{
+    const auto is_cache_line_aligned = [](const auto& filter)
+    {
+        const auto& words = filter.bitset().IMPLEMENTATION_DETAIL_DO_NOT_USE_data_;
+        return reinterpret_cast<std::uintptr_t>(words.data()) % 64 == 0;
+    };
+
+    const FilterType on_stack{};
+    EXPECT_TRUE(is_cache_line_aligned(on_stack));
+
+    const auto on_heap = std::make_unique<FilterType>();
+    EXPECT_TRUE(is_cache_line_aligned(*on_heap));
+
+    const std::vector<SeededFilterType> in_vector(3, SeededFilterType{SeededHash{7}});
+    for (const SeededFilterType& filter : in_vector)
+    {
+        EXPECT_TRUE(is_cache_line_aligned(filter));
+    }
+}
+
+TEST(FixedBloomFilter, NoFalseNegativesAndBoundedFalsePositives)
+{
+    // ~10 bits per key: a classic filter would be at ~0.8%, blocking costs a bit more.
+    static constexpr std::size_t KEY_COUNT = 6'500;
+    FixedBloomFilter<std::uint64_t, 65'536, 7> var1{};
+    for (std::uint64_t i = 0; i < KEY_COUNT; i++)
+    {
+        var1.insert(i * 2);
+    }
+    for (std::uint64_t i = 0; i < KEY_COUNT; i++)
+    {
+        ASSERT_TRUE(var1.contains(i * 2));
+    }
+
+    std::size_t false_positives = 0;
+    static constexpr std::size_t PROBE_COUNT = 100'000;
+    for (std::uint64_t i = 0; i < PROBE_COUNT; i++)
+    {
+        false_positives += var1.contains((i * 2) + 1) ? 1 : 0;
+    }
+    const double measured = static_cast<double>(false_positives) / PROBE_COUNT;
+    EXPECT_LT(measured, 0.02);
+
+    const double estimated = var1.estimated_false_positive_rate();
+    EXPECT_GT(estimated, measured / 2);
+    EXPECT_LT(estimated, measured * 2);
+}
+
+TEST(FixedBloomFilter, StringKeys)
+{
+    FixedBloomFilter<std::string_view, 1024, 4> var1{};
+    var1.insert("alpha");
+    var1.insert("beta");
+    EXPECT_TRUE(var1.contains("alpha"));
+    EXPECT_TRUE(var1.contains("beta"));
+    EXPECT_FALSE(var1.contains("gamma"));
+}
+
+TEST(FixedBloomFilter, Union)
+{
+    constexpr FilterType VAL1 = []()
+    {
+        FilterType var{};
+        var.insert(1);
+        FilterType other{};
+        other.insert(2);
+        var |= other;
+        return var;
+    }();
+    static_assert(VAL1.contains(1));
+    static_assert(VAL1.contains(2));
+}
+
+TEST(FixedBloomFilter, Clear)
+{
+    FilterType var1{};
+    var1.insert(7);
+    var1.clear();
+    EXPECT_TRUE(var1.empty());
+    EXPECT_FALSE(var1.contains(7));
+}
+
+}  // namespace fixed_containers
@@ -2313,6 +2313,149 @@ TEST(FixedCircularDeque, BackEmptyContainer)
     run_test(FixedCircularDequeInitialStateLastIndex{});
 }
 
+TEST(FixedCircularDeque, AsSpans)
+{
+    {
+        const FixedCircularDeque<int, 5> var1{};
+        EXPECT_TRUE(var1.as_spans()[0].empty());
+        EXPECT_TRUE(var1.as_spans()[1].empty());
+    }
+
+    {
+        // Not wrapped
+        FixedCircularDeque<int, 5> var1{1, 2, 3};
+        const auto spans = var1.as_spans();
+        EXPECT_TRUE(std::ranges::equal(spans[0], std::array<int, 3>{1, 2, 3}));
+        EXPECT_TRUE(spans[1].empty());
+
+        spans[0][1] = 20;
+        EXPECT_EQ(20, var1.at(1));
+    }
+
+    {
+        // Wrapped
+        FixedCircularDeque<int, 5> var1{1, 2, 3, 4, 5};
+        var1.push_back(6);
+        var1.push_back(7);
+        const auto& v1_const_ref = var1;
+        const auto spans = v1_const_ref.as_spans();
+        EXPECT_TRUE(std::ranges::equal(spans[0], std::array<int, 3>{3, 4, 5}));
+        EXPECT_TRUE(std::ranges::equal(spans[1], std::array<int, 2>{6, 7}));
+    }
+}
+
+TEST(FixedCircularDeque, PushBackN)
+{
+    auto run_test = []<IsFixedCircularDequeFactory Factory>(Factory&&)
+    {
+        constexpr auto VAL1 = []()
+        {
+            auto var = Factory::template create<int, 5>({1, 2});
+            constexpr std::array<int, 2> ENTRIES{3, 4};
+            var.push_back_n(ENTRIES);
+            return var;
+        }();
+
+        static_assert(std::ranges::equal(VAL1, std::array<int, 4>{1, 2, 3, 4}));
+
+        auto var2 = Factory::template create<int, 5>({1, 2, 3});
+        const std::array<int, 4> entries{4, 5, 6, 7};
+        var2.push_back_n(entries);
+        EXPECT_TRUE(std::ranges::equal(var2, std::array<int, 5>{3, 4, 5, 6, 7}));
+
+        // More than the capacity
+        const std::array<int, 7> entries2{10, 11, 12, 13, 14, 15, 16};
+        var2.push_back_n(entries2);
+        EXPECT_TRUE(std::ranges::equal(var2, std::array<int, 5>{12, 13, 14, 15, 16}));
+
+        var2.push_back_n({});
+        EXPECT_EQ(5, var2.size());
+    };
+
+    run_test(FixedCircularDequeInitialStateFirstIndex{});
+    run_test(FixedCircularDequeInitialStateLastIndex{});
+}
+
+TEST(FixedCircularDeque, PopFrontN)
+{
+    auto run_test = []<IsFixedCircularDequeFactory Factory>(Factory&&)
+    {
+        constexpr auto VAL1 = []()
+        {
+            auto var = Factory::template create<int, 5>({1, 2, 3, 4});
+            var.pop_front_n(3);
+            return var;
+        }();
+
+        static_assert(std::ranges::equal(VAL1, std::array<int, 1>{4}));
+
+        auto var2 = Factory::template create<int, 5>({1, 2, 3});
+        var2.pop_front_n(0);
+        EXPECT_EQ(3, var2.size());
+        var2.pop_front_n(3);
+        EXPECT_TRUE(var2.empty());
+        EXPECT_DEATH(var2.pop_front_n(1), "");
+    };
+
+    run_test(FixedCircularDequeInitialStateFirstIndex{});
+    run_test(FixedCircularDequeInitialStateLastIndex{});
+}
+
+TEST(FixedCircularDeque, Linearize)
+{
+    auto run_test = []<IsFixedCircularDequeFactory Factory>(Factory&&)
+    {
+        constexpr auto VAL1 = []()
+        {
+            auto var = Factory::template create<int, 5>({1, 2, 3, 4, 5});
+            var.push_back(6);
+            var.push_back(7);
+            var.linearize();
+            return var;
+        }();
+
+        static_assert(std::ranges::equal(VAL1, std::array<int, 5>{3, 4, 5, 6, 7}));
+        static_assert(VAL1.as_spans()[0].size() == 5);
+        static_assert(VAL1.as_spans()[1].empty());
+
+        // With a gap between the two segments
+        auto var2 = Factory::template create<int, 5>({1, 2, 3, 4, 5});
+        var2.push_back(6);
+        var2.pop_back();
+        var2.pop_front();
+        auto span = var2.linearize();
+        EXPECT_TRUE(std::ranges::equal(span, std::array<int, 3>{3, 4, 5}));
+        EXPECT_TRUE(std::ranges::equal(var2, std::array<int, 3>{3, 4, 5}));
+        EXPECT_TRUE(var2.as_spans()[1].empty());
+
+        // Subsequent operations wrap correctly
+        const std::array<int, 4> entries{6, 7, 8, 9};
+        var2.push_back_n(entries);
+        EXPECT_TRUE(std::ranges::equal(var2, std::array<int, 5>{5, 6, 7, 8, 9}));
+
+        var2.clear();
+        EXPECT_TRUE(var2.linearize().empty());
+    };
+
+    run_test(FixedCircularDequeInitialStateFirstIndex{});
+    run_test(FixedCircularDequeInitialStateLastIndex{});
+}
+
+TEST(FixedCircularDeque, LinearizeNonTriviallyCopyable)
+{
+    FixedCircularDeque<std::deque<int>, 4> var1{};
+    for (int i = 0; i < 6; i++)
+    {
+        var1.push_back(std::deque<int>{i});
+    }
+    var1.pop_front();
+    const auto span = var1.linearize();
+    ASSERT_EQ(3, span.size());
+    EXPECT_EQ(3, span[0].front());
+    EXPECT_EQ(4, span[1].front());
+    EXPECT_EQ(5, span[2].front());
+}
+
 TEST(FixedCircularDeque, OverloadedAddressOfOperator)
 {
     {
@@ -6,6 +6,7 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
 
 namespace fixed_containers
@@ -247,6 +248,26 @@ TEST(FixedCircularQueue, Full)
     EXPECT_TRUE(is_full(VAL1));
 }
 
+TEST(FixedCircularQueue, BulkOperations)
+{
+    FixedCircularQueue<int, 4> var1{};
+    const std::array<int, 3> entries{1, 2, 3};
+    var1.push_n(entries);
+    var1.push_n(entries);
+    EXPECT_EQ(4, var1.size());
+    EXPECT_EQ(3, var1.front());
+    EXPECT_EQ(3, var1.back());
+
+    const auto spans = var1.as_spans();
+    EXPECT_EQ(4, spans[0].size() + spans[1].size());
+
+    var1.pop_n(1);
+    EXPECT_EQ(1, var1.front());
+
+    const auto span = var1.linearize();
+    EXPECT_TRUE(std::ranges::equal(span, std::array<int, 3>{1, 2, 3}));
+}
+
 TEST(FixedCircularQueue, ClassTemplateArgumentDeduction)
 {
     // Compile-only test
@@ -0,0 +1,360 @@
+#include "fixed_containers/fixed_compressed_bitset.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_bitset.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <random>
+#include <set>
+#include <type_traits>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using SparseBitset = FixedCompressedBitset<1'000'000, 1024>;
+static_assert(std::is_trivially_copyable_v<SparseBitset>);
+static_assert(IsStructuralType<SparseBitset>);
+static_assert(sizeof(SparseBitset) < sizeof(FixedBitset<1'000'000>) / 32);
+
+template <class BitsetType>
+std::vector<std::size_t> set_bits_of(const BitsetType& bitset)
+{
+    std::vector<std::size_t> out{};
+    bitset.for_each_set_bit([&](const std::size_t index) { out.push_back(index); });
+    return out;
+}
+
+template <class BitsetType>
+void expect_same(const std::set<std::size_t>& expected, const BitsetType& actual)
+{
+    ASSERT_EQ(expected.size(), actual.count());
+    EXPECT_EQ((std::vector<std::size_t>{expected.begin(), expected.end()}), set_bits_of(actual));
+    for (const std::size_t index : expected)
+    {
+        ASSERT_TRUE(actual.test(index));
+    }
+}
+}  // namespace
+
+TEST(FixedCompressedBitset, DefaultConstructor)
+{
+    constexpr SparseBitset VAL1{};
+    static_assert(VAL1.size() == 1'000'000);
+    static_assert(VAL1.none());
+    static_assert(VAL1.count() == 0);
+    static_assert(VAL1.find_first() == VAL1.size());
+}
+
+TEST(FixedCompressedBitset, SetAndTest)
+{
+    constexpr FixedCompressedBitset<200'000, 8> VAL1 = []()
+    {
+        FixedCompressedBitset<200'000, 8> var{};
+        var.set(70'000);
+        var.set(5);
+        var.set(199'999);
+        var.set(5);
+        var.set(6).reset(6);
+        return var;
+    }();
+
+    static_assert(VAL1.count() == 3);
+    static_assert(VAL1.test(5));
+    static_assert(VAL1.test(70'000));
+    static_assert(VAL1.test(199'999));
+    static_assert(!VAL1.test(6));
+    static_assert(VAL1.used_pool_values() == 3);
+
+    static_assert(VAL1.find_first() == 5);
+    static_assert(VAL1.find_next(5) == 70'000);
+    static_assert(VAL1.find_next(70'000) == 199'999);
+    static_assert(VAL1.find_next(199'999) == VAL1.size());
+}
+
+TEST(FixedCompressedBitset, MatchesStdSet)
+{
+    FixedCompressedBitset<300'000, 4096> var1{};
+    std::set<std::size_t> reference{};
+
+    std::mt19937 engine{7};  // NOLINT(cert-msc32-c,cert-msc51-cpp)
+    std::uniform_int_distribution<std::size_t> distribution{0, 299'999};
+    for (std::size_t i = 0; i < 3000; i++)
+    {
+        const std::size_t index = distribution(engine);
+        if (i % 4 == 3)
+        {
+            var1.reset(index);
+            reference.erase(index);
+        }
+        else
+        {
+            var1.set(index);
+            reference.insert(index);
+        }
+    }
+
+    expect_same(reference, var1);
+    for (std::size_t i = 0; i < 299'999; i += 997)
+    {
+        ASSERT_EQ(reference.contains(i), var1.test(i));
+    }
+
+    std::size_t expected_next = reference.empty() ? var1.size() : *reference.begin();
+    EXPECT_EQ(expected_next, var1.find_first());
+}
+
+TEST(FixedCompressedBitset, DenseChunksUseBitmaps)
+{
+    FixedCompressedBitset<200'000, 8192, 2> var1{};
+    for (std::size_t i = 0; i < 10'000; i++)
+    {
+        var1.set(65'536 + (i * 3));
+    }
+    EXPECT_EQ(10'000, var1.count());
+    EXPECT_EQ(1, var1.used_bitmap_containers());
+    EXPECT_EQ(0, var1.used_pool_values());
+    EXPECT_TRUE(var1.test(65'536 + 300));
+    EXPECT_FALSE(var1.test(65'536 + 301));
+    EXPECT_EQ(65'536, var1.find_first());
+    EXPECT_EQ(65'539, var1.find_next(65'536));
+
+    // Back to an array once sparse enough
+    for (std::size_t i = 0; i < 8'000; i++)
+    {
+        var1.reset(65'536 + (i * 3));
+    }
+    EXPECT_EQ(2'000, var1.count());
+    EXPECT_EQ(0, var1.used_bitmap_containers());
+    EXPECT_EQ(2'000, var1.used_pool_values());
+    EXPECT_TRUE(var1.test(65'536 + (8'000 * 3)));
+}
+
+TEST(FixedCompressedBitset, DenseChunksWithoutBitmapSlots)
+{
+    FixedCompressedBitset<100'000, 6000> var1{};
+    for (std::size_t i = 0; i < 5'000; i++)
+    {
+        var1.set(i * 2);
+    }
+    EXPECT_EQ(5'000, var1.count());
+    EXPECT_EQ(5'000, var1.used_pool_values());
+    EXPECT_TRUE(var1.test(9'998));
+}
+
+TEST(FixedCompressedBitset, RunOptimize)
+{
+    FixedCompressedBitset<200'000, 64, 1> var1{};
+    for (std::size_t i = 100; i < 20'000; i++)
+    {
+        var1.set(i);
+    }
+    var1.set(150'000);
+    var1.set(150'001);
+    EXPECT_EQ(1, var1.used_bitmap_containers());
+
+    EXPECT_TRUE(var1.run_optimize());
+    EXPECT_FALSE(var1.run_optimize());
+    EXPECT_EQ(0, var1.used_bitmap_containers());
+    EXPECT_EQ(4, var1.used_pool_values());
+    EXPECT_EQ(19'902, var1.count());
+    EXPECT_FALSE(var1.test(99));
+    EXPECT_TRUE(var1.test(100));
+    EXPECT_TRUE(var1.test(19'999));
+    EXPECT_FALSE(var1.test(20'000));
+    EXPECT_TRUE(var1.test(150'001));
+    EXPECT_EQ(100, var1.find_first());
+    EXPECT_EQ(150'000, var1.find_next(19'999));
+
+    // Modifications edit the runs in place
+    var1.reset(500);
+    EXPECT_FALSE(var1.test(500));
+    EXPECT_EQ(19'901, var1.count());
+    EXPECT_EQ(0, var1.used_bitmap_containers());
+    EXPECT_EQ(6, var1.used_pool_values());
+    var1.set(150'002);
+    EXPECT_EQ(19'902, var1.count());
+    EXPECT_EQ(7, var1.used_pool_values());
+}
+
+TEST(FixedCompressedBitset, RunEditsInPlace)
+{
+    // The pool has room for the 60k bits as an array only until other chunks use some of it
+    FixedCompressedBitset<200'000, 60'002> var1{};
+    std::set<std::size_t> reference{};
+    for (std::size_t i = 1'000; i < 61'000; i++)
+    {
+        var1.set(i);
+        reference.insert(i);
+    }
+    EXPECT_TRUE(var1.run_optimize());
+    EXPECT_EQ(2, var1.used_pool_values());
+    for (std::size_t i = 100'000; i < 110'000; i += 10)
+    {
+        var1.set(i);
+        reference.insert(i);
+    }
+    EXPECT_EQ(1'002, var1.used_pool_values());
+
+    // Split the run, then merge it back
+    var1.reset(30'000);
+    EXPECT_FALSE(var1.test(30'000));
+    EXPECT_EQ(1'004, var1.used_pool_values());
+    var1.set(30'000);
+    EXPECT_EQ(1'002, var1.used_pool_values());
+    expect_same(reference, var1);
+
+    // Trim and extend the ends
+    var1.reset(1'000);
+    var1.reset(60'999);
+    var1.set(61'000);
+    reference.erase(1'000);
+    reference.erase(60'999);
+    reference.insert(61'000);
+    EXPECT_EQ(1'004, var1.used_pool_values());
+    expect_same(reference, var1);
+
+    // Single-bit runs, before, between and after the others
+    var1.set(10);
+    var1.set(60'999);
+    var1.set(0);
+    var1.reset(61'000);
+    reference.insert(10);
+    reference.insert(60'999);
+    reference.insert(0);
+    reference.erase(61'000);
+    EXPECT_EQ(1'006, var1.used_pool_values());
+    expect_same(reference, var1);
+
+    for (const std::size_t index : reference)
+    {
+        var1.reset(index);
+    }
+    EXPECT_TRUE(var1.none());
+    EXPECT_EQ(0, var1.used_pool_values());
+}
+
+TEST(FixedCompressedBitset, Equality)
+{
+    FixedCompressedBitset<100'000, 64, 1> var1{};
+    FixedCompressedBitset<100'000, 64, 1> var2{};
+    EXPECT_EQ(var1, var2);
+
+    for (std::size_t i = 10; i < 50; i++)
+    {
+        var1.set(i);
+        var2.set(i);
+    }
+    var2.run_optimize();
+    EXPECT_EQ(var1, var2);
+
+    var2.reset(20);
+    EXPECT_NE(var1, var2);
+    var1.reset(20);
+    var1.set(21);
+    EXPECT_EQ(var1, var2);
+}
+
+TEST(FixedCompressedBitset, BinaryOperations)
+{
+    using BitsetType = FixedCompressedBitset<300'000, 16384, 2>;
+
+    std::mt19937 engine{11};  // NOLINT(cert-msc32-c,cert-msc51-cpp)
+    std::uniform_int_distribution<std::size_t> sparse{0, 299'999};
+    std::uniform_int_distribution<std::size_t> dense{0, 19'999};
+
+    BitsetType left{};
+    BitsetType right{};
+    std::set<std::size_t> left_reference{};
+    std::set<std::size_t> right_reference{};
+    for (std::size_t i = 0; i < 2'000; i++)
+    {
+        const std::size_t sparse_index = sparse(engine);
+        left.set(sparse_index);
+        left_reference.insert(sparse_index);
+    }
+    for (std::size_t i = 0; i < 10'000; i++)
+    {
+        // Dense in the first chunk, so it becomes a bitmap
+        const std::size_t dense_index = dense(engine);
+        right.set(dense_index);
+        right_reference.insert(dense_index);
+    }
+    for (std::size_t i = 200'000; i < 210'000; i++)
+    {
+        right.set(i);
+        right_reference.insert(i);
+    }
+    right.run_optimize();
+
+    {
+        BitsetType var1 = left;
+        var1 |= right;
+        std::set<std::size_t> expected{};
+        std::ranges::set_union(
+            left_reference, right_reference, std::inserter(expected, expected.begin()));
+        expect_same(expected, var1);
+    }
+    {
+        BitsetType var1 = left;
+        var1 &= right;
+        std::set<std::size_t> expected{};
+        std::ranges::set_intersection(
+            left_reference, right_reference, std::inserter(expected, expected.begin()));
+        expect_same(expected, var1);
+
+        BitsetType var2 = right;
+        var2 &= left;
+        EXPECT_EQ(var1, var2);
+    }
+    {
+        BitsetType var1 = left;
+        var1.and_not(right);
+        std::set<std::size_t> expected{};
+        std::ranges::set_difference(
+            left_reference, right_reference, std::inserter(expected, expected.begin()));
+        expect_same(expected, var1);
+    }
+    {
+        BitsetType var1 = right;
+        var1.and_not(left);
+        std::set<std::size_t> expected{};
+        std::ranges::set_difference(
+            right_reference, left_reference, std::inserter(expected, expected.begin()));
+        expect_same(expected, var1);
+    }
+}
+
+TEST(FixedCompressedBitset, Reset)
+{
+    FixedCompressedBitset<100'000, 8, 1> var1{};
+    var1.set(3);
+    var1.set(99'999);
+    var1.reset();
+    EXPECT_TRUE(var1.none());
+    EXPECT_EQ(0, var1.used_pool_values());
+    var1.set(4);
+    EXPECT_EQ(1, var1.count());
+}
+
+TEST(FixedCompressedBitset, OutOfBounds)
+{
+    FixedCompressedBitset<100, 8> var1{};
+    EXPECT_DEATH((void)var1.test(100), "");
+    EXPECT_DEATH(var1.set(100), "");
+}
+
+TEST(FixedCompressedBitset, PoolExhausted)
+{
+    FixedCompressedBitset<100'000, 2> var1{};
+    var1.set(1);
+    var1.set(70'000);
+    EXPECT_DEATH(var1.set(2), "");
+}
+
+}  // namespace fixed_containers
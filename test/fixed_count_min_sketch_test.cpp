@@ -0,0 +1,129 @@
+#include "fixed_containers/fixed_count_min_sketch.hpp"
+
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string_view>
+#include <type_traits>
+
+namespace fixed_containers
+{
+namespace
+{
+using SketchType = FixedCountMinSketch<std::uint64_t, 256, 4>;
+static_assert(std::is_trivially_copyable_v<SketchType>);
+static_assert(IsStructuralType<SketchType>);
+// The default hasher is stateless and takes no space
+static_assert(sizeof(SketchType) == (256 * 4 * sizeof(std::uint32_t)) + sizeof(std::uint64_t));
+}  // namespace
+
+TEST(FixedCountMinSketch, DefaultConstructor)
+{
+    constexpr SketchType VAL1{};
+    static_assert(VAL1.total_count() == 0);
+    static_assert(VAL1.estimate(5) == 0);
+}
+
+TEST(FixedCountMinSketch, Add)
+{
+    constexpr SketchType VAL1 = []()
+    {
+        SketchType var{};
+        var.add(1);
+        var.add(1);
+        var.add(2, 5);
+        return var;
+    }();
+
+    static_assert(VAL1.total_count() == 7);
+    static_assert(VAL1.estimate(1) >= 2);
+    static_assert(VAL1.estimate(2) >= 5);
+
+    SketchType var1{};
+    EXPECT_EQ(1, var1.add(9));
+    EXPECT_EQ(4, var1.add(9, 3));
+}
+
+TEST(FixedCountMinSketch, NeverUnderCounts)
+{
+    FixedCountMinSketch<std::uint64_t, 512, 5> var1{};
+    std::map<std::uint64_t, std::uint32_t> reference{};
+
+    std::mt19937_64 engine{3};  // NOLINT(cert-msc32-c,cert-msc51-cpp)
+    std::geometric_distribution<std::uint64_t> distribution{0.01};
+    static constexpr std::size_t STREAM_LENGTH = 20'000;
+    for (std::size_t i = 0; i < STREAM_LENGTH; i++)
+    {
+        const std::uint64_t key = distribution(engine);
+        var1.add(key);
+        reference[key]++;
+    }
+
+    EXPECT_EQ(STREAM_LENGTH, var1.total_count());
+    const double bound = var1.error_factor() * static_cast<double>(var1.total_count());
+    std::size_t over_bound = 0;
+    for (const auto& [key, count] : reference)
+    {
+        ASSERT_GE(var1.estimate(key), count);
+        over_bound += static_cast<double>(var1.estimate(key) - count) > bound ? 1 : 0;
+    }
+    EXPECT_LE(over_bound, reference.size() / 20);
+}
+
+TEST(FixedCountMinSketch, HeavyHitters)
+{
+    FixedCountMinSketch<std::string_view, 128, 4> var1{};
+    for (std::size_t i = 0; i < 1'000; i++)
+    {
+        var1.add("heavy");
+        if (i % 10 == 0)
+        {
+            var1.add("light");
+        }
+    }
+    EXPECT_GE(var1.estimate("heavy"), 1'000);
+    EXPECT_LT(var1.estimate("light"), 200);
+    EXPECT_LT(var1.estimate("absent"), 100);
+}
+
+TEST(FixedCountMinSketch, Saturates)
+{
+    FixedCountMinSketch<std::uint64_t, 16, 2, std::uint8_t> var1{};
+    var1.add(1, 200);
+    EXPECT_EQ(255, var1.add(1, 100));
+    EXPECT_EQ(255, var1.estimate(1));
+    EXPECT_EQ(300, var1.total_count());
+}
+
+TEST(FixedCountMinSketch, Merge)
+{
+    constexpr SketchType VAL1 = []()
+    {
+        SketchType var{};
+        var.add(1, 3);
+        SketchType other{};
+        other.add(1, 4);
+        other.add(2);
+        var += other;
+        return var;
+    }();
+    static_assert(VAL1.estimate(1) >= 7);
+    static_assert(VAL1.estimate(2) >= 1);
+    static_assert(VAL1.total_count() == 8);
+}
+
+TEST(FixedCountMinSketch, Clear)
+{
+    SketchType var1{};
+    var1.add(4, 10);
+    var1.clear();
+    EXPECT_EQ(0, var1.estimate(4));
+    EXPECT_EQ(0, var1.total_count());
+}
+
+}  // namespace fixed_containers
@@ -2079,6 +2079,39 @@ TEST(FixedDeque, NonTriviallyCopyableMoveAssignment)
     EXPECT_TRUE(std::ranges::equal(var2, std::array<MockNonTrivialInt, 2>{1, 2}));
 }
 
+TEST(FixedDeque, BulkPushBackAndPopFront)
+{
+    auto run_test = []<IsFixedDequeFactory Factory>(Factory&&)
+    {
+        constexpr auto VAL1 = []()
+        {
+            auto var = Factory::template create<int, 5>({1, 2});
+            constexpr std::array<int, 3> ENTRIES{3, 4, 5};
+            var.push_back_n(ENTRIES);
+            var.pop_front_n(2);
+            return var;
+        }();
+
+        static_assert(std::ranges::equal(VAL1, std::array<int, 3>{3, 4, 5}));
+
+        auto var2 = Factory::template create<int, 5>({1, 2, 3});
+        const std::array<int, 2> entries{4, 5};
+        var2.push_back_n(entries);
+        EXPECT_TRUE(std::ranges::equal(var2, std::array<int, 5>{1, 2, 3, 4, 5}));
+        const auto spans = var2.as_spans();
+        EXPECT_EQ(5, spans[0].size() + spans[1].size());
+
+        EXPECT_DEATH(var2.push_back_n(entries), "");
+        EXPECT_DEATH(var2.pop_front_n(6), "");
+
+        var2.pop_front_n(4);
+        EXPECT_TRUE(std::ranges::equal(var2.linearize(), std::array<int, 1>{5}));
+    };
+
+    run_test(FixedDequeInitialStateFirstIndex{});
+    run_test(FixedDequeInitialStateLastIndex{});
+}
+
 TEST(FixedDeque, OverloadedAddressOfOperator)
 {
     {
@@ -14,6 +14,7 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <functional>
 #include <iterator>
 #include <list>
 #include <ranges>
@@ -1550,6 +1551,176 @@ TEST(FixedList, RemoveIfInvalidation)
     EXPECT_EQ(address_5, &*it5);
 }
 
+TEST(FixedList, Unique)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedList<int, 10> var{1, 1, 2, 3, 3, 3, 1, 4, 4};
+        const std::size_t removed_count = var.unique();
+        assert_or_abort(4 == removed_count);
+        return var;
+    }();
+
+    static_assert(std::ranges::equal(VAL1, std::array<int, 5>{1, 2, 3, 1, 4}));
+
+    FixedList<int, 10> var2{1, 2, 4, 5, 7, 10};
+    // Compares against the last retained element, like std::list
+    EXPECT_EQ(2, var2.unique([](int lhs, int rhs) { return rhs - lhs <= 2; }));
+    EXPECT_TRUE(std::ranges::equal(var2, std::array<int, 4>{1, 4, 7, 10}));
+
+    FixedList<int, 10> var3{};
+    EXPECT_EQ(0, var3.unique());
+}
+
+TEST(FixedList, Reverse)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedList<int, 8> var{0, 1, 2, 3, 4};
+        var.reverse();
+        return var;
+    }();
+
+    static_assert(std::ranges::equal(VAL1, std::array<int, 5>{4, 3, 2, 1, 0}));
+    static_assert(VAL1.back() == 0);
+    static_assert(std::ranges::equal(VAL1 | std::views::reverse, std::array<int, 5>{0, 1, 2, 3, 4}));
+
+    FixedList<int, 8> var2{};
+    var2.reverse();
+    EXPECT_TRUE(var2.empty());
+    var2.push_back(1);
+    var2.reverse();
+    var2.push_back(2);
+    EXPECT_TRUE(std::ranges::equal(var2, std::array<int, 2>{1, 2}));
+}
+
+TEST(FixedList, Sort)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedList<int, 16> var{5, 3, 9, 1, 7, 2, 8, 6, 4, 0};
+        var.sort();
+        return var;
+    }();
+
+    static_assert(std::ranges::equal(VAL1, std::array<int, 10>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+    static_assert(VAL1.front() == 0);
+    static_assert(VAL1.back() == 9);
+
+    constexpr auto VAL2 = []()
+    {
+        FixedList<int, 16> var{5, 3, 9, 1, 7};
+        var.sort(std::greater<>{});
+        return var;
+    }();
+
+    static_assert(std::ranges::equal(VAL2, std::array<int, 5>{9, 7, 5, 3, 1}));
+}
+
+TEST(FixedList, SortIsStableAndDoesNotMoveValues)
+{
+    using Entry = std::pair<int, int>;
+    FixedList<Entry, 64> var1{};
+    std::list<Entry> reference{};
+    for (int i = 0; i < 50; i++)
+    {
+        const Entry entry{(i * 7) % 5, i};
+        var1.push_back(entry);
+        reference.push_back(entry);
+    }
+
+    std::array<const Entry*, 50> addresses{};
+    std::ranges::transform(var1, addresses.begin(), [](const Entry& entry) { return &entry; });
+
+    const auto by_first = [](const Entry& lhs, const Entry& rhs) { return lhs.first < rhs.first; };
+    var1.sort(by_first);
+    reference.sort(by_first);
+    EXPECT_TRUE(std::ranges::equal(var1, reference));
+    EXPECT_TRUE(std::ranges::equal(var1 | std::views::reverse, reference | std::views::reverse));
+
+    // Every value is still at the address it was constructed at
+    for (const Entry& entry : var1)
+    {
+        EXPECT_EQ(addresses.at(static_cast<std::size_t>(entry.second)), &entry);
+    }
+}
+
+TEST(FixedList, Merge)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedList<int, 10> var{1, 3, 5, 7};
+        FixedList<int, 10> other{0, 3, 4, 8, 9};
+        var.merge(other);
+        assert_or_abort(other.empty());
+        return var;
+    }();
+
+    static_assert(std::ranges::equal(VAL1, std::array<int, 9>{0, 1, 3, 3, 4, 5, 7, 8, 9}));
+
+    constexpr auto VAL2 = []()
+    {
+        FixedList<int, 10> var{7, 5, 1};
+        var.merge(FixedList<int, 10>{8, 6, 2}, std::greater<>{});
+        return var;
+    }();
+
+    static_assert(std::ranges::equal(VAL2, std::array<int, 6>{8, 7, 6, 5, 2, 1}));
+
+    FixedList<int, 4> var3{1, 2, 3};
+    var3.merge(var3);
+    EXPECT_EQ(3, var3.size());
+    FixedList<int, 4> var4{1, 2};
+    EXPECT_DEATH(var3.merge(var4), "");
+}
+
+TEST(FixedList, SpliceWithinList)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedList<int, 8> var{0, 1, 2, 3, 4, 5};
+        // Move {3, 4} to the front
+        var.splice(var.begin(), var, std::next(var.begin(), 3), std::next(var.begin(), 5));
+        // Move the last element after the first
+        var.splice(std::next(var.begin()), var, std::prev(var.end()));
+        // No-ops
+        var.splice(var.begin(), var, var.begin());
+        var.splice(std::next(var.begin()), var, var.begin());
+        return var;
+    }();
+
+    static_assert(std::ranges::equal(VAL1, std::array<int, 6>{3, 5, 4, 0, 1, 2}));
+    static_assert(std::ranges::equal(VAL1 | std::views::reverse,
+                                     std::array<int, 6>{2, 1, 0, 4, 5, 3}));
+
+    FixedList<int, 8> var2{10, 20, 30};
+    const int* address = &*std::next(var2.begin());
+    var2.splice(var2.end(), var2, std::next(var2.begin()));
+    EXPECT_TRUE(std::ranges::equal(var2, std::array<int, 3>{10, 30, 20}));
+    EXPECT_EQ(address, &var2.back());
+}
+
+TEST(FixedList, SpliceFromOtherList)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedList<int, 8> var{0, 1, 2};
+        FixedList<int, 8> other{10, 11, 12, 13};
+        var.splice(std::next(var.begin()), other, std::next(other.begin()), other.end());
+        assert_or_abort(other.size() == 1);
+        var.splice(var.end(), other, other.begin());
+        assert_or_abort(other.empty());
+        var.splice(var.begin(), FixedList<int, 8>{-1});
+        return var;
+    }();
+
+    static_assert(std::ranges::equal(VAL1, std::array<int, 8>{-1, 0, 11, 12, 13, 1, 2, 10}));
+
+    FixedList<int, 4> var2{1, 2, 3};
+    FixedList<int, 4> var3{4, 5};
+    EXPECT_DEATH(var2.splice(var2.end(), var3), "");
+}
+
 TEST(FixedList, EraseRange)
 {
     constexpr auto VAL1 = []()
@@ -0,0 +1,354 @@
+#include "fixed_containers/fixed_lru_cache.hpp"
+
+#include "instance_counter.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/max_size.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <optional>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace fixed_containers
+{
+namespace
+{
+using LruCacheType = FixedLruCache<int, int, 5>;
+static_assert(TriviallyCopyable<LruCacheType>);
+static_assert(IsStructuralType<LruCacheType>);
+static_assert(ConstexprDefaultConstructible<LruCacheType>);
+
+using ClockCacheType = FixedClockCache<int, int, 5>;
+static_assert(TriviallyCopyable<ClockCacheType>);
+static_assert(IsStructuralType<ClockCacheType>);
+static_assert(ConstexprDefaultConstructible<ClockCacheType>);
+
+// Straightforward map + list implementation, used as a reference.
+class ReferenceLruCache
+{
+    std::size_t capacity_;
+    std::list<std::pair<int, int>> entries_{};
+    std::unordered_map<int, std::list<std::pair<int, int>>::iterator> index_{};
+
+public:
+    explicit ReferenceLruCache(std::size_t capacity)
+      : capacity_{capacity}
+    {
+    }
+
+    std::optional<int> get(int key)
+    {
+        auto it = index_.find(key);
+        if (it == index_.end())
+        {
+            return std::nullopt;
+        }
+        entries_.splice(entries_.end(), entries_, it->second);
+        return it->second->second;
+    }
+
+    void put(int key, int value)
+    {
+        auto it = index_.find(key);
+        if (it != index_.end())
+        {
+            it->second->second = value;
+            entries_.splice(entries_.end(), entries_, it->second);
+            return;
+        }
+        if (entries_.size() == capacity_)
+        {
+            index_.erase(entries_.front().first);
+            entries_.pop_front();
+        }
+        entries_.emplace_back(key, value);
+        index_[key] = std::prev(entries_.end());
+    }
+};
+}  // namespace
+
+TEST(FixedLruCache, DefaultConstructor)
+{
+    constexpr FixedLruCache<int, int, 8> VAL1{};
+    static_assert(VAL1.empty());
+    static_assert(VAL1.size() == 0);
+}
+
+TEST(FixedLruCache, MaxSize)
+{
+    static_assert(FixedLruCache<int, int, 3>::static_max_size() == 3);
+    EXPECT_EQ(3, (FixedLruCache<int, int, 3>::static_max_size()));
+    static_assert(max_size_v<FixedLruCache<int, int, 3>> == 3);
+    EXPECT_EQ(3, (max_size_v<FixedLruCache<int, int, 3>>));
+}
+
+TEST(FixedLruCache, PutAndGet)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedLruCache<int, int, 3> var{};
+        var.put(1, 10);
+        var.put(2, 20);
+        const int value = 30;
+        var.put(3, value);
+        var.put(2, 22);
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 3);
+    static_assert(is_full(VAL1));
+    static_assert(VAL1.contains(1));
+    static_assert(*VAL1.peek(2) == 22);
+    static_assert(!VAL1.peek(4).has_value());
+
+    FixedLruCache<int, int, 3> var2 = VAL1;
+    EXPECT_EQ(10, var2.get(1).value());
+    EXPECT_FALSE(var2.get(4).has_value());
+    var2.at(3) = 33;
+    EXPECT_EQ(33, *var2.peek(3));
+    EXPECT_DEATH((void)var2.at(4), "");
+}
+
+TEST(FixedLruCache, EvictsLeastRecentlyUsed)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedLruCache<int, int, 3> var{};
+        var.put(1, 10);
+        var.put(2, 20);
+        var.put(3, 30);
+        // 1 becomes the most recently used, so 2 is evicted next
+        (void)var.get(1);
+        var.put(4, 40);
+        // Overwriting counts as a use, so 3 is evicted next
+        var.put(3, 33);
+        var.put(5, 50);
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 3);
+    static_assert(!VAL1.contains(2));
+    static_assert(!VAL1.contains(1));
+    static_assert(*VAL1.peek(3) == 33);
+    static_assert(*VAL1.peek(4) == 40);
+    static_assert(*VAL1.peek(5) == 50);
+}
+
+TEST(FixedLruCache, EvictionDoesNotRehash)
+{
+    // Few distinct hashes, so that entries are displaced from their home buckets
+    struct CollidingHash
+    {
+        std::size_t* call_count;
+        std::uint64_t operator()(const int key) const
+        {
+            ++*call_count;
+            return static_cast<std::uint64_t>(key % 3) << 8U;
+        }
+    };
+
+    std::size_t call_count = 0;
+    FixedLruCache<int, int, 4, CollidingHash> var1{CollidingHash{&call_count}};
+    for (int i = 0; i < 20; i++)
+    {
+        var1.put(i, i * 10);
+    }
+    EXPECT_EQ(20, call_count);
+
+    EXPECT_EQ(4, var1.size());
+    for (int i = 0; i < 16; i++)
+    {
+        EXPECT_FALSE(var1.contains(i));
+    }
+    for (int i = 16; i < 20; i++)
+    {
+        EXPECT_EQ(i * 10, *var1.peek(i));
+    }
+}
+
+TEST(FixedLruCache, PeekDoesNotTouch)
+{
+    FixedLruCache<int, int, 2> var1{};
+    var1.put(1, 10);
+    var1.put(2, 20);
+    EXPECT_EQ(10, *var1.peek(1));
+    var1.put(3, 30);
+    EXPECT_FALSE(var1.contains(1));
+    EXPECT_TRUE(var1.contains(2));
+}
+
+TEST(FixedLruCache, EraseAndClear)
+{
+    FixedLruCache<int, int, 3> var1{};
+    var1.put(1, 10);
+    var1.put(2, 20);
+    EXPECT_TRUE(var1.erase(1));
+    EXPECT_FALSE(var1.erase(1));
+    EXPECT_EQ(1, var1.size());
+    var1.put(3, 30);
+    var1.put(4, 40);
+    var1.put(5, 50);
+    EXPECT_FALSE(var1.contains(2));
+    var1.clear();
+    EXPECT_TRUE(var1.empty());
+}
+
+TEST(FixedLruCache, MatchesReference)
+{
+    std::mt19937 generator{3};
+    std::uniform_int_distribution<int> distribution{0, 40};
+
+    FixedLruCache<int, int, 16> var1{};
+    ReferenceLruCache reference{16};
+    for (int i = 0; i < 10000; i++)
+    {
+        const int key = distribution(generator);
+        if (distribution(generator) % 2 == 0)
+        {
+            var1.put(key, i);
+            reference.put(key, i);
+        }
+        else
+        {
+            const auto actual = var1.get(key);
+            const auto expected = reference.get(key);
+            ASSERT_EQ(expected.has_value(), actual.has_value());
+            if (expected.has_value())
+            {
+                ASSERT_EQ(*expected, *actual);
+            }
+        }
+    }
+}
+
+TEST(FixedLruCache, NonTrivialValue)
+{
+    FixedLruCache<int, std::string, 2> var1{};
+    var1.put(1, "one");
+    var1.put(2, std::string{"two"});
+    var1.put(3, "three");
+    EXPECT_FALSE(var1.contains(1));
+    EXPECT_EQ("three", *var1.get(3));
+}
+
+namespace
+{
+struct FixedLruCacheInstanceCounterUniquenessToken
+{
+};
+
+using InstanceCounterNonTrivialAssignment = instance_counter::InstanceCounterNonTrivialAssignment<
+    FixedLruCacheInstanceCounterUniquenessToken>;
+}  // namespace
+
+TEST(FixedLruCache, InstanceCheck)
+{
+    using InstanceCounterType = InstanceCounterNonTrivialAssignment;
+    ASSERT_EQ(0, InstanceCounterType::counter);
+    {
+        FixedLruCache<int, InstanceCounterType, 2> var1{};
+        var1.put(1, InstanceCounterType{});
+        var1.put(2, InstanceCounterType{});
+        ASSERT_EQ(2, InstanceCounterType::counter);
+        // Evicts 1
+        var1.put(3, InstanceCounterType{});
+        ASSERT_EQ(2, InstanceCounterType::counter);
+        var1.erase(2);
+        ASSERT_EQ(1, InstanceCounterType::counter);
+    }
+    ASSERT_EQ(0, InstanceCounterType::counter);
+}
+
+TEST(FixedClockCache, PutAndGet)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedClockCache<int, int, 3> var{};
+        var.put(1, 10);
+        var.put(2, 20);
+        var.put(3, 30);
+        var.put(2, 22);
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 3);
+    static_assert(is_full(VAL1));
+    static_assert(*VAL1.peek(2) == 22);
+
+    FixedClockCache<int, int, 3> var2 = VAL1;
+    EXPECT_EQ(10, var2.get(1).value());
+    EXPECT_FALSE(var2.get(4).has_value());
+    EXPECT_DEATH((void)var2.at(4), "");
+}
+
+TEST(FixedClockCache, SecondChance)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedClockCache<int, int, 3> var{};
+        var.put(1, 10);
+        var.put(2, 20);
+        var.put(3, 30);
+        // 1 is referenced, so it gets a second chance and 2 is evicted instead
+        (void)var.get(1);
+        var.put(4, 40);
+        return var;
+    }();
+
+    static_assert(VAL1.contains(1));
+    static_assert(!VAL1.contains(2));
+    static_assert(VAL1.contains(3));
+    static_assert(VAL1.contains(4));
+
+    constexpr auto VAL2 = []()
+    {
+        FixedClockCache<int, int, 3> var{};
+        var.put(1, 10);
+        var.put(2, 20);
+        var.put(3, 30);
+        // Everything is referenced: a full sweep clears all bits, then 1 is evicted
+        (void)var.get(1);
+        (void)var.get(2);
+        (void)var.get(3);
+        var.put(4, 40);
+        return var;
+    }();
+
+    static_assert(!VAL2.contains(1));
+    static_assert(VAL2.contains(2));
+    static_assert(VAL2.contains(3));
+    static_assert(VAL2.contains(4));
+}
+
+TEST(FixedClockCache, StaysWithinCapacity)
+{
+    std::mt19937 generator{11};
+    std::uniform_int_distribution<int> distribution{0, 40};
+
+    FixedClockCache<int, int, 16> var1{};
+    for (int i = 0; i < 10000; i++)
+    {
+        const int key = distribution(generator);
+        if (distribution(generator) % 2 == 0)
+        {
+            var1.put(key, i);
+            ASSERT_EQ(i, *var1.peek(key));
+        }
+        else if (auto value = var1.get(key); value.has_value())
+        {
+            ASSERT_GE(i, *value);
+        }
+        ASSERT_LE(var1.size(), 16);
+    }
+}
+
+}  // namespace fixed_containers
@@ -1728,6 +1728,35 @@ TEST(FixedMap, UsageAsTemplateParameter)
     static_cast<void>(my_struct);
 }
 
+TEST(FixedMap, NoChecking)
+{
+    using MapType = FixedMap<int,
+                             int,
+                             5,
+                             std::less<int>,
+                             fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::
+                                 EMBEDDED_COLOR,
+                             FixedIndexBasedPoolStorage,
+                             customize::MapNoChecking<int, int, 5>>;
+    static_assert(customize::MapChecking<customize::MapNoChecking<int, int, 5>, int>);
+
+    constexpr MapType VAL1 = []()
+    {
+        MapType var{};
+        var.try_emplace(1, 10);
+        var[2] = 20;
+        var.at(1) = 11;
+        return var;
+    }();
+    static_assert(VAL1.size() == 2);
+    static_assert(VAL1.at(1) == 11);
+
+    MapType var1{{1, 10}, {2, 20}};
+    var1.insert({3, 30});
+    EXPECT_EQ(30, var1.at(3));
+    EXPECT_EQ(3, var1.size());
+}
+
 namespace
 {
 struct FixedMapInstanceCounterUniquenessToken
@@ -0,0 +1,86 @@
+#include "fixed_containers/fixed_mpmc_queue.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <thread>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t CAP = 1024;
+
+// Baseline for comparison: what users would otherwise write.
+template <typename T>
+class MutexQueue
+{
+    std::mutex mutex_{};
+    std::queue<T> queue_{};
+
+public:
+    bool try_push(const T& value)
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        if (queue_.size() >= CAP)
+        {
+            return false;
+        }
+        queue_.push(value);
+        return true;
+    }
+
+    std::optional<T> try_pop()
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        if (queue_.empty())
+        {
+            return std::nullopt;
+        }
+        std::optional<T> out{queue_.front()};
+        queue_.pop();
+        return out;
+    }
+};
+
+// Every thread is both a producer and a consumer, so the number of in-flight entries is bounded
+// by the thread count and the queue never deadlocks, regardless of scheduling.
+template <typename QueueType>
+void benchmark_push_pop_throughput(benchmark::State& state)
+{
+    static QueueType instance{};
+    auto value = static_cast<std::uint64_t>(state.thread_index());
+
+    for (auto _ : state)
+    {
+        while (!instance.try_push(value))
+        {
+            std::this_thread::yield();
+        }
+        std::optional<std::uint64_t> popped = instance.try_pop();
+        while (!popped.has_value())
+        {
+            std::this_thread::yield();
+            popped = instance.try_pop();
+        }
+        value = *popped;
+        benchmark::DoNotOptimize(value);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(benchmark_push_pop_throughput<FixedMpmcQueue<std::uint64_t, CAP>>)
+    ->ThreadRange(1, 32)
+    ->UseRealTime();
+BENCHMARK(benchmark_push_pop_throughput<MutexQueue<std::uint64_t>>)
+    ->ThreadRange(1, 32)
+    ->UseRealTime();
+}  // namespace
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
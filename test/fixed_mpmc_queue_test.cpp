@@ -0,0 +1,235 @@
+#include "fixed_containers/fixed_mpmc_queue.hpp"
+
+#include "instance_counter.hpp"
+#include "mock_testing_types.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/max_size.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using QueueType = FixedMpmcQueue<int, 5>;
+static_assert(!std::is_copy_constructible_v<QueueType>);
+static_assert(!std::is_move_constructible_v<QueueType>);
+static_assert(std::is_nothrow_default_constructible_v<QueueType>);
+}  // namespace
+
+TEST(FixedMpmcQueue, DefaultConstructor)
+{
+    const FixedMpmcQueue<int, 8> var1{};
+    EXPECT_TRUE(var1.empty());
+    EXPECT_EQ(0, var1.size());
+}
+
+TEST(FixedMpmcQueue, MaxSize)
+{
+    {
+        const FixedMpmcQueue<int, 3> var1{};
+        EXPECT_EQ(3, var1.max_size());
+    }
+
+    {
+        static_assert(FixedMpmcQueue<int, 3>::static_max_size() == 3);
+        EXPECT_EQ(3, (FixedMpmcQueue<int, 3>::static_max_size()));
+        static_assert(max_size_v<FixedMpmcQueue<int, 3>> == 3);
+        EXPECT_EQ(3, (max_size_v<FixedMpmcQueue<int, 3>>));
+    }
+}
+
+TEST(FixedMpmcQueue, TryPushAndTryPop)
+{
+    FixedMpmcQueue<int, 3> var1{};
+    EXPECT_TRUE(var1.try_push(77));
+    EXPECT_TRUE(var1.try_push(88));
+    EXPECT_TRUE(var1.try_push(99));
+    EXPECT_EQ(3, var1.size());
+    EXPECT_FALSE(var1.try_push(100));
+    EXPECT_EQ(3, var1.size());
+
+    EXPECT_EQ(77, var1.try_pop());
+    EXPECT_EQ(88, var1.try_pop());
+    EXPECT_EQ(99, var1.try_pop());
+    EXPECT_EQ(std::nullopt, var1.try_pop());
+    EXPECT_TRUE(var1.empty());
+}
+
+TEST(FixedMpmcQueue, TryEmplace)
+{
+    FixedMpmcQueue<std::pair<int, int>, 2> var1{};
+    EXPECT_TRUE(var1.try_emplace(1, 2));
+    EXPECT_TRUE(var1.try_emplace(3, 4));
+    EXPECT_FALSE(var1.try_emplace(5, 6));
+
+    EXPECT_EQ((std::pair<int, int>{1, 2}), var1.try_pop());
+    EXPECT_EQ((std::pair<int, int>{3, 4}), var1.try_pop());
+}
+
+TEST(FixedMpmcQueue, Wraparound)
+{
+    FixedMpmcQueue<int, 3> var1{};
+    for (int i = 0; i < 20; i++)
+    {
+        EXPECT_TRUE(var1.try_push(i));
+        EXPECT_TRUE(var1.try_push(i + 100));
+        EXPECT_EQ(2, var1.size());
+        EXPECT_EQ(i, var1.try_pop());
+        EXPECT_EQ(i + 100, var1.try_pop());
+        EXPECT_TRUE(var1.empty());
+    }
+}
+
+TEST(FixedMpmcQueue, PushAndPop)
+{
+    FixedMpmcQueue<int, 2> var1{};
+    var1.push(7);
+    const int value = 8;
+    var1.push(value);
+    EXPECT_DEATH(var1.push(9), "");
+    EXPECT_EQ(7, var1.pop());
+    EXPECT_EQ(8, var1.pop());
+    EXPECT_DEATH((void)var1.pop(), "");
+}
+
+TEST(FixedMpmcQueue, Emplace)
+{
+    FixedMpmcQueue<std::pair<int, int>, 2> var1{};
+    var1.emplace(1, 2);
+    var1.emplace(3, 4);
+    EXPECT_DEATH(var1.emplace(5, 6), "");
+    EXPECT_EQ((std::pair<int, int>{1, 2}), var1.pop());
+    EXPECT_EQ((std::pair<int, int>{3, 4}), var1.pop());
+}
+
+namespace
+{
+struct PotentiallyThrowingConstructor
+{
+    int value;
+
+    explicit PotentiallyThrowingConstructor(int value_in) noexcept(false)
+      : value{value_in}
+    {
+    }
+    PotentiallyThrowingConstructor(PotentiallyThrowingConstructor&&) noexcept = default;
+};
+static_assert(!std::is_nothrow_constructible_v<PotentiallyThrowingConstructor, int>);
+}  // namespace
+
+TEST(FixedMpmcQueue, PotentiallyThrowingConstructor)
+{
+    // Constructed before a cell is claimed, then moved in
+    FixedMpmcQueue<PotentiallyThrowingConstructor, 2> var1{};
+    EXPECT_TRUE(var1.try_emplace(1));
+    var1.emplace(2);
+    EXPECT_FALSE(var1.try_emplace(3));
+    EXPECT_EQ(2, var1.size());
+    EXPECT_EQ(1, var1.pop().value);
+    EXPECT_EQ(2, var1.pop().value);
+    EXPECT_TRUE(var1.empty());
+}
+
+TEST(FixedMpmcQueue, NonTriviallyCopyableValues)
+{
+    FixedMpmcQueue<MockNonTrivialCopyConstructible, 3> var1{};
+    var1.push(MockNonTrivialCopyConstructible{});
+    EXPECT_TRUE(var1.try_pop().has_value());
+    EXPECT_FALSE(var1.try_pop().has_value());
+}
+
+TEST(FixedMpmcQueue, ProducersAndConsumers)
+{
+    static constexpr std::size_t THREAD_COUNT = 4;
+    static constexpr std::int64_t VALUES_PER_PRODUCER = 10000;
+    FixedMpmcQueue<std::int64_t, 16> var1{};
+    std::atomic<std::int64_t> sum{0};
+    std::atomic<std::int64_t> consumed_count{0};
+
+    std::vector<std::thread> threads{};
+    for (std::size_t i = 0; i < THREAD_COUNT; i++)
+    {
+        threads.emplace_back(
+            [&var1]()
+            {
+                for (std::int64_t value = 1; value <= VALUES_PER_PRODUCER; value++)
+                {
+                    while (!var1.try_push(value))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        threads.emplace_back(
+            [&var1, &sum, &consumed_count]()
+            {
+                for (std::int64_t count = 0; count < VALUES_PER_PRODUCER; count++)
+                {
+                    std::optional<std::int64_t> value = var1.try_pop();
+                    while (!value.has_value())
+                    {
+                        std::this_thread::yield();
+                        value = var1.try_pop();
+                    }
+                    sum.fetch_add(*value, std::memory_order_relaxed);
+                    consumed_count.fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    static constexpr std::int64_t EXPECTED_SUM_PER_PRODUCER =
+        (VALUES_PER_PRODUCER * (VALUES_PER_PRODUCER + 1)) / 2;
+    EXPECT_EQ(EXPECTED_SUM_PER_PRODUCER * static_cast<std::int64_t>(THREAD_COUNT), sum.load());
+    EXPECT_EQ(VALUES_PER_PRODUCER * static_cast<std::int64_t>(THREAD_COUNT),
+              consumed_count.load());
+    EXPECT_TRUE(var1.empty());
+}
+
+namespace
+{
+struct FixedMpmcQueueInstanceCounterUniquenessToken
+{
+};
+
+using InstanceCounterNonTrivialAssignment = instance_counter::InstanceCounterNonTrivialAssignment<
+    FixedMpmcQueueInstanceCounterUniquenessToken>;
+}  // namespace
+
+TEST(FixedMpmcQueue, InstanceCheck)
+{
+    using InstanceCounterType = InstanceCounterNonTrivialAssignment;
+    ASSERT_EQ(0, InstanceCounterType::counter);
+    {
+        FixedMpmcQueue<InstanceCounterType, 5> var1{};
+        {
+            const InstanceCounterType entry_aa{};
+            ASSERT_EQ(1, InstanceCounterType::counter);
+            var1.push(entry_aa);
+            var1.push(entry_aa);
+            var1.push(entry_aa);
+            ASSERT_EQ(4, InstanceCounterType::counter);
+        }
+        ASSERT_EQ(3, InstanceCounterType::counter);
+        (void)var1.pop();
+        ASSERT_EQ(2, InstanceCounterType::counter);
+    }
+    // Remaining entries are destroyed along with the queue.
+    ASSERT_EQ(0, InstanceCounterType::counter);
+}
+
+}  // namespace fixed_containers
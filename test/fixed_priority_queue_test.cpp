@@ -0,0 +1,430 @@
+#include "fixed_containers/fixed_priority_queue.hpp"
+
+#include "instance_counter.hpp"
+#include "mock_testing_types.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/max_size.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using PriorityQueueType = FixedPriorityQueue<int, 5>;
+static_assert(TriviallyCopyable<PriorityQueueType>);
+static_assert(NotTrivial<PriorityQueueType>);
+static_assert(StandardLayout<PriorityQueueType>);
+static_assert(IsStructuralType<PriorityQueueType>);
+static_assert(ConstexprDefaultConstructible<PriorityQueueType>);
+
+using IndexedPriorityQueueType = FixedIndexedPriorityQueue<int, 5>;
+static_assert(TriviallyCopyable<IndexedPriorityQueueType>);
+static_assert(IsStructuralType<IndexedPriorityQueueType>);
+static_assert(ConstexprDefaultConstructible<IndexedPriorityQueueType>);
+
+template <typename PriorityQueue>
+constexpr FixedVector<int, 16> drain(PriorityQueue queue)
+{
+    FixedVector<int, 16> out{};
+    while (!queue.empty())
+    {
+        out.push_back(queue.top());
+        queue.pop();
+    }
+    return out;
+}
+}  // namespace
+
+TEST(FixedPriorityQueue, DefaultConstructor)
+{
+    constexpr FixedPriorityQueue<int, 8> VAL1{};
+    static_assert(VAL1.empty());
+    static_assert(VAL1.arity() == 4);
+}
+
+TEST(FixedPriorityQueue, MaxSize)
+{
+    {
+        constexpr FixedPriorityQueue<int, 3> VAL1{};
+        static_assert(VAL1.max_size() == 3);
+    }
+
+    {
+        static_assert(FixedPriorityQueue<int, 3>::static_max_size() == 3);
+        EXPECT_EQ(3, (FixedPriorityQueue<int, 3>::static_max_size()));
+        static_assert(max_size_v<FixedPriorityQueue<int, 3>> == 3);
+        EXPECT_EQ(3, (max_size_v<FixedPriorityQueue<int, 3>>));
+    }
+}
+
+TEST(FixedPriorityQueue, IteratorConstructor)
+{
+    static constexpr std::array<int, 7> ENTRY_A1{3, 9, 1, 7, 5, 8, 2};
+    constexpr FixedPriorityQueue<int, 10> VAL1{ENTRY_A1.begin(), ENTRY_A1.end()};
+    static_assert(VAL1.size() == 7);
+    static_assert(VAL1.top() == 9);
+    static_assert(drain(VAL1) == FixedVector<int, 16>{9, 8, 7, 5, 3, 2, 1});
+
+    constexpr FixedPriorityQueue<int, 10, std::greater<>> VAL2{ENTRY_A1.begin(), ENTRY_A1.end()};
+    static_assert(VAL2.top() == 1);
+    static_assert(drain(VAL2) == FixedVector<int, 16>{1, 2, 3, 5, 7, 8, 9});
+
+    EXPECT_DEATH((FixedPriorityQueue<int, 3>{ENTRY_A1.begin(), ENTRY_A1.end()}), "");
+}
+
+TEST(FixedPriorityQueue, InitializerConstructor)
+{
+    constexpr FixedPriorityQueue<int, 10, std::less<>, 2> VAL1{4, 1, 6};
+    static_assert(VAL1.top() == 6);
+    static_assert(drain(VAL1) == FixedVector<int, 16>{6, 4, 1});
+}
+
+TEST(FixedPriorityQueue, PushAndPop)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedPriorityQueue<int, 5> var{};
+        const int value = 3;
+        var.push(value);
+        var.push(7);
+        var.emplace(5);
+        var.push(1);
+        var.pop();
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 3);
+    static_assert(VAL1.top() == 5);
+
+    FixedPriorityQueue<int, 2> var2{};
+    var2.push(1);
+    var2.push(2);
+    EXPECT_DEATH(var2.push(3), "");
+    var2.pop();
+    var2.pop();
+    EXPECT_DEATH(var2.pop(), "");
+    EXPECT_DEATH((void)var2.top(), "");
+}
+
+TEST(FixedPriorityQueue, PushPop)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedPriorityQueue<int, 3> var{2, 4, 6};
+        FixedVector<int, 3> popped{};
+        // Larger than the top, so comes straight back
+        popped.push_back(var.push_pop(10));
+        popped.push_back(var.push_pop(5));
+        popped.push_back(var.push_pop(1));
+        return std::pair{var, popped};
+    }();
+
+    static_assert(VAL1.second == FixedVector<int, 3>{10, 6, 5});
+    static_assert(drain(VAL1.first) == FixedVector<int, 16>{4, 2, 1});
+
+    FixedPriorityQueue<int, 3> var2{};
+    EXPECT_EQ(7, var2.push_pop(7));
+    EXPECT_TRUE(var2.empty());
+}
+
+TEST(FixedPriorityQueue, ReplaceTop)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedPriorityQueue<int, 3> var{2, 4, 6};
+        FixedVector<int, 3> popped{};
+        // Unlike push_pop(), the top is popped even if the new value is larger.
+        popped.push_back(var.replace_top(10));
+        popped.push_back(var.replace_top(1));
+        return std::pair{var, popped};
+    }();
+
+    static_assert(VAL1.second == FixedVector<int, 3>{6, 10});
+    static_assert(drain(VAL1.first) == FixedVector<int, 16>{4, 2, 1});
+
+    FixedPriorityQueue<int, 3> var2{};
+    EXPECT_DEATH((void)var2.replace_top(1), "");
+}
+
+TEST(FixedPriorityQueue, MatchesStdPriorityQueue)
+{
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<int> distribution{0, 1000};
+
+    FixedPriorityQueue<int, 200, std::less<>, 2> binary{};
+    FixedPriorityQueue<int, 200, std::less<>, 4> quaternary{};
+    FixedPriorityQueue<int, 200, std::less<>, 8> octonary{};
+    std::priority_queue<int> reference{};
+
+    for (std::size_t i = 0; i < 5000; i++)
+    {
+        if (reference.size() < 200 && (reference.empty() || distribution(generator) % 3 != 0))
+        {
+            const int value = distribution(generator);
+            binary.push(value);
+            quaternary.push(value);
+            octonary.push(value);
+            reference.push(value);
+        }
+        else
+        {
+            binary.pop();
+            quaternary.pop();
+            octonary.pop();
+            reference.pop();
+        }
+
+        ASSERT_EQ(reference.size(), binary.size());
+        if (!reference.empty())
+        {
+            ASSERT_EQ(reference.top(), binary.top());
+            ASSERT_EQ(reference.top(), quaternary.top());
+            ASSERT_EQ(reference.top(), octonary.top());
+        }
+    }
+}
+
+TEST(FixedPriorityQueue, Clear)
+{
+    FixedPriorityQueue<int, 5> var1{1, 2, 3};
+    var1.clear();
+    EXPECT_TRUE(var1.empty());
+}
+
+TEST(FixedPriorityQueue, Full)
+{
+    constexpr FixedPriorityQueue<int, 3> VAL1{1, 2, 3};
+    static_assert(is_full(VAL1));
+    EXPECT_TRUE(is_full(VAL1));
+}
+
+namespace
+{
+struct MockNonTrivialIntLess
+{
+    constexpr bool operator()(const MockNonTrivialInt& left, const MockNonTrivialInt& right) const
+    {
+        return left.value < right.value;
+    }
+};
+}  // namespace
+
+TEST(FixedPriorityQueue, NonTriviallyCopyable)
+{
+    FixedPriorityQueue<MockNonTrivialInt, 5, MockNonTrivialIntLess> var1{};
+    var1.push(MockNonTrivialInt{3});
+    var1.push(MockNonTrivialInt{5});
+    var1.push(MockNonTrivialInt{1});
+    EXPECT_EQ(5, var1.top().value);
+    var1.pop();
+    EXPECT_EQ(3, var1.top().value);
+}
+
+namespace
+{
+template <FixedPriorityQueue<int, 5> /*MY_QUEUE*/>
+struct FixedPriorityQueueInstanceCanBeUsedAsATemplateParameter
+{
+};
+}  // namespace
+
+TEST(FixedPriorityQueue, UsageAsTemplateParameter)
+{
+    static constexpr FixedPriorityQueue<int, 5> QUEUE1{};
+    const FixedPriorityQueueInstanceCanBeUsedAsATemplateParameter<QUEUE1> my_struct{};
+    static_cast<void>(my_struct);
+}
+
+TEST(FixedIndexedPriorityQueue, PushAndPop)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedIndexedPriorityQueue<int, 5> var{};
+        var.push(3);
+        var.push(7);
+        var.emplace(5);
+        var.pop();
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 2);
+    static_assert(VAL1.top() == 5);
+    static_assert(VAL1.top_handle() == 2);
+    static_assert(drain(VAL1) == FixedVector<int, 16>{5, 3});
+
+    FixedIndexedPriorityQueue<int, 2> var2{};
+    var2.push(1);
+    var2.push(2);
+    EXPECT_DEATH(var2.push(3), "");
+    var2.pop();
+    var2.pop();
+    EXPECT_DEATH(var2.pop(), "");
+    EXPECT_DEATH((void)var2.top(), "");
+    EXPECT_DEATH((void)var2.top_handle(), "");
+}
+
+TEST(FixedIndexedPriorityQueue, Handles)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedIndexedPriorityQueue<int, 5, std::greater<>> var{};
+        const auto handle_a = var.push(30);
+        const auto handle_b = var.push(10);
+        const auto handle_c = var.push(20);
+        return std::array{var.at(handle_a), var.at(handle_b), var.at(handle_c)};
+    }();
+
+    static_assert(VAL1 == std::array{30, 10, 20});
+
+    FixedIndexedPriorityQueue<int, 5> var2{};
+    const auto handle = var2.push(1);
+    EXPECT_TRUE(var2.contains(handle));
+    var2.pop();
+    EXPECT_FALSE(var2.contains(handle));
+    EXPECT_FALSE(var2.contains(5));
+    EXPECT_DEATH((void)var2.at(handle), "");
+    EXPECT_DEATH(var2.erase(handle), "");
+    EXPECT_DEATH(var2.update(handle, 3), "");
+}
+
+TEST(FixedIndexedPriorityQueue, HandleReuse)
+{
+    FixedIndexedPriorityQueue<int, 3> var1{};
+    EXPECT_EQ(0, var1.push(1));
+    EXPECT_EQ(1, var1.push(2));
+    EXPECT_EQ(2, var1.push(3));
+    var1.erase(1);
+    EXPECT_EQ(1, var1.push(4));
+    EXPECT_EQ(4, var1.top());
+    EXPECT_EQ(1, var1.top_handle());
+}
+
+TEST(FixedIndexedPriorityQueue, Update)
+{
+    // Min-heap, like a timer queue
+    constexpr auto VAL1 = []()
+    {
+        FixedIndexedPriorityQueue<int, 8, std::greater<>> var{};
+        const auto handle_a = var.push(50);
+        var.push(40);
+        const auto handle_c = var.push(30);
+        var.push(20);
+        // Decrease-key
+        var.update(handle_a, 10);
+        // Increase-key
+        var.update(handle_c, 60);
+        return var;
+    }();
+
+    static_assert(VAL1.top() == 10);
+    static_assert(VAL1.top_handle() == 0);
+    static_assert(drain(VAL1) == FixedVector<int, 16>{10, 20, 40, 60});
+}
+
+TEST(FixedIndexedPriorityQueue, Erase)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedIndexedPriorityQueue<int, 8> var{};
+        var.push(1);
+        const auto handle_b = var.push(8);
+        var.push(3);
+        const auto handle_d = var.push(6);
+        var.push(5);
+        var.erase(handle_b);
+        var.erase(handle_d);
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 3);
+    static_assert(drain(VAL1) == FixedVector<int, 16>{5, 3, 1});
+}
+
+TEST(FixedIndexedPriorityQueue, MatchesStdPriorityQueue)
+{
+    std::mt19937 generator{7};
+    std::uniform_int_distribution<int> distribution{0, 1000};
+
+    FixedIndexedPriorityQueue<int, 100, std::greater<>, 4> var1{};
+    std::vector<std::size_t> live_handles{};
+
+    for (std::size_t i = 0; i < 5000; i++)
+    {
+        const int action = distribution(generator) % 4;
+        if (live_handles.empty() || (action == 0 && !is_full(var1)))
+        {
+            live_handles.push_back(var1.push(distribution(generator)));
+        }
+        else if (action == 1)
+        {
+            const std::size_t position = static_cast<std::size_t>(distribution(generator)) %
+                                         live_handles.size();
+            var1.update(live_handles[position], distribution(generator));
+        }
+        else if (action == 2)
+        {
+            const std::size_t position = static_cast<std::size_t>(distribution(generator)) %
+                                         live_handles.size();
+            var1.erase(live_handles[position]);
+            live_handles.erase(live_handles.begin() + static_cast<std::ptrdiff_t>(position));
+        }
+        else
+        {
+            const std::size_t handle = var1.top_handle();
+            var1.pop();
+            std::erase(live_handles, handle);
+        }
+
+        std::priority_queue<int, std::vector<int>, std::greater<>> reference{};
+        for (const std::size_t handle : live_handles)
+        {
+            reference.push(var1.at(handle));
+        }
+        ASSERT_EQ(reference.size(), var1.size());
+        if (!reference.empty())
+        {
+            ASSERT_EQ(reference.top(), var1.top());
+        }
+    }
+}
+
+namespace
+{
+struct FixedIndexedPriorityQueueInstanceCounterUniquenessToken
+{
+};
+
+using InstanceCounterNonTrivialAssignment = instance_counter::InstanceCounterNonTrivialAssignment<
+    FixedIndexedPriorityQueueInstanceCounterUniquenessToken>;
+}  // namespace
+
+TEST(FixedIndexedPriorityQueue, InstanceCheck)
+{
+    using InstanceCounterType = InstanceCounterNonTrivialAssignment;
+    ASSERT_EQ(0, InstanceCounterType::counter);
+    {
+        FixedIndexedPriorityQueue<InstanceCounterType, 5> var1{};
+        const auto handle = var1.push(InstanceCounterType{1});
+        var1.push(InstanceCounterType{2});
+        var1.push(InstanceCounterType{3});
+        ASSERT_EQ(3, InstanceCounterType::counter);
+        var1.erase(handle);
+        ASSERT_EQ(2, InstanceCounterType::counter);
+        var1.pop();
+        ASSERT_EQ(1, InstanceCounterType::counter);
+    }
+    ASSERT_EQ(0, InstanceCounterType::counter);
+}
+
+}  // namespace fixed_containers
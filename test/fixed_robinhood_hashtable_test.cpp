@@ -878,4 +878,25 @@ TEST(MapCornerCases, PerfectCollisions)
     EXPECT_EQ(idx.bucket_index, 6);
 }
 
+TEST(MapOperations, PrecomputedHash)
+{
+    IntIntMap10 map{};
+    const ConvenientIntHash hasher{};
+    for (const int key : {13, 33, 9, 43})
+    {
+        const OIT idx = map.opaque_index_of(key, hasher(key));
+        EXPECT_FALSE(map.exists(idx));
+        map.emplace(idx, key, key * 2);
+    }
+
+    for (const int key : {13, 33, 9, 43})
+    {
+        const OIT idx = map.opaque_index_of(key, hasher(key));
+        EXPECT_TRUE(map.exists(idx));
+        EXPECT_EQ(map.opaque_index_of(key).bucket_index, idx.bucket_index);
+        EXPECT_EQ(key * 2, map.value(idx));
+    }
+    EXPECT_FALSE(map.exists(map.opaque_index_of(23, hasher(23))));
+}
+
 }  // namespace fixed_containers::fixed_robinhood_hashtable_detail
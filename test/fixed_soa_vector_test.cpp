@@ -0,0 +1,284 @@
+#if defined(__clang__) && __clang_major__ >= 15
+
+#include "fixed_containers/fixed_soa_vector.hpp"
+
+#include "mock_testing_types.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/max_size.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+
+namespace fixed_containers
+{
+namespace
+{
+struct Particle
+{
+    int id;
+    double mass;
+    char tag;
+
+    constexpr bool operator==(const Particle& other) const = default;
+};
+
+using SoaType = FixedSoaVector<Particle, 5>;
+static_assert(TriviallyCopyable<SoaType>);
+static_assert(std::is_nothrow_default_constructible_v<SoaType>);
+static_assert(SoaType::field_count() == 3);
+static_assert(std::is_same_v<int, SoaType::field_type<0>>);
+static_assert(std::is_same_v<double, SoaType::field_type<1>>);
+static_assert(std::is_same_v<char, SoaType::field_type<2>>);
+
+static_assert(std::random_access_iterator<SoaType::iterator>);
+static_assert(std::random_access_iterator<SoaType::const_iterator>);
+
+struct SingleField
+{
+    std::int64_t value;
+};
+// One size for all the columns
+static_assert(sizeof(FixedSoaVector<SingleField, 5>) ==
+              sizeof(std::size_t) + (5 * sizeof(std::int64_t)));
+
+struct WithNonTrivialField
+{
+    int id;
+    MockNonTrivialInt payload;
+};
+using NonTrivialSoaType = FixedSoaVector<WithNonTrivialField, 5>;
+static_assert(!TriviallyCopyable<NonTrivialSoaType>);
+static_assert(!TriviallyDestructible<NonTrivialSoaType>);
+static_assert(std::is_nothrow_move_constructible_v<NonTrivialSoaType>);
+}  // namespace
+
+TEST(FixedSoaVector, DefaultConstructor)
+{
+    constexpr FixedSoaVector<Particle, 8> VAL1{};
+    static_assert(VAL1.empty());
+    static_assert(VAL1.size() == 0);
+}
+
+TEST(FixedSoaVector, MaxSize)
+{
+    {
+        constexpr FixedSoaVector<Particle, 3> VAL1{};
+        static_assert(VAL1.max_size() == 3);
+        static_assert(VAL1.capacity() == 3);
+    }
+
+    {
+        static_assert(FixedSoaVector<Particle, 3>::static_max_size() == 3);
+        EXPECT_EQ(3, (FixedSoaVector<Particle, 3>::static_max_size()));
+        static_assert(max_size_v<FixedSoaVector<Particle, 3>> == 3);
+        EXPECT_EQ(3, (max_size_v<FixedSoaVector<Particle, 3>>));
+    }
+}
+
+TEST(FixedSoaVector, InitializerConstructor)
+{
+    constexpr FixedSoaVector<Particle, 5> VAL1{{1, 2.0, 'a'}, {3, 4.0, 'b'}};
+    static_assert(VAL1.size() == 2);
+    static_assert(VAL1[0] == Particle{1, 2.0, 'a'});
+    static_assert(VAL1[1] == Particle{3, 4.0, 'b'});
+
+    EXPECT_DEATH((FixedSoaVector<Particle, 1>{{1, 2.0, 'a'}, {3, 4.0, 'b'}}), "");
+}
+
+TEST(FixedSoaVector, PushBackAndPopBack)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSoaVector<Particle, 5> var{};
+        var.push_back({1, 2.0, 'a'});
+        const Particle entry{3, 4.0, 'b'};
+        var.push_back(entry);
+        var.push_back({5, 6.0, 'c'});
+        var.pop_back();
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 2);
+    static_assert(VAL1.back() == Particle{3, 4.0, 'b'});
+
+    FixedSoaVector<Particle, 2> var2{};
+    var2.push_back({1, 2.0, 'a'});
+    var2.push_back({1, 2.0, 'a'});
+    EXPECT_DEATH(var2.push_back({1, 2.0, 'a'}), "");
+    var2.clear();
+    EXPECT_DEATH(var2.pop_back(), "");
+}
+
+TEST(FixedSoaVector, Columns)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSoaVector<Particle, 5> var{{1, 2.0, 'a'}, {3, 4.0, 'b'}, {5, 6.0, 'c'}};
+        for (double& mass : var.column<1>())
+        {
+            mass *= 2;
+        }
+        return var;
+    }();
+
+    static_assert(VAL1.column<0>().size() == 3);
+    static_assert(std::ranges::equal(VAL1.column<0>(), std::array{1, 3, 5}));
+    static_assert(std::ranges::equal(VAL1.column<1>(), std::array{4.0, 8.0, 12.0}));
+    static_assert(std::ranges::equal(VAL1.column<2>(), std::array{'a', 'b', 'c'}));
+
+    const auto mass_column = VAL1.column<1>();
+    EXPECT_EQ(24.0, std::accumulate(mass_column.begin(), mass_column.end(), 0.0));
+}
+
+TEST(FixedSoaVector, ElementAccess)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSoaVector<Particle, 5> var{{1, 2.0, 'a'}, {3, 4.0, 'b'}, {5, 6.0, 'c'}};
+        var[0] = Particle{7, 8.0, 'd'};
+        var.at(1).get<0>() = 30;
+        var.back() = var.front();
+        return var;
+    }();
+
+    static_assert(VAL1.front() == Particle{7, 8.0, 'd'});
+    static_assert(VAL1.at(1).get<0>() == 30);
+    static_assert(VAL1.at(1).get<2>() == 'b');
+    static_assert(VAL1[2] == Particle{7, 8.0, 'd'});
+
+    const Particle copy = VAL1[1];
+    EXPECT_EQ((Particle{30, 4.0, 'b'}), copy);
+
+    FixedSoaVector<Particle, 5> var2{{1, 2.0, 'a'}};
+    EXPECT_DEATH((void)var2.at(1), "");
+    EXPECT_DEATH((void)var2[3], "");
+    var2.clear();
+    EXPECT_DEATH((void)var2.front(), "");
+    EXPECT_DEATH((void)var2.back(), "");
+}
+
+TEST(FixedSoaVector, Iteration)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSoaVector<Particle, 5> var{{1, 2.0, 'a'}, {3, 4.0, 'b'}, {5, 6.0, 'c'}};
+        for (auto&& entry : var)
+        {
+            entry.get<0>() += 10;
+        }
+        return var;
+    }();
+
+    static_assert(std::ranges::equal(VAL1.column<0>(), std::array{11, 13, 15}));
+    static_assert(std::distance(VAL1.begin(), VAL1.end()) == 3);
+    static_assert(std::distance(VAL1.rbegin(), VAL1.rend()) == 3);
+    static_assert(VAL1.rbegin()->get<0>() == 15);
+
+    const auto it = std::find_if(VAL1.begin(),
+                                 VAL1.end(),
+                                 [](const auto& entry) { return entry.template get<2>() == 'b'; });
+    EXPECT_EQ(1, std::distance(VAL1.begin(), it));
+}
+
+TEST(FixedSoaVector, Resize)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSoaVector<Particle, 5> var{{1, 2.0, 'a'}};
+        var.resize(3);
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 3);
+    static_assert(VAL1[2] == Particle{});
+
+    FixedSoaVector<Particle, 5> var2{};
+    EXPECT_DEATH(var2.resize(6), "");
+}
+
+TEST(FixedSoaVector, Erase)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSoaVector<Particle, 5> var{{1, 2.0, 'a'}, {3, 4.0, 'b'}, {5, 6.0, 'c'}};
+        auto it = var.erase(std::next(var.cbegin()));
+        it->get<0>() = 50;
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 2);
+    static_assert(std::ranges::equal(VAL1.column<0>(), std::array{1, 50}));
+    static_assert(std::ranges::equal(VAL1.column<2>(), std::array{'a', 'c'}));
+
+    FixedSoaVector<Particle, 5> var2{{1, 2.0, 'a'}};
+    EXPECT_DEATH(var2.erase(var2.cend()), "");
+}
+
+TEST(FixedSoaVector, Equality)
+{
+    constexpr FixedSoaVector<Particle, 5> VAL1{{1, 2.0, 'a'}, {3, 4.0, 'b'}};
+    constexpr FixedSoaVector<Particle, 3> VAL2{{1, 2.0, 'a'}, {3, 4.0, 'b'}};
+    constexpr FixedSoaVector<Particle, 5> VAL3{{1, 2.0, 'a'}, {3, 4.0, 'c'}};
+    constexpr FixedSoaVector<Particle, 5> VAL4{{1, 2.0, 'a'}};
+
+    static_assert(VAL1 == VAL2);
+    static_assert(VAL1 != VAL3);
+    static_assert(VAL1 != VAL4);
+}
+
+TEST(FixedSoaVector, NonTriviallyCopyableFields)
+{
+    NonTrivialSoaType var1{{1, {10}}, {2, {20}}, {3, {30}}};
+    var1.erase(var1.cbegin());
+    var1.push_back({4, {40}});
+    EXPECT_TRUE(std::ranges::equal(var1.column<0>(), std::array{2, 3, 4}));
+
+    NonTrivialSoaType copy{var1};
+    copy.pop_back();
+    const NonTrivialSoaType moved{std::move(copy)};
+    EXPECT_EQ(2, moved.size());
+
+    NonTrivialSoaType assigned{};
+    assigned = moved;
+    assigned.resize(3);
+    EXPECT_TRUE(std::ranges::equal(assigned.column<0>(), std::array{2, 3, 0}));
+    EXPECT_EQ(30, assigned.column<1>()[1].value);
+    EXPECT_EQ(0, assigned.column<1>()[2].value);
+
+    assigned = std::move(var1);
+    EXPECT_TRUE(std::ranges::equal(assigned.column<0>(), std::array{2, 3, 4}));
+    EXPECT_EQ(40, assigned.back().get<1>().value);
+}
+
+TEST(FixedSoaVector, IsFull)
+{
+    constexpr FixedSoaVector<Particle, 2> VAL1{{1, 2.0, 'a'}, {3, 4.0, 'b'}};
+    static_assert(is_full(VAL1));
+    constexpr FixedSoaVector<Particle, 3> VAL2{{1, 2.0, 'a'}};
+    static_assert(!is_full(VAL2));
+}
+
+TEST(FixedSoaVector, ZeroCapacity)
+{
+    constexpr FixedSoaVector<Particle, 0> VAL1{};
+    static_assert(VAL1.empty());
+    static_assert(is_full(VAL1));
+    static_assert(VAL1.column<0>().empty());
+    static_assert(VAL1.column<2>().data() == nullptr);
+
+    FixedSoaVector<Particle, 0> var1{};
+    EXPECT_TRUE(var1.column<1>().empty());
+    EXPECT_EQ(var1.begin(), var1.end());
+}
+
+}  // namespace fixed_containers
+
+#endif
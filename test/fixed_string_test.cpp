@@ -5,18 +5,23 @@
 #include "fixed_containers/concepts.hpp"
 #include "fixed_containers/consteval_compare.hpp"
 #include "fixed_containers/max_size.hpp"
+#include "fixed_containers/wyhash.hpp"
 
 #include <gtest/gtest.h>
 
 #include <algorithm>
 #include <array>
+#include <charconv>
+#include <compare>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <span>
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <system_error>
 
 namespace fixed_containers
 {
@@ -2145,6 +2150,94 @@ TEST(FixedString, AppendTruncating)
     static_assert(VAL1 == "1234");
 }
 
+TEST(FixedString, AppendNumber)
+{
+    FixedString<32> str{"id="};
+    str.append_number(42).append(", ");
+    str.append_number(-7).append(", ");
+    str.append_number(255U, 16).append(", ");
+    str.append_number(0.5).append(", ");
+    str.append_number(3.14159, std::chars_format::fixed, 2);
+    EXPECT_EQ("id=42, -7, ff, 0.5, 3.14", str);
+}
+
+namespace
+{
+template <typename S, typename T>
+concept CanAppendNumber = requires(S str, T value) { str.append_number(value); };
+template <typename S, typename T>
+concept CanParseNumber = requires(const S& str, T& value) { from_chars(str, value); };
+}  // namespace
+
+TEST(FixedString, AppendNumberRejectsBool)
+{
+    static_assert(CanAppendNumber<FixedString<8>, int>);
+    static_assert(!CanAppendNumber<FixedString<8>, bool>);
+    static_assert(CanParseNumber<FixedString<8>, int>);
+    static_assert(!CanParseNumber<FixedString<8>, bool>);
+}
+
+TEST(FixedString, AppendNumberKeepsZeroPadding)
+{
+    ZeroPaddedFixedString<16> str{"value: "};
+    str.append_number(std::uint64_t{1234});
+    EXPECT_EQ("value: 1234", str);
+    EXPECT_EQ(ZeroPaddedFixedString<16>{"value: 1234"}, str);
+}
+
+TEST(FixedString, AppendNumberExceedsCapacity)
+{
+    FixedString<5> str{"abc"};
+    str.append_number(12);
+    EXPECT_EQ("abc12", str);
+    EXPECT_DEATH(str.append_number(1), "");
+
+    FixedString<5> str2{"abc"};
+    EXPECT_DEATH(str2.append_number(123), "");
+    EXPECT_DEATH(str2.append_number(1.25), "");
+}
+
+#if defined(__cpp_lib_format) && __cpp_lib_format >= 201907L
+TEST(FixedString, AppendFormat)
+{
+    FixedString<32> str{"["};
+    str.append_format("{}:{:>4}|{:.1f}", "key", 12, 2.25);
+    EXPECT_EQ("[key:  12|2.2", str);
+
+    FixedString<8> str2{"abc"};
+    EXPECT_DEATH(str2.append_format("{}", 123456), "");
+}
+#endif
+
+TEST(FixedString, FromChars)
+{
+    const FixedString<16> str{"-1234"};
+    int value = 0;
+    const std::from_chars_result result = from_chars(str, value);
+    EXPECT_EQ(std::errc{}, result.ec);
+    EXPECT_EQ(std::next(str.data(), 5), result.ptr);
+    EXPECT_EQ(-1234, value);
+
+    std::uint32_t hex_value = 0;
+    EXPECT_EQ(std::errc{}, from_chars(FixedString<8>{"ff"}, hex_value, 16).ec);
+    EXPECT_EQ(255, hex_value);
+
+    double double_value = 0.0;
+    EXPECT_EQ(std::errc{}, from_chars(ZeroPaddedFixedString<8>{"2.5"}, double_value).ec);
+    EXPECT_EQ(2.5, double_value);
+
+    // Like std::from_chars, stops at the first character that doesn't match
+    const FixedString<16> trailing{"12ab"};
+    value = 0;
+    const std::from_chars_result partial = from_chars(trailing, value);
+    EXPECT_EQ(12, value);
+    EXPECT_EQ(std::next(trailing.data(), 2), partial.ptr);
+
+    EXPECT_EQ(std::errc::invalid_argument, from_chars(FixedString<8>{"x"}, value).ec);
+    std::uint8_t small_value = 0;
+    EXPECT_EQ(std::errc::result_out_of_range, from_chars(FixedString<8>{"300"}, small_value).ec);
+}
+
 TEST(FixedString, MaxSizeDeduction)
 {
     constexpr auto VAL1 = make_fixed_string("abcde");
@@ -2246,6 +2339,99 @@ TEST(FixedString, OStreamOperator)
     EXPECT_EQ(stream.str(), "hello");
 }
 
+namespace
+{
+template <class StringType>
+bool padding_is_zeroed(const StringType& str)
+{
+    return std::all_of(std::next(str.data(), static_cast<std::ptrdiff_t>(str.length())),
+                       std::next(str.data(), static_cast<std::ptrdiff_t>(str.max_size() + 1)),
+                       [](const char character) { return character == '\0'; });
+}
+
+static_assert(TriviallyCopyable<ZeroPaddedFixedString<32>>);
+static_assert(IsStructuralType<ZeroPaddedFixedString<32>>);
+static_assert(ZeroPaddedFixedString<32>::padding() == FixedStringPadding::ZEROED);
+static_assert(FixedString<32>::padding() == FixedStringPadding::INDETERMINATE);
+}  // namespace
+
+TEST(FixedString, ZeroPaddedKeepsPaddingCleared)
+{
+    ZeroPaddedFixedString<32> str{"a fairly long string"};
+    EXPECT_TRUE(padding_is_zeroed(str));
+
+    str.pop_back();
+    EXPECT_TRUE(padding_is_zeroed(str));
+    str.erase(3, 5);
+    EXPECT_TRUE(padding_is_zeroed(str));
+    str.erase(std::next(str.cbegin(), 2));
+    EXPECT_TRUE(padding_is_zeroed(str));
+    str.resize(4);
+    EXPECT_TRUE(padding_is_zeroed(str));
+    str.assign("ab");
+    EXPECT_TRUE(padding_is_zeroed(str));
+    str.append("cdefgh");
+    str.assign(2, 'x');
+    EXPECT_TRUE(padding_is_zeroed(str));
+    str.append("cdefgh");
+    str.clear();
+    EXPECT_TRUE(padding_is_zeroed(str));
+    EXPECT_EQ("", str);
+
+    const ZeroPaddedFixedString<32> str2{6, 'y'};
+    EXPECT_TRUE(padding_is_zeroed(str2));
+}
+
+TEST(FixedString, ZeroPaddedComparison)
+{
+    static_assert(ZeroPaddedFixedString<8>{"abc"} == ZeroPaddedFixedString<8>{"abc"});
+    static_assert(ZeroPaddedFixedString<8>{"abc"} < ZeroPaddedFixedString<8>{"abd"});
+
+    ZeroPaddedFixedString<32> str1{"symbol_one"};
+    const ZeroPaddedFixedString<32> str2{"symbol_one"};
+    const ZeroPaddedFixedString<32> str3{"symbol_two"};
+    EXPECT_EQ(str1, str2);
+    EXPECT_NE(str1, str3);
+    EXPECT_LT(str1, str3);
+    EXPECT_GT(str3, str1);
+    EXPECT_EQ(std::strong_ordering::equal, str1 <=> str2);
+
+    // Shorter strings sort first, including against embedded null characters
+    str1.pop_back();
+    EXPECT_LT(str1, str2);
+    EXPECT_GT(str2, str1);
+    ZeroPaddedFixedString<32> with_trailing_null{"symbol_one"};
+    with_trailing_null.push_back('\0');
+    EXPECT_NE(str2, with_trailing_null);
+    EXPECT_LT(str2, with_trailing_null);
+
+    // Characters above 0x7F sort after ASCII, like std::string_view
+    const ZeroPaddedFixedString<32> high{"\xF0"};
+    EXPECT_LT(str2, high);
+    EXPECT_EQ(std::string_view{str2} <=> std::string_view{high}, str2 <=> high);
+
+    // Mixed padding modes and sizes fall back to the character-by-character comparison
+    EXPECT_EQ(str2, FixedString<32>{"symbol_one"});
+    EXPECT_EQ(str2, FixedString<16>{"symbol_one"});
+    EXPECT_LT(str2, FixedString<16>{"symbol_two"});
+}
+
+TEST(FixedString, ZeroPaddedHash)
+{
+    const wyhash::hash<ZeroPaddedFixedString<32>> hasher{};
+    ZeroPaddedFixedString<32> str1{"symbol"};
+    const ZeroPaddedFixedString<32> str2{"symbol"};
+    EXPECT_EQ(hasher(str1), hasher(str2));
+    EXPECT_NE(hasher(str1), hasher(ZeroPaddedFixedString<32>{"symbol2"}));
+
+    str1.append("_suffix");
+    str1.resize(6);
+    EXPECT_EQ(hasher(str1), hasher(str2));
+
+    str1.push_back('\0');
+    EXPECT_NE(hasher(str1), hasher(str2));
+}
+
 namespace
 {
 template <FixedString<5> /*MY_STR*/>
@@ -0,0 +1,124 @@
+#include "fixed_containers/fixed_symbol_table.hpp"
+
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace fixed_containers
+{
+namespace
+{
+using SymbolTableType = FixedSymbolTable<16, 128>;
+static_assert(std::is_trivially_copyable_v<SymbolTableType>);
+static_assert(IsStructuralType<SymbolTableType>);
+
+// Every symbol collides, to exercise the chaining of symbols with the same hash.
+struct ConstantHash
+{
+    constexpr std::uint64_t operator()(std::string_view /*symbol*/) const { return 7; }
+};
+}  // namespace
+
+TEST(FixedSymbolTable, DefaultConstructor)
+{
+    constexpr SymbolTableType VAL1{};
+    static_assert(VAL1.empty());
+    static_assert(VAL1.size() == 0);
+    static_assert(VAL1.arena_size() == 0);
+    static_assert(VAL1.max_size() == 16);
+    static_assert(SymbolTableType::arena_capacity() == 128);
+    static_assert(!VAL1.find("a").has_value());
+}
+
+TEST(FixedSymbolTable, InitializerConstructor)
+{
+    constexpr SymbolTableType VAL1{"alpha", "beta", "gamma", "beta"};
+    static_assert(VAL1.size() == 3);
+    static_assert(VAL1.arena_size() == 14);
+    static_assert(VAL1[0] == "alpha");
+    static_assert(VAL1[1] == "beta");
+    static_assert(VAL1[2] == "gamma");
+    static_assert(VAL1.find("gamma") == 2);
+    static_assert(VAL1.contains("alpha"));
+    static_assert(!VAL1.contains("delta"));
+    static_assert(!VAL1.contains("alph"));
+}
+
+TEST(FixedSymbolTable, Intern)
+{
+    SymbolTableType var1{};
+    const std::string dynamic_string = "symbol";
+    EXPECT_EQ(0, var1.intern(dynamic_string));
+    EXPECT_EQ(1, var1.intern("other"));
+    EXPECT_EQ(0, var1.intern("symbol"));
+    EXPECT_EQ(2, var1.intern(""));
+    EXPECT_EQ(2, var1.intern(""));
+    EXPECT_EQ(3, var1.size());
+    EXPECT_EQ(11, var1.arena_size());
+
+    EXPECT_EQ("symbol", var1.at(0));
+    EXPECT_EQ("other", var1.at(1));
+    EXPECT_EQ("", var1.at(2));
+    EXPECT_EQ(1, var1.find("other"));
+}
+
+TEST(FixedSymbolTable, HashCollisions)
+{
+    constexpr FixedSymbolTable<8, 64, ConstantHash> VAL1{"a", "b", "c", "b", "a"};
+    static_assert(VAL1.size() == 3);
+    static_assert(VAL1.find("a") == 0);
+    static_assert(VAL1.find("b") == 1);
+    static_assert(VAL1.find("c") == 2);
+    static_assert(!VAL1.find("d").has_value());
+
+    FixedSymbolTable<8, 64, ConstantHash> var1 = VAL1;
+    EXPECT_EQ(3, var1.intern("d"));
+    EXPECT_EQ(2, var1.intern("c"));
+    EXPECT_EQ("d", var1[3]);
+}
+
+TEST(FixedSymbolTable, CopyBytes)
+{
+    const SymbolTableType original{"one", "two", "three"};
+    SymbolTableType copy{};
+    std::memcpy(&copy, &original, sizeof(SymbolTableType));
+    EXPECT_EQ(2, copy.find("three"));
+    EXPECT_EQ("two", copy[1]);
+    EXPECT_EQ(3, copy.intern("four"));
+    EXPECT_EQ(3, original.size());
+}
+
+TEST(FixedSymbolTable, Clear)
+{
+    SymbolTableType var1{"one", "two"};
+    var1.clear();
+    EXPECT_TRUE(var1.empty());
+    EXPECT_EQ(0, var1.arena_size());
+    EXPECT_FALSE(var1.contains("one"));
+    EXPECT_EQ(0, var1.intern("two"));
+}
+
+TEST(FixedSymbolTable, ExceedsCapacity)
+{
+    FixedSymbolTable<2, 64> var1{"one", "two"};
+    EXPECT_DEATH(var1.intern("three"), "");
+    EXPECT_EQ(1, var1.intern("two"));
+
+    FixedSymbolTable<4, 8> var2{"four"};
+    EXPECT_DEATH(var2.intern("eleven"), "");
+}
+
+TEST(FixedSymbolTable, OutOfBounds)
+{
+    const SymbolTableType var1{"one"};
+    EXPECT_DEATH((void)var1.at(1), "");
+}
+
+}  // namespace fixed_containers
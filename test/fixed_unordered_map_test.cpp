@@ -11,6 +11,7 @@
 #include "fixed_containers/fixed_map_adapter.hpp"
 #include "fixed_containers/max_size.hpp"
 #include "fixed_containers/memory.hpp"
+#include "fixed_containers/wyhash.hpp"
 
 #include <gtest/gtest.h>
 
@@ -18,15 +19,18 @@
 #include <array>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <memory>
 #include <ranges>
+#include <span>
 #include <string>
 #include <string_view>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace fixed_containers
 {
@@ -1242,6 +1246,49 @@ TEST(FixedUnorderedMap, Count)
     static_assert(VAL1.at(4) == 40);
 }
 
+TEST(FixedUnorderedMap, FindAndContainsWithPrecomputedHash)
+{
+    constexpr FixedUnorderedMap<int, int, 10> VAL1{{2, 20}, {4, 40}};
+    static_assert(VAL1.find(2, VAL1.hash_function()(2))->second == 20);
+    static_assert(VAL1.find(3, VAL1.hash_function()(3)) == VAL1.cend());
+    static_assert(VAL1.contains(4, VAL1.hash_function()(4)));
+    static_assert(!VAL1.contains(5, VAL1.hash_function()(5)));
+
+    FixedUnorderedMap<int, int, 10> var1{{2, 20}, {4, 40}};
+    constexpr std::array<int, 4> KEYS{1, 2, 3, 4};
+    std::array<std::uint64_t, 4> hashes{};
+    wyhash::hash_batch(std::span<const int>{KEYS}, std::span{hashes}, var1.hash_function());
+    for (std::size_t i = 0; i < KEYS.size(); i++)
+    {
+        EXPECT_EQ(var1.contains(KEYS[i]), var1.contains(KEYS[i], hashes[i]));
+        EXPECT_EQ(var1.find(KEYS[i]), var1.find(KEYS[i], hashes[i]));
+    }
+    var1.find(4, hashes[3])->second = 45;
+    EXPECT_EQ(45, var1.at(4));
+}
+
+TEST(FixedUnorderedMap, RangeInsertHashesInBatches)
+{
+    // More entries than a batch, with duplicate keys within and across batches
+    std::vector<std::pair<int, int>> entries{};
+    for (int i = 0; i < 50; i++)
+    {
+        entries.emplace_back(i % 37, i);
+    }
+
+    FixedUnorderedMap<int, int, 40> var1{};
+    var1.insert(entries.begin(), entries.end());
+    std::unordered_map<int, int> reference{entries.begin(), entries.end()};
+    ASSERT_EQ(reference.size(), var1.size());
+    for (const auto& [key, value] : reference)
+    {
+        EXPECT_EQ(value, var1.at(key));
+    }
+
+    FixedUnorderedMap<int, int, 36> var2{};
+    EXPECT_DEATH(var2.insert(entries.begin(), entries.end()), "");
+}
+
 // TEST(FixedUnorderedMap, Count_TransparentComparator)
 // {
 //     constexpr FixedUnorderedMap<MockAComparableToB, int, 5, std::less<>> var{
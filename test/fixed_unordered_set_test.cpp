@@ -7,16 +7,21 @@
 #include "fixed_containers/consteval_compare.hpp"
 #include "fixed_containers/fixed_set_adapter.hpp"
 #include "fixed_containers/max_size.hpp"
+#include "fixed_containers/wyhash.hpp"
 
 #include <gtest/gtest.h>
 
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <ranges>
+#include <span>
 #include <string>
 #include <type_traits>
+#include <unordered_set>
+#include <vector>
 
 namespace fixed_containers
 {
@@ -106,6 +111,47 @@ TEST(FixedUnorderedSet, Contains)
     static_assert(VAL1.contains(4));
 }
 
+TEST(FixedUnorderedSet, FindAndContainsWithPrecomputedHash)
+{
+    constexpr FixedUnorderedSet<int, 10> VAL1{2, 4};
+    static_assert(*VAL1.find(2, VAL1.hash_function()(2)) == 2);
+    static_assert(VAL1.find(3, VAL1.hash_function()(3)) == VAL1.cend());
+    static_assert(VAL1.contains(4, VAL1.hash_function()(4)));
+    static_assert(!VAL1.contains(5, VAL1.hash_function()(5)));
+
+    const FixedUnorderedSet<int, 10> var1{2, 4};
+    constexpr std::array<int, 4> KEYS{1, 2, 3, 4};
+    std::array<std::uint64_t, 4> hashes{};
+    wyhash::hash_batch(std::span<const int>{KEYS}, std::span{hashes}, var1.hash_function());
+    for (std::size_t i = 0; i < KEYS.size(); i++)
+    {
+        EXPECT_EQ(var1.contains(KEYS[i]), var1.contains(KEYS[i], hashes[i]));
+        EXPECT_EQ(var1.find(KEYS[i]), var1.find(KEYS[i], hashes[i]));
+    }
+}
+
+TEST(FixedUnorderedSet, RangeInsertHashesInBatches)
+{
+    // More keys than a batch, with duplicates within and across batches
+    std::vector<int> keys{};
+    for (int i = 0; i < 50; i++)
+    {
+        keys.push_back(i % 37);
+    }
+
+    FixedUnorderedSet<int, 40> var1{};
+    var1.insert(keys.begin(), keys.end());
+    const std::unordered_set<int> reference{keys.begin(), keys.end()};
+    ASSERT_EQ(reference.size(), var1.size());
+    for (const int key : reference)
+    {
+        EXPECT_TRUE(var1.contains(key));
+    }
+
+    FixedUnorderedSet<int, 36> var2{};
+    EXPECT_DEATH(var2.insert(keys.begin(), keys.end()), "");
+}
+
 // TEST(FixedUnorderedSet, Contains_TransparentComparator)
 // {
 //     constexpr FixedUnorderedSet<MockAComparableToB, 5, std::less<>> var{
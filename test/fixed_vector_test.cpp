@@ -1205,6 +1205,25 @@ TEST(FixedVector, Resize)
     }
 }
 
+TEST(FixedVector, ResizeForOverwrite)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedVector<int, 7> var{0, 1, 2};
+        std::next(var.data(), 3)[0] = 30;
+        std::next(var.data(), 3)[1] = 40;
+        var.resize_for_overwrite(5);
+        return var;
+    }();
+
+    static_assert(std::ranges::equal(VAL1, std::array{0, 1, 2, 30, 40}));
+
+    FixedVector<int, 8> var2{0, 1, 2, 3};
+    var2.resize_for_overwrite(2);
+    EXPECT_TRUE(std::ranges::equal(var2, std::array<int, 2>{{0, 1}}));
+    EXPECT_DEATH(var2.resize_for_overwrite(9), "");
+}
+
 TEST(FixedVector, ResizeExceedsCapacity)
 {
     FixedVector<int, 3> var1{};
@@ -2055,6 +2074,31 @@ TEST(FixedVector, UsageAsTemplateParameter)
     static_cast<void>(my_struct);
 }
 
+TEST(FixedVector, NoChecking)
+{
+    using VecType = FixedVector<int, 5, customize::SequenceContainerNoChecking<int, 5>>;
+    static_assert(customize::SequenceContainerChecking<
+                  customize::SequenceContainerNoChecking<int, 5>>);
+    static_assert(sizeof(VecType) == sizeof(FixedVector<int, 5>));
+
+    constexpr VecType VAL1 = []()
+    {
+        VecType var{};
+        var.push_back(1);
+        var.push_back(2);
+        var.at(1) = 3;
+        return var;
+    }();
+    static_assert(VAL1.size() == 2);
+    static_assert(VAL1.at(1) == 3);
+
+    VecType var1{1, 2, 3};
+    var1.pop_back();
+    var1.emplace_back(4);
+    EXPECT_EQ(4, var1.back());
+    EXPECT_EQ(3, var1.size());
+}
+
 namespace
 {
 struct FixedVectorInstanceCounterUniquenessToken
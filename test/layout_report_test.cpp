@@ -0,0 +1,196 @@
+#if defined(__clang__) && __clang_major__ >= 15
+
+#include "fixed_containers/layout_report.hpp"
+
+#include "fixed_containers/fixed_map.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <optional>
+#include <string>
+
+namespace fixed_containers
+{
+namespace
+{
+struct Padded
+{
+    char a;
+    std::int64_t b;
+    char c;
+};
+
+struct Packed
+{
+    std::int64_t a;
+    std::int32_t b;
+    char c;
+    char d;
+};
+
+// Inherited fields are laid out by the base class
+struct PaddedChild : public Padded
+{
+};
+
+struct EmptyBase
+{
+};
+struct PaddedWithEmptyBase : public EmptyBase
+{
+    char a;
+    std::int64_t b;
+    char c;
+};
+
+struct Outer
+{
+    char tag;
+    Padded inner;
+    std::int16_t count;
+};
+
+struct WithContainers
+{
+    FixedVector<int, 4> values;
+    std::optional<int> maybe;
+    FixedMap<int, int, 4> lookup;
+};
+}  // namespace
+
+TEST(LayoutReport, Padding)
+{
+    const auto report = reflection::layout_report<Padded>();
+    EXPECT_EQ(sizeof(Padded), report.size);
+    EXPECT_EQ(alignof(Padded), report.alignment);
+    ASSERT_EQ(3, report.fields.size());
+
+    EXPECT_EQ("a", report.fields.at(0).name);
+    EXPECT_EQ(0, report.fields.at(0).offset);
+    EXPECT_EQ(1, report.fields.at(0).size);
+    EXPECT_EQ(7, report.fields.at(0).padding_after);
+
+    EXPECT_EQ("b", report.fields.at(1).name);
+    EXPECT_EQ(8, report.fields.at(1).offset);
+    EXPECT_EQ(8, report.fields.at(1).alignment);
+    EXPECT_EQ(0, report.fields.at(1).padding_after);
+
+    EXPECT_EQ("c", report.fields.at(2).name);
+    EXPECT_EQ(16, report.fields.at(2).offset);
+    EXPECT_EQ(7, report.fields.at(2).padding_after);
+
+    EXPECT_EQ(14, report.padding);
+}
+
+TEST(LayoutReport, SuggestedOrder)
+{
+    {
+        const auto report = reflection::layout_report<Padded>();
+        ASSERT_EQ(3, report.suggested_order.size());
+        EXPECT_EQ("b", report.suggested_order.at(0));
+        EXPECT_EQ("a", report.suggested_order.at(1));
+        EXPECT_EQ("c", report.suggested_order.at(2));
+        EXPECT_EQ(16, report.suggested_size);
+        EXPECT_EQ(8, report.bytes_saved_by_reordering());
+    }
+
+    {
+        const auto report = reflection::layout_report<Packed>();
+        EXPECT_EQ(2, report.padding);
+        EXPECT_EQ(0, report.bytes_saved_by_reordering());
+    }
+}
+
+TEST(LayoutReport, InheritedFieldsAreNotReordered)
+{
+    {
+        const auto report = reflection::layout_report<PaddedChild>();
+        ASSERT_EQ(3, report.fields.size());
+        EXPECT_TRUE(report.fields.at(0).inherited);
+        EXPECT_TRUE(report.fields.at(1).inherited);
+        EXPECT_TRUE(report.fields.at(2).inherited);
+        EXPECT_EQ(14, report.padding);
+        EXPECT_TRUE(report.suggested_order.empty());
+        EXPECT_EQ(sizeof(PaddedChild), report.suggested_size);
+        EXPECT_EQ(0, report.bytes_saved_by_reordering());
+    }
+
+    {
+        const auto report = reflection::layout_report<PaddedWithEmptyBase>();
+        ASSERT_EQ(3, report.fields.size());
+        EXPECT_FALSE(report.fields.at(0).inherited);
+        ASSERT_EQ(3, report.suggested_order.size());
+        EXPECT_EQ("b", report.suggested_order.at(0));
+        EXPECT_EQ(16, report.suggested_size);
+    }
+}
+
+TEST(LayoutReport, NestedStructs)
+{
+    const auto report = reflection::layout_report<Outer>();
+    ASSERT_EQ(6, report.fields.size());
+
+    EXPECT_EQ("tag", report.fields.at(0).name);
+    EXPECT_EQ(0, report.fields.at(0).depth);
+    EXPECT_EQ(7, report.fields.at(0).padding_after);
+
+    EXPECT_EQ("inner", report.fields.at(1).name);
+    EXPECT_EQ(0, report.fields.at(1).depth);
+    EXPECT_EQ(8, report.fields.at(1).offset);
+
+    EXPECT_EQ("a", report.fields.at(2).name);
+    EXPECT_EQ(1, report.fields.at(2).depth);
+    EXPECT_EQ(8, report.fields.at(2).offset);
+    EXPECT_EQ("b", report.fields.at(3).name);
+    EXPECT_EQ(16, report.fields.at(3).offset);
+    EXPECT_EQ("c", report.fields.at(4).name);
+    EXPECT_EQ(24, report.fields.at(4).offset);
+
+    EXPECT_EQ("count", report.fields.at(5).name);
+    EXPECT_EQ(0, report.fields.at(5).depth);
+    EXPECT_EQ(32, report.fields.at(5).offset);
+    EXPECT_EQ(6, report.fields.at(5).padding_after);
+
+    // 7 after `tag`, 14 inside `inner` and 6 at the end
+    EXPECT_EQ(27, report.padding);
+    // Reordering doesn't change the layout of `inner`
+    EXPECT_EQ(32, report.suggested_size);
+}
+
+TEST(LayoutReport, ContainerOverhead)
+{
+    const auto report = reflection::layout_report<WithContainers>();
+    ASSERT_EQ(3, report.fields.size());
+
+    EXPECT_EQ(sizeof(FixedVector<int, 4>) - (4 * sizeof(int)),
+              report.fields.at(0).container_overhead);
+    EXPECT_EQ(sizeof(std::optional<int>) - sizeof(int), report.fields.at(1).container_overhead);
+    EXPECT_LT(0, report.fields.at(2).container_overhead);
+}
+
+TEST(LayoutReport, Dump)
+{
+    const auto report = reflection::layout_report<Padded>();
+
+    std::FILE* file = std::tmpfile();
+    ASSERT_NE(nullptr, file);
+    report.dump(file);
+    std::rewind(file);
+    std::string contents{};
+    for (int character = std::fgetc(file); character != EOF; character = std::fgetc(file))
+    {
+        contents.push_back(static_cast<char>(character));
+    }
+    std::fclose(file);
+
+    EXPECT_NE(std::string::npos, contents.find("Padded"));
+    EXPECT_NE(std::string::npos, contents.find("Reordering saves 8 bytes (size 16): b a c"));
+}
+
+}  // namespace fixed_containers
+
+#endif
@@ -0,0 +1,128 @@
+// Compile-time benchmark for `reflection`: this translation unit only evaluates
+// `field_count_of()`, `field_names_of()` and `for_each_field()` in constant expressions. Build it
+// with FIXED_CONTAINERS_REFLECTION_BENCHMARK_FIELD_COUNT set to 10, 100 or 1000 (the CMake build
+// has one target per count) and compare the compilation times. With clang, `-ftime-trace` also
+// writes the time spent in each constant evaluation (the `EvaluateAsConstantExpr` entries) to a
+// `.json` next to the object file, which can be opened in https://ui.perfetto.dev.
+#if !defined(FIXED_CONTAINERS_REFLECTION_BENCHMARK_FIELD_COUNT)
+#define FIXED_CONTAINERS_REFLECTION_BENCHMARK_FIELD_COUNT 100
+#endif
+
+// Reflection needs clang-15 or higher. Before clang-17, `__builtin_dump_struct()` has a limit of
+// around 200 fields in total (see `BuiltinDumpStructLimits` in reflection_test.cpp), so the
+// 1000-field benchmark needs clang-17. The CMake build only adds it there.
+#if defined(__clang__) && __clang_major__ >= 15 &&                                              \
+    (__clang_major__ >= 17 || FIXED_CONTAINERS_REFLECTION_BENCHMARK_FIELD_COUNT <= 100)
+
+// NOLINTBEGIN(misc-confusable-identifiers)
+
+#define FIXED_CONTAINERS_EXTENDED_STRUCT_DECOMPOSITION_1024 1
+
+#include "fixed_containers/reflection.hpp"
+
+#include <cstddef>
+
+// Only some of the field macros are used for a given field count
+#pragma clang diagnostic ignored "-Wunused-macros"
+
+// Fields named `<prefix>0` to `<prefix>9`, etc.
+#define FIXED_CONTAINERS_FIELDS_1(prefix) int prefix##0;
+#define FIXED_CONTAINERS_FIELDS_10(prefix)                                                    \
+    int prefix##0;                                                                             \
+    int prefix##1;                                                                             \
+    int prefix##2;                                                                             \
+    int prefix##3;                                                                             \
+    int prefix##4;                                                                             \
+    int prefix##5;                                                                             \
+    int prefix##6;                                                                             \
+    int prefix##7;                                                                             \
+    int prefix##8;                                                                             \
+    int prefix##9;
+#define FIXED_CONTAINERS_FIELDS_100(prefix)                                                   \
+    FIXED_CONTAINERS_FIELDS_10(prefix##0)                                                      \
+    FIXED_CONTAINERS_FIELDS_10(prefix##1)                                                      \
+    FIXED_CONTAINERS_FIELDS_10(prefix##2)                                                      \
+    FIXED_CONTAINERS_FIELDS_10(prefix##3)                                                      \
+    FIXED_CONTAINERS_FIELDS_10(prefix##4)                                                      \
+    FIXED_CONTAINERS_FIELDS_10(prefix##5)                                                      \
+    FIXED_CONTAINERS_FIELDS_10(prefix##6)                                                      \
+    FIXED_CONTAINERS_FIELDS_10(prefix##7)                                                      \
+    FIXED_CONTAINERS_FIELDS_10(prefix##8)                                                      \
+    FIXED_CONTAINERS_FIELDS_10(prefix##9)
+#define FIXED_CONTAINERS_FIELDS_1000(prefix)                                                  \
+    FIXED_CONTAINERS_FIELDS_100(prefix##0)                                                     \
+    FIXED_CONTAINERS_FIELDS_100(prefix##1)                                                     \
+    FIXED_CONTAINERS_FIELDS_100(prefix##2)                                                     \
+    FIXED_CONTAINERS_FIELDS_100(prefix##3)                                                     \
+    FIXED_CONTAINERS_FIELDS_100(prefix##4)                                                     \
+    FIXED_CONTAINERS_FIELDS_100(prefix##5)                                                     \
+    FIXED_CONTAINERS_FIELDS_100(prefix##6)                                                     \
+    FIXED_CONTAINERS_FIELDS_100(prefix##7)                                                     \
+    FIXED_CONTAINERS_FIELDS_100(prefix##8)                                                     \
+    FIXED_CONTAINERS_FIELDS_100(prefix##9)
+
+#define FIXED_CONTAINERS_FIELDS_IMPL(count, prefix) FIXED_CONTAINERS_FIELDS_##count(prefix)
+#define FIXED_CONTAINERS_FIELDS(count, prefix) FIXED_CONTAINERS_FIELDS_IMPL(count, prefix)
+
+#define FIXED_CONTAINERS_TENTH_OF_10 1
+#define FIXED_CONTAINERS_TENTH_OF_100 10
+#define FIXED_CONTAINERS_TENTH_OF_1000 100
+#define FIXED_CONTAINERS_TENTH_OF_IMPL(count) FIXED_CONTAINERS_TENTH_OF_##count
+#define FIXED_CONTAINERS_TENTH_OF(count) FIXED_CONTAINERS_TENTH_OF_IMPL(count)
+#define FIXED_CONTAINERS_INNER_FIELD_COUNT \
+    FIXED_CONTAINERS_TENTH_OF(FIXED_CONTAINERS_REFLECTION_BENCHMARK_FIELD_COUNT)
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t FIELD_COUNT = FIXED_CONTAINERS_REFLECTION_BENCHMARK_FIELD_COUNT;
+
+struct Flat
+{
+    FIXED_CONTAINERS_FIELDS(FIXED_CONTAINERS_REFLECTION_BENCHMARK_FIELD_COUNT, a)
+};
+
+// `__builtin_dump_struct()` walks the fields of nested structs too, so this has as many entries to
+// parse as `Flat`, but only 10 top-level fields.
+struct Inner
+{
+    FIXED_CONTAINERS_FIELDS(FIXED_CONTAINERS_INNER_FIELD_COUNT, b)
+};
+struct Nested
+{
+    Inner c0;
+    Inner c1;
+    Inner c2;
+    Inner c3;
+    Inner c4;
+    Inner c5;
+    Inner c6;
+    Inner c7;
+    Inner c8;
+    Inner c9;
+};
+
+static_assert(reflection::field_count_of<Flat>() == FIELD_COUNT);
+static_assert(reflection::field_names_of<Flat>().size() == FIELD_COUNT);
+static_assert(reflection::field_names_of<Flat>().at(0).starts_with("a0"));
+
+static_assert(reflection::field_count_of<Nested>() == 10);
+static_assert(reflection::field_names_of<Nested>().at(9) == "c9");
+
+constexpr std::size_t SUM_OF_FLAT_FIELDS = []()
+{
+    Flat instance{};
+    std::size_t sum = 0;
+    reflection::for_each_field(instance,
+                               [&sum](const auto& /*name*/, const int& field)
+                               { sum += static_cast<std::size_t>(field) + 1; });
+    return sum;
+}();
+static_assert(SUM_OF_FLAT_FIELDS == FIELD_COUNT);
+}  // namespace
+}  // namespace fixed_containers
+
+// NOLINTEND(misc-confusable-identifiers)
+
+#endif
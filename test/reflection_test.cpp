@@ -498,6 +498,30 @@ TEST(Reflection, FieldCount)
 {
     static_assert(reflection::field_count_of<StructWithNestedStructs>() == 4);
     static_assert(reflection::field_count_of<StructWithNonAggregates>() == 2);
+    static_assert(reflection::field_count_of<ChildStruct>() == 4);
+}
+
+TEST(Reflection, FieldNamesMatchFieldInfo)
+{
+    {
+        constexpr auto FIELD_INFO = field_info_of(StructWithNestedStructs{});
+        constexpr const auto& FIELD_NAMES = reflection::field_names_of<StructWithNestedStructs>();
+        static_assert(FIELD_INFO.size() == FIELD_NAMES.size());
+        static_assert(FIELD_INFO.at(2).field_name() == FIELD_NAMES.at(2));
+        static_assert(FIELD_INFO.at(3).field_name() == FIELD_NAMES.at(3));
+    }
+
+    {
+        // Fields inherited from base classes are top-level fields
+        constexpr auto FIELD_INFO = field_info_of(ChildStruct{});
+        constexpr const auto& FIELD_NAMES = reflection::field_names_of<ChildStruct>();
+        static_assert(FIELD_INFO.size() == 4);
+        static_assert(FIELD_NAMES.size() == 4);
+        static_assert(FIELD_NAMES.at(0) == "a");
+        static_assert(FIELD_NAMES.at(1) == "b");
+        static_assert(FIELD_NAMES.at(2) == "c");
+        static_assert(FIELD_NAMES.at(3) == "d");
+    }
 }
 
 TEST(Reflection, FieldNames)
@@ -0,0 +1,332 @@
+#include "fixed_containers/sort.hpp"
+
+#include "enums_test_common.hpp"
+
+#include "fixed_containers/enum_array.hpp"
+#include "fixed_containers/fixed_deque.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using rich_enums::TestEnum1;
+
+// Inputs that are known to be troublesome for quicksort-based algorithms.
+std::vector<std::vector<int>> make_patterns(std::size_t count, std::mt19937& generator)
+{
+    std::vector<std::vector<int>> out{};
+    std::uniform_int_distribution<int> distribution{0, static_cast<int>(count)};
+    std::uniform_int_distribution<int> few_values{0, 3};
+
+    std::vector<int> ascending(count);
+    std::iota(ascending.begin(), ascending.end(), 0);
+    out.push_back(ascending);
+    out.emplace_back(ascending.rbegin(), ascending.rend());
+    out.emplace_back(count, 7);
+
+    std::vector<int> organ_pipe(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        organ_pipe[i] = static_cast<int>(std::min(i, count - i));
+    }
+    out.push_back(organ_pipe);
+
+    std::vector<int> random(count);
+    std::ranges::generate(random, [&]() { return distribution(generator); });
+    out.push_back(random);
+
+    std::vector<int> duplicates(count);
+    std::ranges::generate(duplicates, [&]() { return few_values(generator); });
+    out.push_back(duplicates);
+
+    std::vector<int> almost_sorted = ascending;
+    for (std::size_t i = 0; i + 1 < count; i += 7)
+    {
+        std::swap(almost_sorted[i], almost_sorted[i + 1]);
+    }
+    out.push_back(almost_sorted);
+    return out;
+}
+
+template <std::size_t CAPACITY>
+void check_sort_all_sizes()
+{
+    std::mt19937 generator{static_cast<std::mt19937::result_type>(CAPACITY)};
+    for (std::size_t count = 0; count <= CAPACITY; count++)
+    {
+        for (const std::vector<int>& pattern : make_patterns(count, generator))
+        {
+            FixedVector<int, CAPACITY> var1(pattern.begin(), pattern.end());
+            std::vector<int> expected = pattern;
+            std::ranges::sort(expected);
+
+            sort(var1);
+            ASSERT_TRUE(std::ranges::equal(expected, var1)) << "count: " << count;
+
+            var1.assign(pattern.begin(), pattern.end());
+            sort(var1, std::greater<>{});
+            ASSERT_TRUE(std::ranges::equal(expected | std::views::reverse, var1));
+        }
+    }
+}
+}  // namespace
+
+TEST(Sort, SortingNetworks)
+{
+    static_assert(sort_detail::SORTING_NETWORK<4>.size() == 5);
+    static_assert(sort_detail::SORTING_NETWORK<8>.size() == 19);
+    static_assert(sort_detail::SORTING_NETWORK<16>.size() == 63);
+    static_assert(sort_detail::SORTING_NETWORK<32>.size() == 191);
+
+    // A sorting network sorts all inputs iff it sorts all 0/1 inputs.
+    constexpr std::size_t SIZE = 16;
+    for (std::uint32_t mask = 0; mask < (1U << SIZE); mask++)
+    {
+        std::array<int, SIZE> input{};
+        for (std::size_t i = 0; i < SIZE; i++)
+        {
+            input.at(i) = static_cast<int>((mask >> i) & 1U);
+        }
+        std::less<> comparator{};
+        sort_detail::apply_sorting_network<SIZE>(input.begin(), SIZE, comparator);
+        ASSERT_TRUE(std::ranges::is_sorted(input));
+    }
+}
+
+TEST(Sort, BranchlessInsertionSort)
+{
+    struct KeyAndPosition
+    {
+        int key;
+        std::size_t position;
+
+        constexpr bool operator==(const KeyAndPosition& other) const = default;
+    };
+    static_assert(sort_detail::HAS_BRANCHLESS_COMPARE_EXCHANGE<KeyAndPosition>);
+    static_assert(!sort_detail::HAS_BRANCHLESS_COMPARE_EXCHANGE<std::string>);
+
+    // Stable: only the keys are compared
+    std::mt19937 generator{7};
+    std::uniform_int_distribution<int> few_values{0, 3};
+    auto comparator = [](const KeyAndPosition& lhs, const KeyAndPosition& rhs)
+    { return lhs.key < rhs.key; };
+    for (std::size_t count = 0; count <= 24; count++)
+    {
+        std::vector<KeyAndPosition> input(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            input[i] = {.key = few_values(generator), .position = i};
+        }
+        std::vector<KeyAndPosition> expected = input;
+        std::ranges::stable_sort(expected, comparator);
+
+        sort_detail::branchless_insertion_sort(input.begin(), input.end(), comparator);
+        ASSERT_TRUE(std::ranges::equal(expected, input)) << "count: " << count;
+    }
+}
+
+TEST(Sort, FixedVectorSmallCapacities)
+{
+    check_sort_all_sizes<1>();
+    check_sort_all_sizes<3>();
+    check_sort_all_sizes<8>();
+    check_sort_all_sizes<13>();
+    check_sort_all_sizes<32>();
+}
+
+TEST(Sort, FixedVectorLargeCapacities)
+{
+    check_sort_all_sizes<33>();
+    check_sort_all_sizes<200>();
+
+    std::mt19937 generator{42};
+    for (const std::vector<int>& pattern : make_patterns(5000, generator))
+    {
+        FixedVector<int, 5000> var1(pattern.begin(), pattern.end());
+        std::vector<int> expected = pattern;
+        std::ranges::sort(expected);
+        sort(var1);
+        ASSERT_TRUE(std::ranges::equal(expected, var1));
+    }
+}
+
+TEST(Sort, Constexpr)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedVector<int, 16> var{5, 3, 9, 1, 7, 2, 8};
+        sort(var);
+        return var;
+    }();
+    static_assert(std::ranges::equal(VAL1, std::array{1, 2, 3, 5, 7, 8, 9}));
+
+    constexpr auto VAL2 = []()
+    {
+        FixedVector<int, 64> var{};
+        for (int i = 0; i < 64; i++)
+        {
+            var.push_back((i * 37) % 64);
+        }
+        sort(var);
+        return var;
+    }();
+    static_assert(std::ranges::is_sorted(VAL2));
+    static_assert(VAL2.front() == 0 && VAL2.back() == 63);
+
+    constexpr auto VAL3 = []()
+    {
+        FixedDeque<int, 8> var{3, 1, 2};
+        var.push_front(9);
+        stable_sort(var);
+        return var;
+    }();
+    static_assert(std::ranges::equal(VAL3, std::array{1, 2, 3, 9}));
+}
+
+TEST(Sort, FixedDequeWrapsAround)
+{
+    std::mt19937 generator{7};
+    std::uniform_int_distribution<int> distribution{-1000, 1000};
+
+    FixedDeque<int, 24> var1{};
+    FixedDeque<int, 300> var2{};
+    for (int i = 0; i < 12; i++)
+    {
+        var1.push_front(distribution(generator));
+        var1.push_back(distribution(generator));
+    }
+    for (int i = 0; i < 150; i++)
+    {
+        var2.push_front(distribution(generator));
+        var2.push_back(distribution(generator));
+    }
+
+    sort(var1);
+    sort(var2);
+    EXPECT_TRUE(std::ranges::is_sorted(var1));
+    EXPECT_TRUE(std::ranges::is_sorted(var2));
+}
+
+TEST(Sort, EnumArray)
+{
+    constexpr auto VAL1 = []()
+    {
+        EnumArray<TestEnum1, int> var{
+            {TestEnum1::ONE, 40}, {TestEnum1::TWO, 10}, {TestEnum1::THREE, 30}};
+        sort(var);
+        return var;
+    }();
+
+    static_assert(VAL1.at(TestEnum1::ONE) == 0);
+    static_assert(VAL1.at(TestEnum1::TWO) == 10);
+    static_assert(VAL1.at(TestEnum1::THREE) == 30);
+    static_assert(VAL1.at(TestEnum1::FOUR) == 40);
+}
+
+TEST(Sort, NonTrivialType)
+{
+    FixedVector<std::string, 8> var1{"delta", "alpha", "charlie", "bravo"};
+    sort(var1);
+    EXPECT_TRUE(std::ranges::equal(var1, std::array<std::string, 4>{
+                                             "alpha", "bravo", "charlie", "delta"}));
+
+    FixedVector<std::string, 100> var2{};
+    for (int i = 99; i >= 0; i--)
+    {
+        var2.push_back(std::to_string(i));
+    }
+    sort(var2);
+    EXPECT_TRUE(std::ranges::is_sorted(var2));
+    EXPECT_EQ("0", var2.front());
+}
+
+TEST(Sort, StableSort)
+{
+    using Entry = std::pair<int, int>;
+    const auto by_key = [](const Entry& lhs, const Entry& rhs) { return lhs.first < rhs.first; };
+
+    std::mt19937 generator{5};
+    std::uniform_int_distribution<int> distribution{0, 9};
+
+    std::vector<Entry> reference{};
+    FixedVector<Entry, 16> var1{};
+    FixedVector<Entry, 1000> var2{};
+    for (int i = 0; i < 1000; i++)
+    {
+        reference.emplace_back(distribution(generator), i);
+    }
+
+    std::copy_n(reference.begin(), 16, std::back_inserter(var1));
+    std::copy(reference.begin(), reference.end(), std::back_inserter(var2));
+
+    stable_sort(var1, by_key);
+    stable_sort(var2, by_key);
+
+    std::vector<Entry> expected1(reference.begin(), std::next(reference.begin(), 16));
+    std::ranges::stable_sort(expected1, by_key);
+    std::ranges::stable_sort(reference, by_key);
+    EXPECT_TRUE(std::ranges::equal(expected1, var1));
+    EXPECT_TRUE(std::ranges::equal(reference, var2));
+}
+
+TEST(Sort, PartialSort)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedVector<int, 8> var{5, 3, 9, 1, 7, 2, 8};
+        partial_sort(var, std::next(var.begin(), 3));
+        return var;
+    }();
+    static_assert(VAL1.at(0) == 1 && VAL1.at(1) == 2 && VAL1.at(2) == 3);
+
+    FixedVector<int, 100> var2{};
+    for (int i = 0; i < 100; i++)
+    {
+        var2.push_back((i * 31) % 100);
+    }
+    partial_sort(var2, std::next(var2.begin(), 10), std::greater<>{});
+    for (int i = 0; i < 10; i++)
+    {
+        EXPECT_EQ(99 - i, var2.at(static_cast<std::size_t>(i)));
+    }
+}
+
+TEST(Sort, NthElement)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedVector<int, 8> var{5, 3, 9, 1, 7, 2, 8};
+        nth_element(var, std::next(var.begin(), 3));
+        return var;
+    }();
+    static_assert(VAL1.at(3) == 5);
+
+    FixedDeque<int, 100> var2{};
+    for (int i = 0; i < 100; i++)
+    {
+        var2.push_back((i * 31) % 100);
+    }
+    auto nth = std::next(var2.begin(), 40);
+    nth_element(var2, nth);
+    EXPECT_EQ(40, *nth);
+    EXPECT_TRUE(std::all_of(var2.begin(), nth, [](int entry) { return entry <= 40; }));
+    EXPECT_TRUE(std::all_of(nth, var2.end(), [](int entry) { return entry >= 40; }));
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,352 @@
+#include "fixed_containers/sparse_enum_map.hpp"
+
+#include "enums_test_common.hpp"
+#include "test_utilities_common.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/enum_map.hpp"
+#include "fixed_containers/map_checking.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using TestEnum1 = rich_enums::TestEnum1;
+using TestRichEnum1 = rich_enums::TestRichEnum1;
+using TestEnum65 = rich_enums::TestEnum65;
+
+using SEM_1 = SparseEnumMap<TestEnum1, int, 3>;
+using SEM_2 = SparseEnumMap<TestRichEnum1, int, 4>;
+
+static_assert(std::is_trivially_copyable_v<SEM_1>);
+static_assert(std::is_standard_layout_v<SEM_1>);
+static_assert(IsStructuralType<SEM_1>);
+static_assert(std::is_trivially_copyable_v<SEM_2>);
+static_assert(IsStructuralType<SEM_2>);
+
+static_assert(std::bidirectional_iterator<SEM_1::iterator>);
+static_assert(std::bidirectional_iterator<SEM_1::const_iterator>);
+static_assert(!std::random_access_iterator<SEM_1::iterator>);
+
+// Memory scales with the entries, not with the enum
+struct LargeValue
+{
+    std::array<int, 16> data;
+};
+static_assert(sizeof(SparseEnumMap<TestEnum65, LargeValue, 4>) <
+              sizeof(EnumMap<TestEnum65, LargeValue>) / 8);
+}  // namespace
+
+TEST(SparseEnumMap, DefaultConstructor)
+{
+    constexpr SparseEnumMap<TestEnum1, int, 3> VAL1{};
+    static_assert(VAL1.empty());
+    static_assert(VAL1.max_size() == 3);
+}
+
+TEST(SparseEnumMap, InitializerConstructor)
+{
+    constexpr SparseEnumMap<TestEnum1, int, 3> VAL1{{TestEnum1::FOUR, 40}, {TestEnum1::TWO, 20}};
+    static_assert(VAL1.size() == 2);
+    static_assert(VAL1.at(TestEnum1::TWO) == 20);
+    static_assert(VAL1.at(TestEnum1::FOUR) == 40);
+    static_assert(!VAL1.contains(TestEnum1::ONE));
+
+    constexpr SparseEnumMap<TestRichEnum1, int, 4> VAL2{{TestRichEnum1::C_FOUR(), 40}};
+    static_assert(VAL2.size() == 1);
+    static_assert(VAL2.at(TestRichEnum1::C_FOUR()) == 40);
+}
+
+TEST(SparseEnumMap, OperatorBracket)
+{
+    constexpr SparseEnumMap<TestEnum1, int, 3> VAL1 = []()
+    {
+        SparseEnumMap<TestEnum1, int, 3> var{};
+        var[TestEnum1::THREE] = 30;
+        var[TestEnum1::ONE] = 10;
+        var[TestEnum1::THREE] += 3;
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 2);
+    static_assert(VAL1.at(TestEnum1::ONE) == 10);
+    static_assert(VAL1.at(TestEnum1::THREE) == 33);
+}
+
+TEST(SparseEnumMap, IterationIsInKeyOrder)
+{
+    constexpr SparseEnumMap<TestEnum65, int, 4> VAL1{
+        {TestEnum65::V64, 64}, {TestEnum65::V3, 3}, {TestEnum65::V40, 40}, {TestEnum65::V0, 0}};
+
+    static_assert(std::distance(VAL1.cbegin(), VAL1.cend()) == 4);
+    static_assert(VAL1.begin()->first == TestEnum65::V0);
+    static_assert(std::next(VAL1.begin(), 2)->second == 40);
+    static_assert(VAL1.rbegin()->first == TestEnum65::V64);
+    static_assert(std::next(VAL1.rbegin(), 1)->second == 40);
+
+    std::vector<int> forward{};
+    for (const auto& [key, value] : VAL1)
+    {
+        EXPECT_EQ(static_cast<int>(key), value);
+        forward.push_back(value);
+    }
+    EXPECT_EQ((std::vector<int>{0, 3, 40, 64}), forward);
+
+    std::vector<int> backward{};
+    for (auto it = VAL1.crbegin(); it != VAL1.crend(); ++it)
+    {
+        backward.push_back(it->second);
+    }
+    EXPECT_EQ((std::vector<int>{64, 40, 3, 0}), backward);
+}
+
+TEST(SparseEnumMap, MutableIteration)
+{
+    SparseEnumMap<TestEnum65, int, 4> var1{{TestEnum65::V1, 1}, {TestEnum65::V63, 63}};
+    for (auto&& [_, value] : var1)
+    {
+        value *= 2;
+    }
+    EXPECT_EQ(2, var1.at(TestEnum65::V1));
+    EXPECT_EQ(126, var1.at(TestEnum65::V63));
+}
+
+TEST(SparseEnumMap, InsertOrAssignAndTryEmplace)
+{
+    SparseEnumMap<TestEnum65, int, 3> var1{};
+    {
+        auto [it, was_inserted] = var1.insert_or_assign(TestEnum65::V10, 10);
+        EXPECT_TRUE(was_inserted);
+        EXPECT_EQ(TestEnum65::V10, it->first);
+    }
+    {
+        auto [it, was_inserted] = var1.insert_or_assign(TestEnum65::V10, 11);
+        EXPECT_FALSE(was_inserted);
+        EXPECT_EQ(11, it->second);
+    }
+    {
+        auto [it, was_inserted] = var1.try_emplace(TestEnum65::V10, 12);
+        EXPECT_FALSE(was_inserted);
+        EXPECT_EQ(11, it->second);
+    }
+    {
+        auto [it, was_inserted] = var1.try_emplace(TestEnum65::V5, 5);
+        EXPECT_TRUE(was_inserted);
+        EXPECT_EQ(5, it->second);
+    }
+    {
+        auto [it, was_inserted] = var1.emplace(TestEnum65::V50, 50);
+        EXPECT_TRUE(was_inserted);
+        EXPECT_EQ(50, it->second);
+    }
+
+    EXPECT_EQ(3, var1.size());
+    EXPECT_TRUE(is_full(var1));
+    EXPECT_EQ(5, var1.at(TestEnum65::V5));
+    EXPECT_EQ(11, var1.at(TestEnum65::V10));
+    EXPECT_EQ(50, var1.at(TestEnum65::V50));
+}
+
+TEST(SparseEnumMap, Erase)
+{
+    constexpr SparseEnumMap<TestEnum65, int, 4> VAL1 = []()
+    {
+        SparseEnumMap<TestEnum65, int, 4> var{
+            {TestEnum65::V2, 2}, {TestEnum65::V30, 30}, {TestEnum65::V64, 64}};
+        var.erase(TestEnum65::V30);
+        var.erase(TestEnum65::V31);
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 2);
+    static_assert(VAL1.at(TestEnum65::V2) == 2);
+    static_assert(VAL1.at(TestEnum65::V64) == 64);
+    static_assert(!VAL1.contains(TestEnum65::V30));
+
+    SparseEnumMap<TestEnum65, int, 4> var1{
+        {TestEnum65::V2, 2}, {TestEnum65::V30, 30}, {TestEnum65::V64, 64}};
+    auto it = var1.erase(var1.find(TestEnum65::V2));
+    EXPECT_EQ(TestEnum65::V30, it->first);
+    EXPECT_EQ(30, it->second);
+    EXPECT_EQ(2, var1.size());
+}
+
+TEST(SparseEnumMap, EraseRange)
+{
+    SparseEnumMap<TestEnum65, int, 5> var1{{TestEnum65::V0, 0},
+                                           {TestEnum65::V3, 3},
+                                           {TestEnum65::V40, 40},
+                                           {TestEnum65::V63, 63},
+                                           {TestEnum65::V64, 64}};
+
+    // Across the boundary between the two words of the bitset
+    auto it = var1.erase(var1.find(TestEnum65::V3), var1.find(TestEnum65::V64));
+    EXPECT_EQ(TestEnum65::V64, it->first);
+    EXPECT_EQ(64, it->second);
+
+    EXPECT_EQ(2, var1.size());
+    EXPECT_EQ(0, var1.at(TestEnum65::V0));
+    EXPECT_EQ(64, var1.at(TestEnum65::V64));
+    EXPECT_FALSE(var1.contains(TestEnum65::V40));
+
+    var1.erase(var1.begin(), var1.end());
+    EXPECT_TRUE(var1.empty());
+
+    // Within the first word, with keys left after the range in both words
+    SparseEnumMap<TestEnum65, int, 5, customize::MapNoChecking<TestEnum65, int, 5>> var2{
+        {TestEnum65::V1, 1},
+        {TestEnum65::V2, 2},
+        {TestEnum65::V10, 10},
+        {TestEnum65::V60, 60},
+        {TestEnum65::V64, 64}};
+    auto it2 = var2.erase(var2.find(TestEnum65::V2), var2.find(TestEnum65::V60));
+    EXPECT_EQ(TestEnum65::V60, it2->first);
+    EXPECT_EQ(3, var2.size());
+    EXPECT_EQ(1, var2.at(TestEnum65::V1));
+    EXPECT_EQ(60, var2.at(TestEnum65::V60));
+    EXPECT_EQ(64, var2.at(TestEnum65::V64));
+    var2[TestEnum65::V30] = 30;
+    EXPECT_EQ(30, std::next(var2.begin())->second);
+    EXPECT_EQ(64, var2.at(TestEnum65::V64));
+}
+
+TEST(SparseEnumMap, EraseIf)
+{
+    SparseEnumMap<TestEnum65, int, 4> var1{
+        {TestEnum65::V1, 1}, {TestEnum65::V2, 2}, {TestEnum65::V3, 3}, {TestEnum65::V64, 64}};
+    const std::size_t removed_count =
+        erase_if(var1, [](const auto& entry) { return entry.second % 2 == 0; });
+    EXPECT_EQ(2, removed_count);
+    EXPECT_EQ((SparseEnumMap<TestEnum65, int, 4>{{TestEnum65::V1, 1}, {TestEnum65::V3, 3}}), var1);
+}
+
+TEST(SparseEnumMap, Equality)
+{
+    constexpr SparseEnumMap<TestEnum1, int, 3> VAL1{{TestEnum1::ONE, 10}, {TestEnum1::TWO, 20}};
+    constexpr SparseEnumMap<TestEnum1, int, 4> VAL2{{TestEnum1::TWO, 20}, {TestEnum1::ONE, 10}};
+    constexpr SparseEnumMap<TestEnum1, int, 3> VAL3{{TestEnum1::ONE, 10}, {TestEnum1::TWO, 21}};
+    constexpr SparseEnumMap<TestEnum1, int, 3> VAL4{{TestEnum1::ONE, 10}, {TestEnum1::FOUR, 20}};
+
+    static_assert(VAL1 == VAL2);
+    static_assert(VAL1 != VAL3);
+    static_assert(VAL1 != VAL4);
+}
+
+TEST(SparseEnumMap, NonTriviallyCopyableValue)
+{
+    SparseEnumMap<TestEnum65, std::string, 3> var1{};
+    var1[TestEnum65::V20] = "twenty";
+    var1.try_emplace(TestEnum65::V10, 3, 'x');
+    var1[TestEnum65::V60] = "sixty";
+
+    EXPECT_EQ("xxx", var1.at(TestEnum65::V10));
+    EXPECT_EQ("twenty", var1.at(TestEnum65::V20));
+
+    var1.erase(TestEnum65::V10);
+    EXPECT_EQ("twenty", var1.at(TestEnum65::V20));
+    EXPECT_EQ("sixty", var1.at(TestEnum65::V60));
+
+    const SparseEnumMap<TestEnum65, std::string, 3> copy = var1;
+    EXPECT_EQ(copy, var1);
+}
+
+TEST(SparseEnumMap, MatchesStdMap)
+{
+    static constexpr std::size_t MAX_ENTRIES = 16;
+    SparseEnumMap<TestEnum65, int, MAX_ENTRIES> var1{};
+    std::map<TestEnum65, int> reference{};
+
+    std::mt19937 engine{42};  // NOLINT(cert-msc32-c,cert-msc51-cpp)
+    std::uniform_int_distribution<std::size_t> key_distribution{0, 64};
+    for (int i = 0; i < 2000; i++)
+    {
+        const TestEnum65 key = rich_enums::EnumAdapter<TestEnum65>::values()
+            [key_distribution(engine)];
+        if (reference.size() < MAX_ENTRIES && i % 3 != 0)
+        {
+            var1.insert_or_assign(key, i);
+            reference.insert_or_assign(key, i);
+        }
+        else
+        {
+            EXPECT_EQ(reference.erase(key), var1.erase(key));
+        }
+
+        ASSERT_EQ(reference.size(), var1.size());
+        auto it = var1.cbegin();
+        for (const auto& [ref_key, ref_value] : reference)
+        {
+            ASSERT_EQ(ref_key, it->first);
+            ASSERT_EQ(ref_value, it->second);
+            ++it;
+        }
+        ASSERT_EQ(var1.cend(), it);
+    }
+}
+
+TEST(SparseEnumMap, KeysAcrossWords)
+{
+    // `TestEnum65` spans two words of the bitset, so keys of the second word are found through
+    // the running count of the first.
+    constexpr SparseEnumMap<TestEnum65, int, 5> VAL1 = []()
+    {
+        SparseEnumMap<TestEnum65, int, 5> var{};
+        var[TestEnum65::V64] = 64;
+        var[TestEnum65::V0] = 0;
+        var[TestEnum65::V63] = 63;
+        var[TestEnum65::V30] = 30;
+        var.erase(TestEnum65::V30);
+        var[TestEnum65::V1] = 1;
+        return var;
+    }();
+    static_assert(VAL1.size() == 4);
+    static_assert(VAL1.at(TestEnum65::V0) == 0);
+    static_assert(VAL1.at(TestEnum65::V1) == 1);
+    static_assert(VAL1.at(TestEnum65::V63) == 63);
+    static_assert(VAL1.at(TestEnum65::V64) == 64);
+    static_assert(std::prev(VAL1.end())->second == 64);
+    static_assert(VAL1.find(TestEnum65::V64)->second == 64);
+
+    constexpr SparseEnumMap<TestEnum65, int, 5> VAL2 = [&]()
+    {
+        SparseEnumMap<TestEnum65, int, 5> var = VAL1;
+        var.erase(var.find(TestEnum65::V1), var.find(TestEnum65::V64));
+        return var;
+    }();
+    static_assert(VAL2.size() == 2);
+    static_assert(VAL2.at(TestEnum65::V0) == 0);
+    static_assert(VAL2.at(TestEnum65::V64) == 64);
+    static_assert(VAL2.find(TestEnum65::V64)->second == 64);
+}
+
+TEST(SparseEnumMap, Full)
+{
+    SparseEnumMap<TestEnum65, int, 2> var1{{TestEnum65::V0, 0}, {TestEnum65::V64, 64}};
+    EXPECT_TRUE(is_full(var1));
+    // Existing keys can still be assigned
+    var1[TestEnum65::V64] = 65;
+    EXPECT_EQ(65, var1.at(TestEnum65::V64));
+
+    EXPECT_DEATH(var1[TestEnum65::V1] = 1, "");
+    EXPECT_DEATH(var1.insert({TestEnum65::V1, 1}), "");
+}
+
+TEST(SparseEnumMap, AtMissingKey)
+{
+    SparseEnumMap<TestEnum65, int, 2> var1{{TestEnum65::V0, 0}};
+    EXPECT_DEATH((void)var1.at(TestEnum65::V1), "");
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,382 @@
+#include "fixed_containers/stats_checking.hpp"
+
+#include "enums_test_common.hpp"
+
+#include "fixed_containers/checking_hooks.hpp"
+#include "fixed_containers/enum_map.hpp"
+#include "fixed_containers/fixed_circular_deque.hpp"
+#include "fixed_containers/fixed_deque.hpp"
+#include "fixed_containers/fixed_list.hpp"
+#include "fixed_containers/fixed_map.hpp"
+#include "fixed_containers/fixed_set.hpp"
+#include "fixed_containers/fixed_string.hpp"
+#include "fixed_containers/fixed_unordered_map.hpp"
+#include "fixed_containers/fixed_unordered_set.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/map_checking.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
+#include "fixed_containers/set_checking.hpp"
+#include "fixed_containers/sparse_enum_map.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <string>
+
+namespace fixed_containers
+{
+namespace
+{
+struct VectorTag
+{
+};
+struct MapTag
+{
+};
+struct UnorderedMapTag
+{
+};
+struct DequeTag
+{
+};
+struct CircularDequeTag
+{
+};
+struct ListTag
+{
+};
+struct SetTag
+{
+};
+struct UnorderedSetTag
+{
+};
+struct EnumMapTag
+{
+};
+struct SparseEnumMapTag
+{
+};
+struct StringTag
+{
+};
+struct OverflowTag
+{
+};
+struct OtherTag
+{
+};
+
+using VectorChecking = customize::SequenceContainerStatsChecking<int, 10, VectorTag>;
+using VectorType = FixedVector<int, 10, VectorChecking>;
+static_assert(customize::SequenceContainerChecking<VectorChecking>);
+static_assert(sizeof(VectorType) == sizeof(FixedVector<int, 10>));
+
+using MapChecking = customize::MapStatsChecking<int, int, 10, MapTag>;
+using MapType = FixedMap<int,
+                         int,
+                         10,
+                         std::less<int>,
+                         fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::
+                             EMBEDDED_COLOR,
+                         FixedIndexBasedPoolStorage,
+                         MapChecking>;
+static_assert(customize::MapChecking<MapChecking, int>);
+
+using UnorderedMapChecking = customize::MapStatsChecking<int, int, 10, UnorderedMapTag>;
+constexpr std::size_t BUCKET_COUNT = fixed_robinhood_hashtable_detail::default_bucket_count(10);
+using UnorderedMapType = FixedUnorderedMap<int,
+                                           int,
+                                           10,
+                                           wyhash::hash<int>,
+                                           std::equal_to<int>,
+                                           BUCKET_COUNT,
+                                           UnorderedMapChecking>;
+
+using TestEnum1 = rich_enums::TestEnum1;
+
+using SetChecking = customize::SetStatsChecking<int, 10, SetTag>;
+static_assert(customize::SetChecking<SetChecking, int>);
+using EnumMapChecking = customize::MapStatsChecking<TestEnum1, int, 4, EnumMapTag>;
+static_assert(customize::EnumMapChecking<EnumMapChecking, TestEnum1>);
+
+static_assert(checking_hooks::ObservesUsage<VectorChecking>);
+static_assert(checking_hooks::ObservesUsage<SetChecking>);
+static_assert(!checking_hooks::ObservesUsage<customize::SequenceContainerAbortChecking<int, 10>>);
+static_assert(!checking_hooks::ObservesUsage<void>);
+
+bool is_registered(const customize::ContainerStats& expected)
+{
+    bool found = false;
+    customize::ContainerStatsRegistry::for_each(
+        [&](const customize::ContainerStats& stats) { found = found || &stats == &expected; });
+    return found;
+}
+}  // namespace
+
+TEST(StatsChecking, SequenceContainer)
+{
+    const customize::ContainerStats& stats = VectorChecking::stats();
+    EXPECT_EQ(10, stats.capacity);
+
+    VectorType var1{};
+    for (int i = 0; i < 9; i++)
+    {
+        var1.push_back(i);
+    }
+    var1.pop_back();
+    var1.erase(var1.begin(), var1.begin() + 2);
+    var1.resize(8);
+    var1.clear();
+
+    EXPECT_EQ(9, stats.high_water_mark.load());
+    EXPECT_EQ(11, stats.insert_count.load());
+    EXPECT_EQ(11, stats.erase_count.load());
+    EXPECT_EQ(1, stats.near_full_count.load());
+    EXPECT_EQ(0, stats.overflow_count.load());
+    EXPECT_TRUE(is_registered(stats));
+}
+
+TEST(StatsChecking, Map)
+{
+    const customize::ContainerStats& stats = MapChecking::stats();
+
+    MapType var1{};
+    var1[1] = 10;
+    var1.try_emplace(2, 20);
+    var1.insert({3, 30});
+    var1.insert({3, 31});  // Already there, not an insert
+    EXPECT_EQ(20, var1.at(2));
+    EXPECT_TRUE(var1.contains(3));
+    EXPECT_EQ(var1.end(), var1.find(4));
+    var1.erase(1);
+    var1.erase(4);  // Not there, not an erase
+
+    EXPECT_EQ(3, stats.high_water_mark.load());
+    EXPECT_EQ(3, stats.insert_count.load());
+    EXPECT_EQ(1, stats.erase_count.load());
+    EXPECT_EQ(3, stats.lookup_count.load());
+    EXPECT_EQ(0, stats.near_full_count.load());
+    EXPECT_TRUE(is_registered(stats));
+}
+
+TEST(StatsChecking, UnorderedMap)
+{
+    const customize::ContainerStats& stats = UnorderedMapChecking::stats();
+
+    UnorderedMapType var1{};
+    for (int i = 0; i < 10; i++)
+    {
+        var1[i] = i;
+    }
+    EXPECT_EQ(4, var1.at(4));
+    var1.clear();
+
+    EXPECT_EQ(10, stats.high_water_mark.load());
+    EXPECT_EQ(10, stats.insert_count.load());
+    EXPECT_EQ(10, stats.erase_count.load());
+    EXPECT_EQ(1, stats.lookup_count.load());
+    EXPECT_EQ(1, stats.near_full_count.load());
+}
+
+TEST(StatsChecking, Deque)
+{
+    using DequeChecking = customize::SequenceContainerStatsChecking<int, 10, DequeTag>;
+    const customize::ContainerStats& stats = DequeChecking::stats();
+
+    FixedDeque<int, 10, DequeChecking> var1{};
+    var1.push_back(1);
+    var1.push_front(0);
+    var1.insert(var1.begin() + 1, {5, 6, 7});
+    var1.pop_front();
+    var1.erase(var1.begin(), var1.begin() + 2);
+    var1.resize(4);
+    var1.clear();
+
+    EXPECT_EQ(5, stats.high_water_mark.load());
+    EXPECT_EQ(7, stats.insert_count.load());
+    EXPECT_EQ(7, stats.erase_count.load());
+}
+
+TEST(StatsChecking, CircularDeque)
+{
+    using CircularDequeChecking =
+        customize::SequenceContainerStatsChecking<int, 3, CircularDequeTag>;
+    const customize::ContainerStats& stats = CircularDequeChecking::stats();
+
+    FixedCircularDeque<int, 3, CircularDequeChecking> var1{};
+    for (int i = 0; i < 5; i++)
+    {
+        var1.push_back(i);  // Overwrites the front once full
+    }
+    var1.pop_front();
+
+    EXPECT_EQ(3, stats.high_water_mark.load());
+    EXPECT_EQ(5, stats.insert_count.load());
+    EXPECT_EQ(3, stats.erase_count.load());
+}
+
+TEST(StatsChecking, List)
+{
+    using ListChecking = customize::SequenceContainerStatsChecking<int, 10, ListTag>;
+    const customize::ContainerStats& stats = ListChecking::stats();
+
+    FixedList<int, 10, ListChecking> var1{1, 2, 3};
+    var1.push_front(0);
+    var1.pop_back();
+    var1.clear();
+
+    EXPECT_EQ(4, stats.high_water_mark.load());
+    EXPECT_EQ(4, stats.insert_count.load());
+    EXPECT_EQ(4, stats.erase_count.load());
+}
+
+TEST(StatsChecking, String)
+{
+    using StringChecking = customize::SequenceContainerStatsChecking<char, 16, StringTag>;
+    const customize::ContainerStats& stats = StringChecking::stats();
+
+    FixedString<16, StringChecking> var1{};
+    var1.append_number(12345);
+    var1.append_number(-7);
+    var1.push_back('!');
+    var1.erase(0, 2);
+
+    EXPECT_EQ("345-7!", var1);
+    EXPECT_EQ(8, stats.high_water_mark.load());
+    EXPECT_EQ(8, stats.insert_count.load());
+    EXPECT_EQ(2, stats.erase_count.load());
+}
+
+TEST(StatsChecking, Set)
+{
+    const customize::ContainerStats& stats = SetChecking::stats();
+    EXPECT_EQ("set", stats.container_kind);
+
+    FixedSet<int,
+             10,
+             std::less<int>,
+             fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+             FixedIndexBasedPoolStorage,
+             SetChecking>
+        var1{};
+    var1.insert(1);
+    var1.insert(2);
+    var1.insert(2);  // Already there, not an insert
+    var1.emplace(3);
+    EXPECT_TRUE(var1.contains(2));
+    EXPECT_EQ(var1.end(), var1.find(4));
+    var1.erase(1);
+    var1.erase(4);  // Not there, not an erase
+    var1.clear();
+
+    EXPECT_EQ(3, stats.high_water_mark.load());
+    EXPECT_EQ(3, stats.insert_count.load());
+    EXPECT_EQ(3, stats.erase_count.load());
+    EXPECT_EQ(2, stats.lookup_count.load());
+}
+
+TEST(StatsChecking, UnorderedSet)
+{
+    using UnorderedSetChecking = customize::SetStatsChecking<int, 10, UnorderedSetTag>;
+    const customize::ContainerStats& stats = UnorderedSetChecking::stats();
+
+    FixedUnorderedSet<int,
+                      10,
+                      wyhash::hash<int>,
+                      std::equal_to<int>,
+                      BUCKET_COUNT,
+                      UnorderedSetChecking>
+        var1{};
+    for (int i = 0; i < 10; i++)
+    {
+        var1.insert(i);
+    }
+    var1.insert(3);  // Already there, not an insert
+    EXPECT_TRUE(var1.contains(4));
+    var1.erase(4);
+    var1.clear();
+
+    EXPECT_EQ(10, stats.high_water_mark.load());
+    EXPECT_EQ(10, stats.insert_count.load());
+    EXPECT_EQ(10, stats.erase_count.load());
+    EXPECT_EQ(1, stats.lookup_count.load());
+    EXPECT_EQ(1, stats.near_full_count.load());
+}
+
+TEST(StatsChecking, EnumMap)
+{
+    const customize::ContainerStats& stats = EnumMapChecking::stats();
+
+    EnumMap<TestEnum1, int, EnumMapChecking> var1{};
+    var1[TestEnum1::ONE] = 10;
+    var1.try_emplace(TestEnum1::TWO, 20);
+    var1.try_emplace(TestEnum1::TWO, 21);  // Already there, not an insert
+    EXPECT_TRUE(var1.contains(TestEnum1::ONE));
+    EXPECT_EQ(var1.end(), var1.find(TestEnum1::THREE));
+    var1.erase(TestEnum1::ONE);
+    var1.clear();
+
+    EXPECT_EQ(2, stats.high_water_mark.load());
+    EXPECT_EQ(2, stats.insert_count.load());
+    EXPECT_EQ(2, stats.erase_count.load());
+    EXPECT_EQ(2, stats.lookup_count.load());
+}
+
+TEST(StatsChecking, SparseEnumMap)
+{
+    using SparseEnumMapChecking = customize::MapStatsChecking<TestEnum1, int, 4, SparseEnumMapTag>;
+    const customize::ContainerStats& stats = SparseEnumMapChecking::stats();
+
+    SparseEnumMap<TestEnum1, int, 4, SparseEnumMapChecking> var1{};
+    var1[TestEnum1::ONE] = 10;
+    var1.try_emplace(TestEnum1::TWO, 20);
+    var1.try_emplace(TestEnum1::THREE, 30);
+    EXPECT_TRUE(var1.contains(TestEnum1::ONE));
+    var1.erase(TestEnum1::ONE);
+    var1.clear();
+
+    EXPECT_EQ(3, stats.high_water_mark.load());
+    EXPECT_EQ(3, stats.insert_count.load());
+    EXPECT_EQ(3, stats.erase_count.load());
+    EXPECT_EQ(1, stats.lookup_count.load());
+}
+
+TEST(StatsChecking, NotRecordedInConstantExpressions)
+{
+    using OtherChecking = customize::SequenceContainerStatsChecking<int, 4, OtherTag>;
+    constexpr FixedVector<int, 4, OtherChecking> VAL1{1, 2, 3};
+    static_assert(VAL1.size() == 3);
+    EXPECT_EQ(0, OtherChecking::stats().insert_count.load());
+}
+
+TEST(StatsChecking, Dump)
+{
+    VectorType var1{1, 2};
+
+    std::FILE* file = std::tmpfile();
+    ASSERT_NE(nullptr, file);
+    customize::ContainerStatsRegistry::dump(file);
+    std::rewind(file);
+    std::string contents{};
+    for (int character = std::fgetc(file); character != EOF; character = std::fgetc(file))
+    {
+        contents.push_back(static_cast<char>(character));
+    }
+    std::fclose(file);
+
+    EXPECT_NE(std::string::npos, contents.find("high_water"));
+    EXPECT_NE(std::string::npos, contents.find("VectorTag"));
+}
+
+TEST(StatsChecking, OverflowDumpsAndAborts)
+{
+    using OverflowVectorType =
+        FixedVector<int, 2, customize::SequenceContainerStatsChecking<int, 2, OverflowTag>>;
+    OverflowVectorType var1{1, 2};
+    EXPECT_DEATH(var1.push_back(3), "OverflowTag");
+}
+
+}  // namespace fixed_containers
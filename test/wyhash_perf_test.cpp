@@ -0,0 +1,63 @@
+#include "fixed_containers/wyhash.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+std::vector<std::uint64_t> make_random_keys(std::size_t count)
+{
+    std::mt19937_64 generator{1};
+    std::vector<std::uint64_t> out(count);
+    for (std::uint64_t& key : out)
+    {
+        key = generator();
+    }
+    return out;
+}
+
+void benchmark_hash_one_by_one(benchmark::State& state)
+{
+    const std::vector<std::uint64_t> keys =
+        make_random_keys(static_cast<std::size_t>(state.range(0)));
+    std::vector<std::uint64_t> hashes(keys.size());
+    const wyhash::hash<std::uint64_t> hasher{};
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < keys.size(); i++)
+        {
+            hashes[i] = hasher(keys[i]);
+        }
+        benchmark::DoNotOptimize(hashes.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * keys.size()));
+}
+
+void benchmark_hash_batch(benchmark::State& state)
+{
+    const std::vector<std::uint64_t> keys =
+        make_random_keys(static_cast<std::size_t>(state.range(0)));
+    std::vector<std::uint64_t> hashes(keys.size());
+    for (auto _ : state)
+    {
+        wyhash::hash_batch(std::span<const std::uint64_t>{keys}, std::span{hashes});
+        benchmark::DoNotOptimize(hashes.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * keys.size()));
+}
+}  // namespace
+
+BENCHMARK(benchmark_hash_one_by_one)->Arg(64)->Arg(4096);
+BENCHMARK(benchmark_hash_batch)->Arg(64)->Arg(4096);
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -0,0 +1,188 @@
+#include "fixed_containers/wyhash.hpp"
+
+#include "fixed_containers/fixed_string.hpp"
+#include "fixed_containers/fixed_unordered_map.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+struct Point3
+{
+    std::int32_t x;
+    std::int32_t y;
+    std::int32_t z;
+
+    constexpr bool operator==(const Point3&) const = default;
+};
+static_assert(wyhash_detail::ByteHashable<Point3>);
+
+struct PaddedStruct
+{
+    std::int8_t a;
+    std::int64_t b;
+};
+// Padding bytes would make equal values hash differently
+static_assert(!wyhash_detail::ByteHashable<PaddedStruct>);
+
+template <typename T>
+std::uint64_t runtime_hash(const T& value)
+{
+    return wyhash::hash<T>{}(value);
+}
+}  // namespace
+
+TEST(WyHash, StringView)
+{
+    static constexpr std::string_view VAL1 = "a string that is longer than forty-eight characters";
+    static constexpr std::uint64_t HASH = wyhash::hash<std::string_view>{}(VAL1);
+    EXPECT_EQ(HASH, runtime_hash(VAL1));
+    EXPECT_EQ(HASH, wyhash_detail::hash(VAL1.data(), static_cast<std::int64_t>(VAL1.size())));
+    EXPECT_EQ(HASH, runtime_hash(std::string{VAL1}));
+}
+
+TEST(WyHash, Array)
+{
+    static constexpr std::array<std::int32_t, 3> VAL1{1, 2, 3};
+    static constexpr std::uint64_t HASH = wyhash::hash<std::array<std::int32_t, 3>>{}(VAL1);
+    EXPECT_EQ(HASH, runtime_hash(VAL1));
+    EXPECT_EQ(HASH, wyhash_detail::hash(VAL1.data(), sizeof(VAL1)));
+    EXPECT_NE(HASH, runtime_hash(std::array<std::int32_t, 3>{1, 2, 4}));
+
+    const std::array<std::string, 2> strings{"a", "b"};
+    EXPECT_EQ(runtime_hash(strings), runtime_hash(std::array<std::string, 2>{"a", "b"}));
+    EXPECT_NE(runtime_hash(strings), runtime_hash(std::array<std::string, 2>{"b", "a"}));
+}
+
+TEST(WyHash, Pair)
+{
+    static constexpr std::pair<int, std::uint8_t> VAL1{3, 4};
+    static constexpr std::uint64_t HASH = wyhash::hash<std::pair<int, std::uint8_t>>{}(VAL1);
+    EXPECT_EQ(HASH, runtime_hash(VAL1));
+    EXPECT_NE(HASH, runtime_hash(std::pair<int, std::uint8_t>{4, 3}));
+}
+
+TEST(WyHash, PlainStruct)
+{
+    static constexpr Point3 VAL1{1, 2, 3};
+    static constexpr std::uint64_t HASH = wyhash::hash<Point3>{}(VAL1);
+    EXPECT_EQ(HASH, runtime_hash(VAL1));
+    EXPECT_EQ(HASH, wyhash_detail::hash(&VAL1, sizeof(VAL1)));
+    EXPECT_NE(HASH, runtime_hash(Point3{1, 2, 4}));
+}
+
+TEST(WyHash, FixedVector)
+{
+    static constexpr FixedVector<std::int32_t, 8> VAL1{1, 2, 3};
+    static constexpr std::uint64_t HASH = wyhash::hash<FixedVector<std::int32_t, 8>>{}(VAL1);
+    EXPECT_EQ(HASH, runtime_hash(VAL1));
+    EXPECT_EQ(HASH, runtime_hash(std::array<std::int32_t, 3>{1, 2, 3}));
+
+    // Unused capacity is not hashed
+    FixedVector<std::int32_t, 8> var1{1, 2, 3, 4};
+    var1.pop_back();
+    EXPECT_EQ(HASH, runtime_hash(var1));
+
+    const FixedVector<std::string, 4> strings{"a", "bc"};
+    EXPECT_EQ(runtime_hash(strings), runtime_hash(FixedVector<std::string, 4>{"a", "bc"}));
+    EXPECT_NE(runtime_hash(strings), runtime_hash(FixedVector<std::string, 4>{"ab", "c"}));
+}
+
+TEST(WyHash, FixedString)
+{
+    static constexpr FixedString<16> VAL1{"symbol"};
+    static constexpr std::uint64_t HASH = wyhash::hash<FixedString<16>>{}(VAL1);
+    EXPECT_EQ(HASH, runtime_hash(VAL1));
+    EXPECT_EQ(HASH, runtime_hash(std::string_view{"symbol"}));
+
+    static constexpr ZeroPaddedFixedString<16> VAL2{"symbol"};
+    static constexpr std::uint64_t PADDED_HASH = wyhash::hash<ZeroPaddedFixedString<16>>{}(VAL2);
+    EXPECT_EQ(PADDED_HASH, runtime_hash(VAL2));
+}
+
+TEST(WyHash, UsableAsUnorderedMapKeys)
+{
+    FixedUnorderedMap<FixedString<16>, int, 8> var1{};
+    var1[FixedString<16>{"one"}] = 1;
+    var1[FixedString<16>{"two"}] = 2;
+    EXPECT_EQ(2, var1.at(FixedString<16>{"two"}));
+
+    FixedUnorderedMap<Point3, int, 8> var2{};
+    var2[Point3{1, 2, 3}] = 6;
+    EXPECT_TRUE(var2.contains(Point3{1, 2, 3}));
+    EXPECT_FALSE(var2.contains(Point3{3, 2, 1}));
+
+    FixedUnorderedMap<std::array<std::int16_t, 2>, int, 8> var3{};
+    var3[{1, 2}] = 3;
+    EXPECT_EQ(3, var3.at({1, 2}));
+}
+
+TEST(WyHash, HashBatchIntegers)
+{
+    // Including empty input
+    for (std::size_t count = 0; count <= 11; count++)
+    {
+        std::vector<std::int64_t> keys(count);
+        std::iota(keys.begin(), keys.end(), -5);
+        std::vector<std::uint64_t> hashes(count);
+        wyhash::hash_batch(std::span<const std::int64_t>{keys}, std::span{hashes});
+        for (std::size_t i = 0; i < count; i++)
+        {
+            ASSERT_EQ(runtime_hash(keys[i]), hashes[i]);
+        }
+    }
+
+    static constexpr std::array<std::uint64_t, 6> HASHES = []()
+    {
+        constexpr std::array<std::uint16_t, 6> KEYS{1, 2, 3, 4, 5, 6};
+        std::array<std::uint64_t, 6> out{};
+        wyhash::hash_batch(std::span<const std::uint16_t>{KEYS}, std::span{out});
+        return out;
+    }();
+    static_assert(HASHES[5] == wyhash::hash<std::uint16_t>{}(6));
+}
+
+TEST(WyHash, HashBatchFromFixedVector)
+{
+    const FixedVector<std::uint64_t, 64> keys{10, 20, 30, 40, 50};
+    std::array<std::uint64_t, 64> hashes{};
+    wyhash::hash_batch(std::span<const std::uint64_t>{keys}, std::span{hashes});
+    for (std::size_t i = 0; i < keys.size(); i++)
+    {
+        EXPECT_EQ(runtime_hash(keys[i]), hashes.at(i));
+    }
+}
+
+TEST(WyHash, HashBatchOtherKeys)
+{
+    const std::array<std::string_view, 3> keys{"a", "bc", "def"};
+    std::array<std::uint64_t, 3> hashes{};
+    wyhash::hash_batch(std::span<const std::string_view>{keys}, std::span{hashes});
+    for (std::size_t i = 0; i < keys.size(); i++)
+    {
+        EXPECT_EQ(runtime_hash(keys.at(i)), hashes.at(i));
+    }
+
+    // A custom hasher is used as given, also for integers
+    const std::array<int, 5> ints{1, 2, 3, 4, 5};
+    std::array<std::uint64_t, 5> doubled{};
+    wyhash::hash_batch(std::span<const int>{ints},
+                       std::span{doubled},
+                       [](int value) { return static_cast<std::uint64_t>(value) * 2; });
+    EXPECT_EQ((std::array<std::uint64_t, 5>{2, 4, 6, 8, 10}), doubled);
+}
+
+}  // namespace fixed_containers